@@ -0,0 +1,124 @@
+/**
+ * Throughput of the 1-bit to RGBA conversions in lib/bitmap/conversion.ts
+ *
+ * Converts a full game frame (512x342) with the per-pixel loop the
+ * renderers used to carry and with each blitter variant, and reports
+ * output megapixels per second.
+ *
+ * Usage: npm run bench-conversion [iterations]
+ */
+
+import {
+  blitRegionToPixels,
+  blitRowsToPixels,
+  blitToPixels,
+  createMonochromeBitmap,
+  createPixelTable,
+  type MonochromeBitmap
+} from '@lib/bitmap'
+
+const WIDTH = 512
+const HEIGHT = 342
+
+// A frame-like mix of empty rows and busy ones
+const makeFrame = (): MonochromeBitmap => {
+  const bitmap = createMonochromeBitmap(WIDTH, HEIGHT)
+  let seed = 12345
+  for (let i = 0; i < bitmap.data.length; i++) {
+    seed = (Math.imul(seed, 1103515245) + 12345) | 0
+    const row = Math.floor(i / bitmap.rowBytes)
+    bitmap.data[i] = row % 3 === 0 ? 0 : (seed >>> 16) & 0xff
+  }
+  return bitmap
+}
+
+// The loop the renderers used before the lookup table
+const perPixel = (
+  bitmap: MonochromeBitmap,
+  pixels: Uint8ClampedArray
+): void => {
+  for (let y = 0; y < bitmap.height; y++) {
+    for (let x = 0; x < bitmap.width; x++) {
+      const byteIndex = y * bitmap.rowBytes + Math.floor(x / 8)
+      const isSet = (bitmap.data[byteIndex]! & (0x80 >> (x % 8))) !== 0
+      const pixelIndex = (y * bitmap.width + x) * 4
+      const value = isSet ? 0 : 255
+      pixels[pixelIndex] = value
+      pixels[pixelIndex + 1] = value
+      pixels[pixelIndex + 2] = value
+      pixels[pixelIndex + 3] = 255
+    }
+  }
+}
+
+const measure = (
+  name: string,
+  iterations: number,
+  outputPixels: number,
+  run: () => void
+): void => {
+  // Warm up so the JIT has settled before timing
+  for (let i = 0; i < Math.min(50, iterations); i++) run()
+
+  const start = performance.now()
+  for (let i = 0; i < iterations; i++) run()
+  const elapsed = performance.now() - start
+
+  const perCall = elapsed / iterations
+  const mpps = (outputPixels * iterations) / (elapsed * 1000)
+  console.log(
+    `${name.padEnd(28)} ${perCall.toFixed(3).padStart(8)} ms ` +
+      `${mpps.toFixed(0).padStart(6)} Mpx/s`
+  )
+}
+
+const main = (): void => {
+  const iterations = Number(process.argv[2] ?? 500)
+  const frame = makeFrame()
+  const table = createPixelTable()
+  const pixelCount = WIDTH * HEIGHT
+
+  console.log(`${WIDTH}x${HEIGHT} frame, ${iterations} iterations\n`)
+
+  const bytes = new Uint8ClampedArray(pixelCount * 4)
+  measure('per-pixel loop', iterations, pixelCount, () =>
+    perPixel(frame, bytes)
+  )
+
+  const pixels = new Uint32Array(pixelCount)
+  measure('blitToPixels', iterations, pixelCount, () =>
+    blitToPixels(frame, pixels, table)
+  )
+
+  for (const scale of [2, 3]) {
+    const scaled = new Uint32Array(pixelCount * scale * scale)
+    measure(`blitToPixels x${scale}`, iterations, pixelCount * scale ** 2, () =>
+      blitToPixels(frame, scaled, table, WIDTH, HEIGHT, scale)
+    )
+  }
+
+  const region = { x: 101, y: 60, width: 240, height: 200 }
+  const regionPixels = new Uint32Array(region.width * region.height)
+  measure(
+    'blitRegionToPixels, unaligned',
+    iterations,
+    region.width * region.height,
+    () => blitRegionToPixels(frame, regionPixels, region, table)
+  )
+
+  // About what a frame with the ship and a few shots moving changes
+  const rows = [
+    { start: 40, end: 52 },
+    { start: 150, end: 182 },
+    { start: 300, end: 306 }
+  ]
+  const dirty = rows.reduce((sum, span) => sum + span.end - span.start, 0)
+  measure(
+    `blitRowsToPixels, ${dirty} rows`,
+    iterations,
+    WIDTH * dirty,
+    () => blitRowsToPixels(frame, pixels, rows, table)
+  )
+}
+
+main()
@@ -0,0 +1,106 @@
+/**
+ * @fileoverview Regenerate the benchmark corpus
+ *
+ * Records every entry in CORPUS_ENTRIES through the headless engine and
+ * writes corpus/<name>.bin (gzipped binary recordings) and
+ * corpus/manifest.json with the final hash and score each must replay to.
+ * The output only changes when the pilots, the entries or the engine do.
+ *
+ * Usage: npm run generate-corpus [name-filter]
+ */
+
+import fs from 'fs'
+import path from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import type { GalaxyService } from '@core/galaxy'
+import { encodeRecordingGzip } from '@core/recording/binaryCodec'
+import { createSpriteServiceNode } from '@core/sprites/createSpriteServiceNode'
+import {
+  CORPUS_ENTRIES,
+  recordCorpusEntry,
+  type CorpusManifest,
+  type CorpusManifestEntry
+} from '@core/validation/corpus'
+import { GALAXIES } from '@/game/galaxyConfig'
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import { compress } from './gzip.node'
+
+const PUBLIC_DIR = 'src/game/public'
+const CORPUS_DIR = 'corpus'
+const MANIFEST_PATH = path.join(CORPUS_DIR, 'manifest.json')
+
+const main = async (): Promise<void> => {
+  const filter = process.argv[2]
+  const spriteService = createSpriteServiceNode(
+    path.join(PUBLIC_DIR, 'rsrc_260.bin')
+  )
+
+  const galaxyServices = new Map<string, GalaxyService>()
+  const galaxyService = (galaxyId: string): GalaxyService => {
+    let service = galaxyServices.get(galaxyId)
+    if (!service) {
+      const config = GALAXIES.find(g => g.id === galaxyId)
+      if (!config) {
+        throw new Error(`Unknown galaxy ID: ${galaxyId}`)
+      }
+      service = createGalaxyServiceNode(path.join(PUBLIC_DIR, config.path))
+      galaxyServices.set(galaxyId, service)
+    }
+    return service
+  }
+
+  // Keep the entries a filtered run does not touch
+  const previous: CorpusManifestEntry[] =
+    filter && fs.existsSync(MANIFEST_PATH)
+      ? (JSON.parse(fs.readFileSync(MANIFEST_PATH, 'utf8')) as CorpusManifest)
+          .entries
+      : []
+
+  fs.mkdirSync(CORPUS_DIR, { recursive: true })
+
+  const entries: CorpusManifestEntry[] = []
+  for (const entry of CORPUS_ENTRIES) {
+    const kept = previous.find(e => e.name === entry.name)
+    if (filter && !entry.name.includes(filter)) {
+      if (kept) entries.push(kept)
+      continue
+    }
+
+    const started = performance.now()
+    const { recording, finalHash } = recordCorpusEntry(
+      entry,
+      galaxyService(entry.galaxyId),
+      spriteService
+    )
+    const file = `${entry.name}.bin`
+    const binary = await encodeRecordingGzip(recording, compress)
+    fs.writeFileSync(path.join(CORPUS_DIR, file), Buffer.from(binary))
+
+    const { score, level } = recording.finalState!
+    entries.push({
+      ...entry,
+      file,
+      finalHash,
+      finalScore: score,
+      finalLevel: level,
+      snapshots: recording.snapshots.length
+    })
+    console.log(
+      `${file}: ${entry.frames} frames, score ${score}, level ${level}, ` +
+        `${binary.byteLength} bytes ` +
+        `(${Math.round(performance.now() - started)}ms)`
+    )
+  }
+
+  const manifest: CorpusManifest = {
+    engineVersion: GAME_ENGINE_VERSION,
+    entries
+  }
+  fs.writeFileSync(MANIFEST_PATH, JSON.stringify(manifest, null, 2) + '\n')
+  console.log(`Wrote ${MANIFEST_PATH} (${entries.length} entries)`)
+}
+
+main().catch(err => {
+  console.error('Fatal error:', err)
+  process.exit(1)
+})
@@ -1,10 +1,18 @@
 import { createRecordingService } from '@core/recording'
 import { decodeRecordingAuto } from '@core/recording/binaryCodec'
 import {
+  checkPlausibility,
   createHeadlessGameEngine,
   createRecordingValidator,
-  createHeadlessStore
+  createHeadlessStore,
+  hashState,
+  implausibleReport,
+  validateCached,
+  type ValidationCacheStore
 } from '@core/validation'
+import {
+  createValidationCacheNode
+} from '@core/validation/createValidationCacheNode'
 import { decompress } from './gzip.node'
 import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
 import { createRandomService } from '@/core/shared'
@@ -15,21 +23,19 @@ import { GALAXIES } from '@/game/galaxyConfig'
 import fs from 'fs'
 import path from 'path'
 
-const main = async (): Promise<void> => {
-  const args = process.argv.slice(2)
-
-  if (args.length === 0) {
-    console.log('Usage: npm run validate-recording <recording-file.json|.bin>')
-    process.exit(1)
-  }
-
-  // Load recording from file
-  const filePath = args[0]
-  if (!filePath) {
-    console.error('Error: No file path provided')
-    process.exit(1)
-  }
+// Results are kept here between runs, keyed by recording, galaxy and
+// engine version
+const CACHE_DIR = 'node_modules/.cache/validate-recording'
 
+/**
+ * Validate one recording file and print the report
+ *
+ * @returns Whether the recording validated
+ */
+const validateFile = async (
+  filePath: string,
+  cache: ValidationCacheStore | null
+): Promise<boolean> => {
   // Load and decode recording (auto-detect format: gzipped binary, binary, or JSON)
   const fileBuffer = fs.readFileSync(filePath)
 
@@ -47,7 +53,7 @@ const main = async (): Promise<void> => {
   if (!galaxyConfig) {
     console.error(`Unknown galaxy ID: ${recording.galaxyId}`)
     console.error(`Available galaxies: ${GALAXIES.map(g => g.id).join(', ')}`)
-    process.exit(1)
+    return false
   }
 
   // Map web path to file system path
@@ -94,11 +100,39 @@ const main = async (): Promise<void> => {
     `Total frames: ${recording.inputs[recording.inputs.length - 1]?.frame ?? 0}`
   )
 
-  const report = validator.validate(recording)
+  const { report, cached, durationMs, finalStateHash } = await validateCached(
+    recording,
+    galaxyService,
+    cache,
+    () => {
+      // Reject impossible recordings before simulating them
+      const plausibility = checkPlausibility(recording, galaxyService)
+      if (!plausibility.plausible) {
+        return { report: implausibleReport(plausibility), finalStateHash: null }
+      }
+      const result = validator.validate(recording)
+      const finalState = engine.getFinalState() ?? store.getState()
+      return { report: result, finalStateHash: hashState(finalState) }
+    }
+  )
 
   console.log(`\nResult: ${report.success ? 'PASS' : 'FAIL'}`)
+  console.log(
+    cached
+      ? `Cached result (validation took ${durationMs.toFixed(0)}ms)`
+      : `Validation took ${durationMs.toFixed(0)}ms`
+  )
   console.log(`Frames validated: ${report.framesValidated}`)
   console.log(`Snapshots checked: ${report.snapshotsChecked}`)
+  if (finalStateHash !== null) {
+    console.log(`Final state hash: ${finalStateHash}`)
+  }
+
+  for (const error of report.errors) {
+    if (error.type === 'IMPLAUSIBLE') {
+      console.log(`  Implausible, not simulated: ${error.message}`)
+    }
+  }
 
   if (report.divergenceFrame !== null) {
     console.log(`\nDivergence at frame: ${report.divergenceFrame}`)
@@ -192,7 +226,33 @@ const main = async (): Promise<void> => {
     }
   }
 
-  process.exit(report.success ? 0 : 1)
+  return report.success
+}
+
+const main = async (): Promise<void> => {
+  const args = process.argv.slice(2)
+  const noCache = args.includes('--no-cache')
+  const files = args.filter(arg => arg !== '--no-cache')
+
+  if (files.length === 0) {
+    console.log(
+      'Usage: npm run validate-recording [--no-cache] <recording-file.json|.bin>...'
+    )
+    process.exit(1)
+  }
+
+  const cache = noCache ? null : createValidationCacheNode(CACHE_DIR)
+
+  let failed = 0
+  for (const filePath of files) {
+    if (!(await validateFile(filePath, cache))) failed++
+    if (files.length > 1) console.log('')
+  }
+
+  if (files.length > 1) {
+    console.log(`${files.length - failed}/${files.length} recordings passed`)
+  }
+  process.exit(failed === 0 ? 0 : 1)
 }
 
 main().catch(err => {
@@ -0,0 +1,28 @@
+/**
+ * @fileoverview Codec worker entry point
+ *
+ * Runs one job per message and posts the result back under the request's
+ * id, transferring any result buffers.
+ */
+
+import { compress, decompress } from '@core/recording/gzip.browser'
+import { runCodecJob } from './operations'
+import type { CodecRequest, CodecResponse } from './types'
+
+const gzip = { compress, decompress }
+
+self.onmessage = async (event: MessageEvent<CodecRequest>): Promise<void> => {
+  const { id } = event.data
+  try {
+    const { result, transfer } = await runCodecJob(event.data, gzip)
+    const response: CodecResponse = { id, ok: true, result }
+    self.postMessage(response, { transfer })
+  } catch (error) {
+    const response: CodecResponse = {
+      id,
+      ok: false,
+      error: error instanceof Error ? error.message : String(error)
+    }
+    self.postMessage(response)
+  }
+}
@@ -0,0 +1,175 @@
+import { describe, it, expect } from 'vitest'
+import { readFileSync } from 'fs'
+import { join } from 'path'
+import { ControlAction, type ControlMatrix } from '@core/controls'
+import { Galaxy } from '@core/galaxy/methods'
+import { parsePlanet } from '@core/planet'
+import type { GameRecording } from '@core/recording'
+import { decodeRecordingAuto } from '@core/recording/binaryCodec'
+import { compress, decompress } from '../../../scripts/gzip.node'
+import { createCodecClient } from './createCodecClient'
+import { runCodecJob } from './operations'
+import type { CodecRequest, CodecResponse } from './types'
+
+const gzip = { compress, decompress }
+
+const galaxyBuffer = (): ArrayBuffer => {
+  const file = readFileSync(
+    join(__dirname, '../galaxy/__tests__/sample_galaxy.bin')
+  )
+  return file.buffer.slice(file.byteOffset, file.byteOffset + file.byteLength)
+}
+
+const recording: GameRecording = {
+  version: '1.0',
+  engineVersion: 1,
+  galaxyId: 'codec-test',
+  startLevel: 2,
+  timestamp: 1234,
+  initialState: { lives: 3 },
+  inputs: [
+    {
+      frame: 0,
+      controls: Object.fromEntries(
+        Object.values(ControlAction).map(action => [
+          action,
+          action === ControlAction.THRUST
+        ])
+      ) as ControlMatrix
+    }
+  ],
+  snapshots: [{ frame: 0, hash: 'abc' }],
+  levelSeeds: [{ level: 2, seed: 99 }],
+  finalState: { score: 100, fuel: 50, level: 2 }
+}
+
+// Stands in for the worker: takes each request as postMessage would,
+// detaching the transferred buffers, and runs it through runCodecJob on a
+// later task. A crashing worker fires onerror instead of replying.
+const fakeWorker = (
+  transferred: ArrayBuffer[],
+  crash = false
+): Worker & { onmessage: ((event: MessageEvent) => void) | null } => {
+  const worker = {
+    onmessage: null as ((event: MessageEvent) => void) | null,
+    onerror: null as ((event: ErrorEvent) => void) | null,
+    terminate: (): void => {},
+    postMessage: (sent: CodecRequest, transfer: ArrayBuffer[]): void => {
+      const request = structuredClone(sent, { transfer })
+      transferred.push(...transfer)
+      if (crash) {
+        setTimeout(() => {
+          worker.onerror?.({
+            message: 'worker crashed',
+            preventDefault: (): void => {}
+          } as ErrorEvent)
+        })
+        return
+      }
+      void runCodecJob(request, gzip).then(
+        ({ result }) => {
+          const response: CodecResponse = { id: request.id, ok: true, result }
+          worker.onmessage?.({ data: response } as MessageEvent)
+        },
+        (error: Error) => {
+          const response: CodecResponse = {
+            id: request.id,
+            ok: false,
+            error: error.message
+          }
+          worker.onmessage?.({ data: response } as MessageEvent)
+        }
+      )
+    }
+  }
+  return worker as unknown as Worker & {
+    onmessage: ((event: MessageEvent) => void) | null
+  }
+}
+
+describe('createCodecClient', () => {
+  it('runs jobs inline when no worker is available', async () => {
+    const codec = createCodecClient({ gzip, createWorker: () => null })
+
+    const encoded = await codec.encodeRecording(recording)
+    expect(await decodeRecordingAuto(encoded.slice(0), decompress)).toEqual(
+      recording
+    )
+    expect(await codec.decodeRecording(encoded)).toEqual(recording)
+
+    const { header, planets } = await codec.openGalaxy(galaxyBuffer())
+    const { headerBuffer, planetsBuffer } = Galaxy.splitBuffer(galaxyBuffer())
+    expect(header).toEqual(Galaxy.parseHeader(headerBuffer))
+    expect(planets).toHaveLength(header.planets)
+    planets.forEach((planet, i) => {
+      const direct = parsePlanet(planetsBuffer, header.indexes, i + 1)
+      expect(planet!.lines).toHaveLength(direct.lines.length)
+      expect(planet!.bunkers).toEqual(direct.bunkers)
+    })
+  })
+
+  it('transfers copies of input buffers and matches the replies', async () => {
+    const transferred: ArrayBuffer[] = []
+    const codec = createCodecClient({
+      gzip,
+      createWorker: () => fakeWorker(transferred)
+    })
+
+    const encoded = await codec.encodeRecording(recording)
+    const buffer = galaxyBuffer()
+    const [decoded, galaxy] = await Promise.all([
+      codec.decodeRecording(encoded),
+      codec.openGalaxy(buffer)
+    ])
+    expect(decoded).toEqual(recording)
+    expect(galaxy.header.planets).toBe(5)
+    expect(transferred).toHaveLength(2)
+    transferred.forEach(sent => expect(sent.byteLength).toBe(0))
+    expect(encoded.byteLength).toBeGreaterThan(0)
+    expect(buffer.byteLength).toBeGreaterThan(0)
+  })
+
+  it('rejects with the worker error and keeps serving later jobs', async () => {
+    const codec = createCodecClient({
+      gzip,
+      createWorker: () => fakeWorker([])
+    })
+
+    const failure = await codec.openGalaxy(new ArrayBuffer(100)).then(
+      () => null,
+      (error: Error) => error.message
+    )
+    expect(failure).toBe('Not a valid galaxy file')
+    const { header } = await codec.openGalaxy(galaxyBuffer())
+    expect(header.planets).toBe(5)
+  })
+
+  it('reruns jobs inline when the worker crashes', async () => {
+    const transferred: ArrayBuffer[] = []
+    let started = 0
+    const codec = createCodecClient({
+      gzip,
+      createWorker: () => {
+        started++
+        return fakeWorker(transferred, true)
+      }
+    })
+
+    const encoded = await createCodecClient({
+      gzip,
+      createWorker: () => null
+    }).encodeRecording(recording)
+    const [decoded, galaxy] = await Promise.all([
+      codec.decodeRecording(encoded),
+      codec.openGalaxy(galaxyBuffer())
+    ])
+    expect(decoded).toEqual(recording)
+    expect(galaxy.header.planets).toBe(5)
+    // The worker had the buffers, and later jobs no longer go to it
+    expect(transferred).toHaveLength(2)
+    const { header } = await codec.openGalaxy(galaxyBuffer())
+    expect(header.planets).toBe(5)
+    expect(transferred).toHaveLength(2)
+    expect(started).toBe(1)
+  })
+})
@@ -0,0 +1,178 @@
+/**
+ * @fileoverview Promise-based client for the codec worker
+ *
+ * Recording and galaxy decoding run in a module worker so a large import
+ * or galaxy switch does not stall the main thread. Each job transfers a
+ * copy of its input buffer and keeps the original, so if the worker fails
+ * to load or crashes, the jobs it still owed are rerun inline. Callers
+ * hand their buffers over either way and must not use them afterwards.
+ * Where workers are unavailable (Node, tests, or a worker that fails to
+ * start) the same jobs run inline and the API is unchanged.
+ */
+
+import type { GameRecording } from '@core/recording'
+import type { GzipInterface } from '@core/recording/gzip'
+import { compress, decompress } from '@core/recording/gzip.browser'
+import { runCodecJob } from './operations'
+import type {
+  CodecJob,
+  CodecRequest,
+  CodecResult,
+  CodecResponse,
+  CodecResults,
+  OpenedGalaxy
+} from './types'
+
+export type CodecClient = {
+  /** Decode gzipped binary, binary or JSON; takes ownership of buffer */
+  decodeRecording(buffer: ArrayBuffer): Promise<GameRecording>
+
+  /** Encode to gzipped binary */
+  encodeRecording(recording: GameRecording): Promise<ArrayBuffer>
+
+  /** Split a galaxy file and parse every planet; takes ownership of buffer */
+  openGalaxy(buffer: ArrayBuffer): Promise<OpenedGalaxy>
+
+  /** Stop the worker; later jobs run inline */
+  dispose(): void
+}
+
+export type CodecClientOptions = {
+  /** Gzip for jobs run inline; defaults to the browser streams */
+  gzip?: GzipInterface
+
+  /** Start the worker, or return null to run every job inline */
+  createWorker?: () => Worker | null
+}
+
+type Pending = {
+  /** With the original buffer, for rerunning inline */
+  job: CodecJob
+  resolve: (result: CodecResult) => void
+  reject: (error: Error) => void
+}
+
+const defaultCreateWorker = (): Worker | null =>
+  typeof Worker === 'undefined'
+    ? null
+    : new Worker(new URL('./codec.worker.ts', import.meta.url), {
+        type: 'module'
+      })
+
+export const createCodecClient = (
+  options: CodecClientOptions = {}
+): CodecClient => {
+  const createWorker = options.createWorker ?? defaultCreateWorker
+  const gzip = options.gzip ?? { compress, decompress }
+  const pending = new Map<number, Pending>()
+  let nextId = 1
+  // undefined until the first job, null once running inline
+  let worker: Worker | null | undefined
+
+  const failAll = (message: string): void => {
+    for (const { reject } of pending.values()) {
+      reject(new Error(message))
+    }
+    pending.clear()
+  }
+
+  const stopWorker = (): void => {
+    worker?.terminate()
+    worker = null
+  }
+
+  const startWorker = (): Worker | null => {
+    try {
+      const started = createWorker()
+      if (!started) return null
+
+      started.onmessage = (event: MessageEvent<CodecResponse>): void => {
+        const response = event.data
+        const waiting = pending.get(response.id)
+        if (!waiting) return
+        pending.delete(response.id)
+        if (response.ok) {
+          waiting.resolve(response.result)
+        } else {
+          waiting.reject(new Error(response.error))
+        }
+      }
+      // A worker that cannot load or crashes is abandoned for good, and
+      // what it still owed runs inline
+      started.onerror = (event: ErrorEvent): void => {
+        event.preventDefault()
+        if (worker !== started) return
+        stopWorker()
+        console.warn(`Codec worker failed, running inline: ${event.message}`)
+        const owed = [...pending.values()]
+        pending.clear()
+        for (const { job, resolve, reject } of owed) {
+          runInline(job).then(resolve, reject)
+        }
+      }
+      return started
+    } catch {
+      return null
+    }
+  }
+
+  const runInline = async <J extends CodecJob>(
+    job: J
+  ): Promise<CodecResults[J['op']]> => {
+    const { result } = await runCodecJob(job, gzip)
+    return result as CodecResults[J['op']]
+  }
+
+  const run = <J extends CodecJob>(
+    job: J
+  ): Promise<CodecResults[J['op']]> => {
+    if (worker === undefined) {
+      worker = startWorker()
+    }
+    if (worker === null) {
+      return runInline(job)
+    }
+
+    const active = worker
+    const id = nextId++
+    return new Promise((resolve, reject) => {
+      pending.set(id, {
+        job,
+        resolve: resolve as Pending['resolve'],
+        reject
+      })
+      const sent: CodecJob = job
+      const request: CodecRequest =
+        'buffer' in sent
+          ? { ...sent, buffer: sent.buffer.slice(0), id }
+          : { ...sent, id }
+      active.postMessage(request, 'buffer' in request ? [request.buffer] : [])
+    })
+  }
+
+  return {
+    decodeRecording: buffer => run({ op: 'decodeRecording', buffer }),
+
+    encodeRecording: recording => run({ op: 'encodeRecording', recording }),
+
+    openGalaxy: buffer => run({ op: 'openGalaxy', buffer }),
+
+    dispose: (): void => {
+      stopWorker()
+      failAll('Codec client disposed')
+    }
+  }
+}
+
+let shared: CodecClient | null = null
+
+/**
+ * The codec client shared by the recording and galaxy services
+ */
+export const getCodecClient = (): CodecClient => {
+  if (!shared) {
+    shared = createCodecClient()
+  }
+  return shared
+}
+
@@ -0,0 +1,19 @@
+/**
+ * @fileoverview Codec module - Recording and galaxy decoding off the main thread
+ */
+
+export type {
+  OpenedGalaxy,
+  CodecJob,
+  CodecResults,
+  CodecResult,
+  CodecRequest,
+  CodecResponse
+} from './types'
+export { openGalaxy, parseGalaxyPlanet, runCodecJob } from './operations'
+export {
+  createCodecClient,
+  getCodecClient,
+  type CodecClient,
+  type CodecClientOptions
+} from './createCodecClient'
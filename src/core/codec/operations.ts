@@ -0,0 +1,87 @@
+/**
+ * @fileoverview The codec's work, runnable in the worker or inline
+ *
+ * Both the worker and the main-thread fallback call runCodecJob(), so a
+ * recording or galaxy decodes the same wherever it runs.
+ */
+
+import { Galaxy } from '@core/galaxy/methods'
+import type { PlanetsBuffer } from '@core/galaxy/types'
+import { parsePlanet, wallsInStartxOrder } from '@core/planet'
+import type { PlanetState } from '@core/planet'
+import {
+  decodeRecordingAuto,
+  encodeRecordingGzip
+} from '@core/recording/binaryCodec'
+import type { GzipInterface } from '@core/recording/gzip'
+import type { CodecJob, CodecResult, OpenedGalaxy } from './types'
+
+/**
+ * Parse a planet and flag whether its walls are in startx order
+ *
+ * Walls stay in file order, which the kind lists and junctions are built
+ * from.
+ */
+export const parseGalaxyPlanet = (
+  planetsBuffer: PlanetsBuffer,
+  indexes: number[],
+  levelNum: number
+): PlanetState => {
+  const planet = parsePlanet(planetsBuffer, indexes, levelNum)
+  planet.wallsSorted = wallsInStartxOrder(planet.lines)
+
+  if (!planet.wallsSorted) {
+    console.warn(
+      `Planet ${levelNum}: Walls are NOT sorted by startx. ` +
+        `Terrain scans fall back to walking their whole lists.`
+    )
+  }
+
+  return planet
+}
+
+/**
+ * Split a galaxy file and parse its header and every planet
+ *
+ * A planet that fails to parse is left null rather than failing the whole
+ * galaxy, so the error surfaces only if that planet is played.
+ */
+export const openGalaxy = (buffer: ArrayBuffer): OpenedGalaxy => {
+  const { headerBuffer, planetsBuffer } = Galaxy.splitBuffer(buffer)
+  const header = Galaxy.parseHeader(headerBuffer)
+
+  const planets: (PlanetState | null)[] = []
+  for (let i = 1; i <= header.planets; i++) {
+    try {
+      planets.push(parseGalaxyPlanet(planetsBuffer, header.indexes, i))
+    } catch {
+      planets.push(null)
+    }
+  }
+
+  return { header, planetsBuffer, planets }
+}
+
+/**
+ * Run a codec job, returning its result and the buffers in the result
+ * that can be transferred rather than copied
+ */
+export const runCodecJob = async (
+  job: CodecJob,
+  gzip: GzipInterface
+): Promise<{ result: CodecResult; transfer: ArrayBuffer[] }> => {
+  switch (job.op) {
+    case 'decodeRecording': {
+      const result = await decodeRecordingAuto(job.buffer, gzip.decompress)
+      return { result, transfer: [] }
+    }
+    case 'encodeRecording': {
+      const result = await encodeRecordingGzip(job.recording, gzip.compress)
+      return { result, transfer: [result] }
+    }
+    case 'openGalaxy': {
+      const result = openGalaxy(job.buffer)
+      return { result, transfer: [result.planetsBuffer] }
+    }
+  }
+}
@@ -0,0 +1,39 @@
+import type { GalaxyHeader, PlanetsBuffer } from '@core/galaxy/types'
+import type { PlanetState } from '@core/planet'
+import type { GameRecording } from '@core/recording'
+
+/**
+ * A galaxy file split, its header parsed and every planet parsed, ready to
+ * fill a galaxy service
+ */
+export type OpenedGalaxy = {
+  header: GalaxyHeader
+  planetsBuffer: PlanetsBuffer
+  /** Planet n at index n - 1, or null if it failed to parse */
+  planets: (PlanetState | null)[]
+}
+
+/**
+ * Work the codec can do, with the buffers it takes ownership of
+ */
+export type CodecJob =
+  | { op: 'decodeRecording'; buffer: ArrayBuffer }
+  | { op: 'encodeRecording'; recording: GameRecording }
+  | { op: 'openGalaxy'; buffer: ArrayBuffer }
+
+/** What each job resolves to */
+export type CodecResults = {
+  decodeRecording: GameRecording
+  encodeRecording: ArrayBuffer
+  openGalaxy: OpenedGalaxy
+}
+
+export type CodecResult = CodecResults[CodecJob['op']]
+
+/** Message posted to the worker */
+export type CodecRequest = CodecJob & { id: number }
+
+/** Message posted back by the worker */
+export type CodecResponse =
+  | { id: number; ok: true; result: CodecResult }
+  | { id: number; ok: false; error: string }
@@ -1,7 +1,7 @@
 import { describe, it, expect, beforeEach } from 'vitest'
 import { createCollisionService } from '../createCollisionService'
 import { Collision } from '../constants'
-import type { CollisionService } from '../types'
+import type { CollisionPoint, CollisionService } from '../types'
 
 describe('createCollisionService', () => {
   let service: CollisionService
@@ -556,4 +556,112 @@ describe('createCollisionService', () => {
       ).toBe(Collision.LETHAL)
     })
   })
+
+  describe('identity plane', () => {
+    const at = (x: number, y: number): CollisionPoint => ({
+      x,
+      y,
+      collision: Collision.NONE
+    })
+
+    beforeEach(() => {
+      service.initialize({ width: 10, height: 10, identity: true })
+    })
+
+    it('is off unless requested', () => {
+      const plain = createCollisionService()
+      plain.initialize({ width: 10, height: 10 })
+      plain.addPoint(
+        { x: 1, y: 1, collision: Collision.LETHAL },
+        { kind: 'shot', index: 0 }
+      )
+
+      expect(plain.hasIdentity()).toBe(false)
+      expect(plain.getOwner(at(1, 1))).toBeNull()
+      expect(plain.checkItemOwner([at(1, 1)])).toBeNull()
+      expect(service.hasIdentity()).toBe(true)
+    })
+
+    it('records the owner of each point, item and line', () => {
+      service.addPoint(
+        { x: 1, y: 1, collision: Collision.LETHAL },
+        { kind: 'shot', index: 3 }
+      )
+      service.addItem(
+        [
+          { x: 4, y: 4, collision: Collision.LETHAL },
+          { x: 5, y: 4, collision: Collision.LETHAL }
+        ],
+        { kind: 'bunker', index: 7 }
+      )
+      service.addLine({
+        startPoint: { x: 0, y: 8 },
+        endPoint: { x: 3, y: 8 },
+        collision: Collision.BOUNCE,
+        width: 1,
+        owner: { kind: 'wall', id: 'w12' }
+      })
+      service.addPoint({ x: 9, y: 9, collision: Collision.LETHAL })
+
+      expect(service.getOwner(at(1, 1))).toEqual({ kind: 'shot', index: 3 })
+      expect(service.getOwner(at(5, 4))).toEqual({ kind: 'bunker', index: 7 })
+      expect(service.getOwner(at(2, 8))).toEqual({ kind: 'wall', id: 'w12' })
+      expect(service.getOwner(at(9, 9))).toBeNull()
+      expect(service.getOwner(at(0, 0))).toBeNull()
+      expect(service.getOwner(at(-1, 20))).toBeNull()
+    })
+
+    it('keeps the owner of the higher priority collision', () => {
+      service.addPoint(
+        { x: 2, y: 2, collision: Collision.LETHAL },
+        { kind: 'bunker', index: 0 }
+      )
+      service.addPoint(
+        { x: 2, y: 2, collision: Collision.BOUNCE },
+        { kind: 'wall', id: 'bounce' }
+      )
+      expect(service.getOwner(at(2, 2))).toEqual({ kind: 'bunker', index: 0 })
+
+      service.addPoint(
+        { x: 2, y: 2, collision: Collision.LETHAL },
+        { kind: 'shot', index: 1 }
+      )
+      expect(service.getOwner(at(2, 2))).toEqual({ kind: 'shot', index: 1 })
+    })
+
+    it('clears owners on reset', () => {
+      service.addPoint(
+        { x: 3, y: 3, collision: Collision.LETHAL },
+        { kind: 'shot', index: 0 }
+      )
+      service.reset()
+
+      expect(service.getOwner(at(3, 3))).toBeNull()
+    })
+
+    it('attributes checkItem to the pixel that decides it', () => {
+      service.addPoint(
+        { x: 1, y: 1, collision: Collision.BOUNCE },
+        { kind: 'wall', id: 'bounce' }
+      )
+      service.addPoint(
+        { x: 6, y: 6, collision: Collision.LETHAL },
+        { kind: 'bunker', index: 2 }
+      )
+      service.addPoint(
+        { x: 7, y: 7, collision: Collision.LETHAL },
+        { kind: 'shot', index: 5 }
+      )
+
+      expect(service.checkItemOwner([at(1, 1), at(6, 6), at(7, 7)])).toEqual({
+        kind: 'bunker',
+        index: 2
+      })
+      expect(service.checkItemOwner([at(0, 0), at(1, 1)])).toEqual({
+        kind: 'wall',
+        id: 'bounce'
+      })
+      expect(service.checkItemOwner([at(0, 0)])).toBeNull()
+    })
+  })
 })
@@ -3,12 +3,24 @@ import type {
   CollisionItem,
   CollisionLine,
   CollisionMap,
+  CollisionOwner,
   CollisionPoint,
   CollisionService,
   CollisionType
 } from './types'
 import { deepFreeze, copy2dArray } from './utils'
 
+/**
+ * Owners of the map's pixels, column-major like the map. Each add call
+ * registers its owner once per frame; the plane holds its 1-based handle,
+ * with 0 for a pixel no owned write has won.
+ */
+type IdentityPlane = {
+  plane: Uint16Array
+  height: number
+  owners: CollisionOwner[]
+}
+
 /**
  * Initialize a collision map with lines, items, and points.
  *
@@ -20,8 +32,17 @@ import { deepFreeze, copy2dArray } from './utils'
 export function createCollisionService(): CollisionService {
   let baseMap: CollisionMap
   let instanceMap: CollisionMap
+  let identity: IdentityPlane | null = null
+
+  const register = (owner: CollisionOwner | undefined): number =>
+    identity && owner ? identity.owners.push(owner) : 0
+
   return {
-    initialize: function (args: { width: number; height: number }): void {
+    initialize: function (args: {
+      width: number
+      height: number
+      identity?: boolean
+    }): void {
       const { width, height } = args
       baseMap = Array.from({ length: width }, () =>
         Array.from({ length: height }, () => Collision.NONE)
@@ -30,22 +51,32 @@ export function createCollisionService(): CollisionService {
       baseMap = deepFreeze(baseMap)
 
       instanceMap = copy2dArray(baseMap)
+
+      identity = args.identity
+        ? { plane: new Uint16Array(width * height), height, owners: [] }
+        : null
     },
     reset: function (): void {
       // this is SIGNIFICANTLY faster than initializing the array
       // which is important since we reset every frame
       instanceMap = copy2dArray(baseMap)
+
+      if (identity) {
+        identity.plane.fill(0)
+        identity.owners.length = 0
+      }
     },
-    addPoint: function (point: CollisionPoint): void {
-      addPoint(point, instanceMap)
+    addPoint: function (point: CollisionPoint, owner?: CollisionOwner): void {
+      addPoint(point, instanceMap, identity, register(owner))
     },
-    addItem: function (item: CollisionItem): void {
+    addItem: function (item: CollisionItem, owner?: CollisionOwner): void {
+      const handle = register(owner)
       item.forEach(point => {
-        addPoint(point, instanceMap)
+        addPoint(point, instanceMap, identity, handle)
       })
     },
     addLine: function (line: CollisionLine): void {
-      addLine(line, instanceMap)
+      addLine(line, instanceMap, identity, register(line.owner))
     },
     checkPoint: function (point: CollisionPoint): CollisionType {
       return checkPoint(point, instanceMap)
@@ -65,11 +96,41 @@ export function createCollisionService(): CollisionService {
     },
     getMap: function (): CollisionMap {
       return instanceMap
+    },
+    hasIdentity: function (): boolean {
+      return identity !== null
+    },
+    getOwner: function (point: CollisionPoint): CollisionOwner | null {
+      return getOwner(point, instanceMap, identity)
+    },
+    checkItemOwner: function (item: CollisionItem): CollisionOwner | null {
+      if (!identity) {
+        return null
+      }
+      // the first pixel of the deciding priority, as checkItem() finds it
+      let priorityCollision: CollisionType = Collision.NONE
+      let priorityOwner: CollisionOwner | null = null
+      for (const point of item) {
+        const collision = checkPoint(point, instanceMap)
+        if (collision > priorityCollision) {
+          priorityCollision = collision
+          priorityOwner = getOwner(point, instanceMap, identity)
+          if (priorityCollision === Collision.LETHAL) {
+            break
+          }
+        }
+      }
+      return priorityOwner
     }
   }
 }
 
-function addPoint(point: CollisionPoint, originalMap: CollisionMap): void {
+function addPoint(
+  point: CollisionPoint,
+  originalMap: CollisionMap,
+  identity: IdentityPlane | null,
+  handle: number
+): void {
   // ignore out of bounds setting (allows sending items that are
   // partially out of bounds)
   if (originalMap[point.x]?.[point.y] === undefined) {
@@ -80,9 +141,19 @@ function addPoint(point: CollisionPoint, originalMap: CollisionMap): void {
     return
   }
   originalMap[point.x]![point.y] = point.collision
+
+  // the owner follows the collision value: the last write that keeps it
+  if (identity) {
+    identity.plane[point.x * identity.height + point.y] = handle
+  }
 }
 
-function addLine(line: CollisionLine, originalMap: CollisionMap): void {
+function addLine(
+  line: CollisionLine,
+  originalMap: CollisionMap,
+  identity: IdentityPlane | null,
+  handle: number
+): void {
   const { startPoint, endPoint, collision, width } = line
 
   // Calculate raw deltas BEFORE abs() for slope detection
@@ -103,7 +174,7 @@ function addLine(line: CollisionLine, originalMap: CollisionMap): void {
   while (true) {
     // Add points for line width (perpendicular to line direction)
     if (width === 1) {
-      addPoint({ x, y, collision }, originalMap)
+      addPoint({ x, y, collision }, originalMap, identity, handle)
     } else {
       // For wider lines, add points perpendicular to the line direction
       // Determine perpendicular direction based on line slope
@@ -119,16 +190,21 @@ function addLine(line: CollisionLine, originalMap: CollisionMap): void {
       for (let w = 0; w < width; w++) {
         if (isVertical) {
           // Line is more vertical, expand horizontally
-          addPoint({ x: x + w, y, collision }, originalMap)
+          addPoint({ x: x + w, y, collision }, originalMap, identity, handle)
         } else if (isHorizontal) {
           // Line is perfectly horizontal, no adjustment needed
-          addPoint({ x, y: y + w, collision }, originalMap)
+          addPoint({ x, y: y + w, collision }, originalMap, identity, handle)
         } else if (isNearDiagonal && hasPositiveSlope) {
           // Line is near-diagonal NW/SE (negative slope), shift down by 1 pixel
-          addPoint({ x, y: y + w, collision }, originalMap)
+          addPoint({ x, y: y + w, collision }, originalMap, identity, handle)
         } else {
           // Other angled lines: shift up by 1 pixel
-          addPoint({ x, y: y + w - 1, collision }, originalMap)
+          addPoint(
+            { x, y: y + w - 1, collision },
+            originalMap,
+            identity,
+            handle
+          )
         }
       }
     }
@@ -162,3 +238,15 @@ function checkPoint(
   }
   return result
 }
+
+function getOwner(
+  point: CollisionPoint,
+  originalMap: CollisionMap,
+  identity: IdentityPlane | null
+): CollisionOwner | null {
+  if (!identity || originalMap[point.x]?.[point.y] === undefined) {
+    return null
+  }
+  const handle = identity.plane[point.x * identity.height + point.y]!
+  return handle === 0 ? null : identity.owners[handle - 1]!
+}
@@ -1,5 +1,5 @@
 import type { MonochromeBitmap } from '@/lib/bitmap'
-import type { CollisionItem, CollisionType } from './types'
+import type { CollisionItem, CollisionOwner, CollisionType } from './types'
 
 /**
  * Converts all the black pixels in the monochrome bitmap to
@@ -29,3 +29,19 @@ export function bitmapToCollisionItem(
 
   return points
 }
+
+/**
+ * Whether two owners are the same wall, bunker or shot. A wall or bunker
+ * drawn again at its wrapped position registers a second, equal owner
+ */
+export function sameCollisionOwner(
+  a: CollisionOwner | null,
+  b: CollisionOwner | null
+): boolean {
+  if (!a || !b || a.kind !== b.kind) {
+    return false
+  }
+  return a.kind === 'wall'
+    ? a.id === (b as typeof a).id
+    : a.index === (b as typeof a).index
+}
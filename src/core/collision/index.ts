@@ -5,8 +5,9 @@ export type {
   CollisionPoint,
   CollisionLine,
   CollisionItem,
+  CollisionOwner,
   CollisionService
 } from './types'
 
-export { bitmapToCollisionItem } from './helpers'
+export { bitmapToCollisionItem, sameCollisionOwner } from './helpers'
 export { createCollisionService } from './createCollisionService'
@@ -12,26 +12,40 @@ export type CollisionPoint = { x: number; y: number; collision: CollisionType }
 /** an item (collection of points) that can collide */
 export type CollisionItem = CollisionPoint[]
 
+/** the wall, bunker or shot a pixel of the map belongs to */
+export type CollisionOwner =
+  | { kind: 'wall'; id: string }
+  | { kind: 'bunker'; index: number }
+  | { kind: 'shot'; index: number }
+
 /** a line that can collided */
 export type CollisionLine = {
   startPoint: CollisionPoint
   endPoint: CollisionPoint
   collision: CollisionType
   width: number
+  owner?: CollisionOwner
 }
 
 export type CollisionService = {
-  /** initialize the collision map */
-  initialize: (args: { width: number; height: number }) => void
+  /**
+   * initialize the collision map; with identity set, an identity plane
+   * alongside it records the owner of each pixel
+   */
+  initialize: (args: {
+    width: number
+    height: number
+    identity?: boolean
+  }) => void
 
   /** reset the collision map to the initialized state */
   reset: () => void
 
   /** add a point to the map with a given collision value **/
-  addPoint: (point: CollisionPoint) => void
+  addPoint: (point: CollisionPoint, owner?: CollisionOwner) => void
 
   /** add an item to the map with a given collision value **/
-  addItem: (item: CollisionItem) => void
+  addItem: (item: CollisionItem, owner?: CollisionOwner) => void
 
   /** add a line to the map with a given collision value **/
   addLine: (line: CollisionLine) => void
@@ -50,4 +64,20 @@ export type CollisionService = {
 
   /** return the underlying collision map as a grid */
   getMap: () => CollisionMap
+
+  /** whether the map was initialized with an identity plane */
+  hasIdentity: () => boolean
+
+  /**
+   * returns the owner of the pixel at a point, or null when it has none,
+   * is out of bounds or there is no identity plane
+   */
+  getOwner: (point: CollisionPoint) => CollisionOwner | null
+
+  /**
+   * returns the owner of the pixel that decides checkItem(), so a LETHAL
+   * hit is attributed to what was hit without a second pass over the
+   * walls, bunkers and shots
+   */
+  checkItemOwner: (item: CollisionItem) => CollisionOwner | null
 }
@@ -5,7 +5,7 @@
  * from the local file system. Used by validation and other CLI tools.
  */
 
-import { parsePlanet } from '@core/planet'
+import { parsePlanet, wallsInStartxOrder } from '@core/planet'
 import type { PlanetState } from '@core/planet'
 import { Galaxy } from './methods'
 import type { GalaxyHeader, PlanetsBuffer } from './types'
@@ -89,24 +89,13 @@ export function createGalaxyServiceNode(initialPath: string): GalaxyService {
         levelNum
       )
 
-      // Check if walls are sorted by startx (required for optimizations)
-      const walls = planet.lines
-      let isSorted = true
-      for (let i = 1; i < walls.length; i++) {
-        const current = walls[i]
-        const previous = walls[i - 1]
-        if (current && previous && current.startx < previous.startx) {
-          isSorted = false
-          break
-        }
-      }
-
-      planet.wallsSorted = isSorted
+      // Walls stay in file order; scans need to know if that is sorted
+      planet.wallsSorted = wallsInStartxOrder(planet.lines)
 
-      if (!isSorted) {
+      if (!planet.wallsSorted) {
         console.warn(
           `Planet ${levelNum}: Walls are NOT sorted by startx. ` +
-            `This may cause collision detection and junction finding issues.`
+            `Terrain scans fall back to walking their whole lists.`
         )
       }
 
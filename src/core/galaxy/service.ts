@@ -1,12 +1,13 @@
 /**
  * @fileoverview Galaxy service for managing galaxy data outside of Redux
  *
- * This service provides a centralized way to load and cache galaxy data
+ * This service provides a centralized way to load and cache galaxy data.
+ * Galaxy files are split and every planet parsed in the codec worker, so
+ * getPlanet() normally returns an already parsed planet.
  */
 
-import { parsePlanet } from '@core/planet'
 import type { PlanetState } from '@core/planet'
-import { Galaxy } from './methods'
+import { getCodecClient, parseGalaxyPlanet } from '@core/codec'
 import type { GalaxyHeader, PlanetsBuffer } from './types'
 
 /**
@@ -54,6 +55,20 @@ type GalaxyStorage = {
   parsedPlanetsCache: Map<number, PlanetState>
 }
 
+/**
+ * Planet cache keyed by planet number, skipping planets that failed to
+ * parse so getPlanet() retries them and reports the error
+ */
+const cachePlanets = (
+  planets: (PlanetState | null)[]
+): Map<number, PlanetState> => {
+  const cache = new Map<number, PlanetState>()
+  planets.forEach((planet, i) => {
+    if (planet) cache.set(i + 1, planet)
+  })
+  return cache
+}
+
 /**
  * Creates a galaxy service instance with an initially loaded galaxy
  * @param initialPath - Path to the initial galaxy data file
@@ -68,15 +83,15 @@ export async function createGalaxyService(
     throw new Error(`Failed to load initial galaxy file from ${initialPath}`)
   }
 
-  const arrayBuffer = await response.arrayBuffer()
-  const { headerBuffer, planetsBuffer } = Galaxy.splitBuffer(arrayBuffer)
-  const header = Galaxy.parseHeader(headerBuffer)
+  const { header, planetsBuffer, planets } = await getCodecClient().openGalaxy(
+    await response.arrayBuffer()
+  )
 
   // Private storage - not accessible outside the service
   const storage: GalaxyStorage = {
     header,
     planetsBuffer,
-    parsedPlanetsCache: new Map()
+    parsedPlanetsCache: cachePlanets(planets)
   }
 
   console.log(`Initial galaxy loaded: ${header.planets} planets`)
@@ -89,14 +104,13 @@ export async function createGalaxyService(
         throw new Error(`Failed to load galaxy file from ${path}`)
       }
 
-      const arrayBuffer = await response.arrayBuffer()
-      const { headerBuffer, planetsBuffer } = Galaxy.splitBuffer(arrayBuffer)
-      const header = Galaxy.parseHeader(headerBuffer)
+      const { header, planetsBuffer, planets } =
+        await getCodecClient().openGalaxy(await response.arrayBuffer())
 
       // Atomic swap - only update storage after successful load
       storage.header = header
       storage.planetsBuffer = planetsBuffer
-      storage.parsedPlanetsCache.clear() // Clear any previously parsed planets
+      storage.parsedPlanetsCache = cachePlanets(planets)
 
       console.log(`Galaxy loaded: ${header.planets} planets`)
 
@@ -118,33 +132,12 @@ export async function createGalaxyService(
       }
 
       // Parse and cache the planet
-      const planet = parsePlanet(
+      const planet = parseGalaxyPlanet(
         storage.planetsBuffer,
         storage.header.indexes,
         levelNum
       )
 
-      // Check if walls are sorted by startx (required for optimizations)
-      const walls = planet.lines
-      let isSorted = true
-      for (let i = 1; i < walls.length; i++) {
-        const current = walls[i]
-        const previous = walls[i - 1]
-        if (current && previous && current.startx < previous.startx) {
-          isSorted = false
-          break
-        }
-      }
-
-      planet.wallsSorted = isSorted
-
-      if (!isSorted) {
-        console.warn(
-          `Planet ${levelNum}: Walls are NOT sorted by startx. ` +
-            `This may cause collision detection and junction finding issues.`
-        )
-      }
-
       storage.parsedPlanetsCache.set(levelNum, planet)
       return planet
     },
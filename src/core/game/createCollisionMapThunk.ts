@@ -4,9 +4,10 @@ import {
   Collision,
   type CollisionItem
 } from '@/core/collision'
-import { xbcenter, ybcenter, type Bunker } from '@/core/planet'
+import { xbcenter, ybcenter } from '@/core/planet'
 import { LINE_KIND, type LineRec } from '@/core/shared'
 import { SCRWTH } from '@/core/screen'
+import { getVisibleSet } from '@/core/visibility'
 
 export const createCollisionMap = createSyncThunk<void>(
   'game/createCollisionMap',
@@ -18,6 +19,15 @@ export const createCollisionMap = createSyncThunk<void>(
       state.screen.screenx > state.planet.worldwidth - SCRWTH
     const worldwrap = state.planet.worldwrap
 
+    // Owners are only kept when the map has an identity plane
+    const identity = extra.collisionService.hasIdentity()
+
+    // Only walls and bunkers near the view can reach the map
+    const visible = getVisibleSet(state)
+    const bunkers = visible.bunkers.filter(
+      index => state.planet.bunkers[index]!.alive
+    )
+
     // Helper to add lines with optional wrapping
     const addLineCollision = (line: LineRec, screenOffsetX: number): void => {
       const startX = line.startx - screenOffsetX
@@ -34,27 +44,26 @@ export const createCollisionMap = createSyncThunk<void>(
             : line.kind === LINE_KIND.BOUNCE
               ? Collision.BOUNCE
               : Collision.NONE,
-        width: 2
+        width: 2,
+        owner: identity ? { kind: 'wall', id: line.id } : undefined
       })
     }
 
     // Add lines at normal position
-    state.planet.lines.forEach(line =>
+    visible.collisionWalls.forEach(line =>
       addLineCollision(line, state.screen.screenx)
     )
 
     // Add lines at wrapped position
     if (on_right_side && worldwrap) {
-      state.planet.lines.forEach(line =>
+      visible.collisionWalls.forEach(line =>
         addLineCollision(line, state.screen.screenx - state.planet.worldwidth)
       )
     }
 
     // Helper to add bunker collision with optional wrapping
-    const addBunkerCollision = (
-      bunker: Bunker,
-      screenOffsetX: number
-    ): void => {
+    const addBunkerCollision = (index: number, screenOffsetX: number): void => {
+      const bunker = state.planet.bunkers[index]!
       const sprite = extra.spriteService.getBunkerSprite(
         bunker.kind,
         bunker.rot,
@@ -68,33 +77,37 @@ export const createCollisionMap = createSyncThunk<void>(
         bunker.x - xcenter - screenOffsetX,
         bunker.y - ycenter - state.screen.screeny
       )
-      extra.collisionService.addItem(item)
+      extra.collisionService.addItem(
+        item,
+        identity ? { kind: 'bunker', index } : undefined
+      )
     }
 
     // Add bunkers at normal position
-    state.planet.bunkers
-      .filter(bunker => bunker.alive)
-      .forEach(bunker => addBunkerCollision(bunker, state.screen.screenx))
+    bunkers.forEach(index => addBunkerCollision(index, state.screen.screenx))
 
     // Add bunkers at wrapped position
     if (on_right_side && worldwrap) {
-      state.planet.bunkers
-        .filter(bunker => bunker.alive)
-        .forEach(bunker =>
-          addBunkerCollision(
-            bunker,
-            state.screen.screenx - state.planet.worldwidth
-          )
+      bunkers.forEach(index =>
+        addBunkerCollision(
+          index,
+          state.screen.screenx - state.planet.worldwidth
         )
+      )
     }
 
     // only add bunker shots to collision map if ship is not shielding
     if (!state.ship.shielding) {
+      // Shots that can still hit: flying, or just died without a strafe
+      const shots = state.shots.bunkshots.flatMap((shot, index) =>
+        shot.lifecount > 0 || (shot.justDied === true && shot.strafedir < 0)
+          ? [index]
+          : []
+      )
+
       // Helper to add shot collision with optional wrapping
-      const addShotCollision = (
-        shot: (typeof state.shots.bunkshots)[0],
-        screenOffsetX: number
-      ): void => {
+      const addShotCollision = (index: number, screenOffsetX: number): void => {
+        const shot = state.shots.bunkshots[index]!
         const shotX = shot.x - screenOffsetX
         const shotY = shot.y - state.screen.screeny
         const shotItem: CollisionItem = [
@@ -103,31 +116,23 @@ export const createCollisionMap = createSyncThunk<void>(
           { x: shotX, y: shotY + 1, collision: Collision.LETHAL },
           { x: shotX + 1, y: shotY + 1, collision: Collision.LETHAL }
         ]
-        extra.collisionService.addItem(shotItem)
+        extra.collisionService.addItem(
+          shotItem,
+          identity ? { kind: 'shot', index } : undefined
+        )
       }
 
       // Add bunker shots at normal position
-      state.shots.bunkshots
-        .filter(
-          shot =>
-            shot.lifecount > 0 || (shot.justDied === true && shot.strafedir < 0)
-        )
-        .forEach(shot => addShotCollision(shot, state.screen.screenx))
+      shots.forEach(index => addShotCollision(index, state.screen.screenx))
 
       // Add bunker shots at wrapped position
       if (on_right_side && worldwrap) {
-        state.shots.bunkshots
-          .filter(
-            shot =>
-              shot.lifecount > 0 ||
-              (shot.justDied === true && shot.strafedir < 0)
-          )
-          .forEach(shot =>
-            addShotCollision(
-              shot,
-              state.screen.screenx - state.planet.worldwidth
-            )
+        shots.forEach(index =>
+          addShotCollision(
+            index,
+            state.screen.screenx - state.planet.worldwidth
           )
+        )
       }
     }
   }
@@ -0,0 +1,56 @@
+/**
+ * @fileoverview Reducer for the game logic slices alone
+ *
+ * The headless store used for validation and the live game's simulation
+ * store are both built on this reducer, so updateGameState runs on the
+ * same state shape in both. The app store keeps a mirror of these slices
+ * for the UI, brought in line once per tick with syncGameState.
+ */
+
+import {
+  combineSlices,
+  createAction,
+  type Reducer,
+  type UnknownAction
+} from '@reduxjs/toolkit'
+import { shipSlice } from '@core/ship'
+import { shotsSlice } from '@core/shots'
+import { planetSlice } from '@core/planet'
+import { screenSlice } from '@core/screen'
+import { statusSlice } from '@core/status'
+import { explosionsSlice } from '@core/explosions'
+import { wallsSlice } from '@core/walls'
+import { transitionSlice } from '@core/transition'
+import { gameSlice } from './gameSlice'
+import type { GameRootState } from './types'
+
+export const gameReducer = combineSlices(
+  gameSlice,
+  shipSlice,
+  shotsSlice,
+  planetSlice,
+  screenSlice,
+  statusSlice,
+  explosionsSlice,
+  wallsSlice,
+  transitionSlice
+)
+
+/**
+ * Replace game logic slices wholesale with the ones in the payload
+ */
+export const syncGameState = createAction<Partial<GameRootState>>(
+  'game/syncGameState'
+)
+
+/**
+ * Wrap a reducer holding the game logic slices so it handles syncGameState
+ */
+export const withGameSync =
+  <S extends GameRootState, P>(
+    reducer: Reducer<S, UnknownAction, P>
+  ): Reducer<S, UnknownAction, P> =>
+  (state, action) =>
+    state !== undefined && syncGameState.match(action)
+      ? { ...(state as S), ...action.payload }
+      : reducer(state, action)
@@ -24,6 +24,9 @@ export {
   resetKillShipNextFrame
 } from './gameSlice'
 
+// Reducer for the game logic slices
+export { gameReducer, syncGameState, withGameSync } from './gameReducer'
+
 // State update types and functions
 export type {
   TransitionCallbacks,
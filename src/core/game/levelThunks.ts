@@ -25,26 +25,32 @@ const BUNKROTKINDS = 2 // From GW.h - bunker kinds that rotate
  * Load a specific level (planet) from the galaxy data
  *
  * @param levelNum - The level number to load
- * @param overrideSeed - Optional seed to use instead of Date.now() (for replay/validation)
+ * @param overrideSeed - Optional seed to use instead of a new one (for replay/validation)
  */
 export const loadLevel =
   (
     levelNum: number,
     overrideSeed?: number
   ): ThunkAction<void, GameRootState, GameLogicServices, Action> =>
-  (dispatch, _getState, { galaxyService, randomService, recordingService }) => {
+  (
+    dispatch,
+    _getState,
+    { galaxyService, randomService, recordingService, levelSeedSource }
+  ) => {
     // Set random seed at the start of each level
     // Priority:
     // 1. overrideSeed (explicit parameter)
     // 2. replaySeed (from recording during replay)
-    // 3. Date.now() (for new games)
+    // 3. levelSeedSource, or Date.now() (for new games)
     const replaySeed = recordingService.getLevelSeed(levelNum)
     const seed =
       overrideSeed !== undefined
         ? overrideSeed
         : replaySeed !== null
           ? replaySeed
-          : Date.now()
+          : levelSeedSource
+            ? levelSeedSource(levelNum)
+            : Date.now()
     randomService.setSeed(seed)
 
     // Record level seed if recording is active (only record if we generated the seed)
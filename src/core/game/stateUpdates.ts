@@ -326,7 +326,8 @@ export const updateGameState = (context: StateUpdateContext): void => {
           store,
           wallData: {
             kindPointers: state.walls.kindPointers,
-            organizedWalls: state.walls.organizedWalls
+            organizedWalls: state.walls.organizedWalls,
+            kindIndex: state.walls.kindIndex
           },
           worldwidth: state.planet.worldwidth,
           collision
@@ -29,6 +29,11 @@ export type GameLogicServices = {
   recordingService: RecordingService
   spriteService: SpriteService
   collisionService: CollisionService
+  /**
+   * Seed for a level that is neither replayed nor given one explicitly;
+   * Date.now() when not set. Headless runs use this to be repeatable.
+   */
+  levelSeedSource?: (level: number) => number
 }
 
 /**
@@ -0,0 +1,25 @@
+import { describe, it, expect } from 'vitest'
+import { createWall, NEW_TYPE } from '@core/walls'
+import { wallsInStartxOrder } from '../wallOrder'
+
+describe('wallsInStartxOrder', () => {
+  it('accepts walls that never step left, including equal startx', () => {
+    expect(
+      wallsInStartxOrder([
+        createWall(10, 0, 20, NEW_TYPE.S, 0, 0),
+        createWall(10, 40, 20, NEW_TYPE.S, 0, 1),
+        createWall(30, 0, 20, NEW_TYPE.S, 0, 2)
+      ])
+    ).toBe(true)
+    expect(wallsInStartxOrder([])).toBe(true)
+  })
+
+  it('rejects walls out of order', () => {
+    expect(
+      wallsInStartxOrder([
+        createWall(50, 0, 20, NEW_TYPE.S, 0, 0),
+        createWall(10, 0, 20, NEW_TYPE.S, 0, 1)
+      ])
+    ).toBe(false)
+  })
+})
@@ -23,4 +23,5 @@ export const { loadPlanet } = _planetSlice.actions
 
 // Planet functions
 export { parsePlanet } from './parsePlanet'
+export { wallsInStartxOrder } from './wallOrder'
 export { legalAngle } from './legalAngle'
@@ -1,3 +1,9 @@
+// Bunker rotation to degrees (16 directions = 22.5 degrees each)
+// From Play.c:896 - angles360 array
+const angles360 = [
+  0, 22, 45, 67, 90, 112, 135, 157, 180, 202, 225, 247, 270, 292, 315, 337
+] as const
+
 /**
  * Check if a point is within the field of view of a directional bunker
  * Based on orig/Sources/Play.c:898-924
@@ -26,12 +32,6 @@ export function legalAngle(
   let angle = Math.atan2(dx, -dy) * (180 / Math.PI)
   if (angle < 0) angle += 360
 
-  // Bunker rotation to degrees (16 directions = 22.5 degrees each)
-  // From Play.c:896 - angles360 array
-  const angles360 = [
-    0, 22, 45, 67, 90, 112, 135, 157, 180, 202, 225, 247, 270, 292, 315, 337
-  ]
-
   // Get the bunker's facing angle
   // The (baserot + 12) & 15 rotates by 270 degrees to get the "back" of the bunker
   // Then we check if the target is within 180 degrees of that
@@ -4,7 +4,7 @@ import { BunkerKind } from './types'
 import { BUNKROTKINDS, FUELFRAMES } from '@core/figs'
 import { PLANET } from './constants'
 import { aimBunk } from '@core/shots'
-import { rint } from '@core/shared'
+import { createRandomStream } from '@core/shared'
 
 // Constants from GW.h
 const BUNKFRAMES = 8
@@ -155,9 +155,12 @@ export const planetSlice = createSlice({
      *
      * ROBUSTNESS: Also sorts bunkers by X position to optimize collision detection
      * Original assumes bunkers are pre-sorted from editor (Play.c:767-769)
-     * NOTE: Uses Math.random() - deprecated for deterministic gameplay
+     * Starting rotations are rolled from a stream seeded by the payload;
+     * games use initializeBunkersWithValues with the game's RandomService
      */
-    initializeBunkers: state => {
+    initializeBunkers: (state, action: PayloadAction<{ seed: number }>) => {
+      const random = createRandomStream(action.payload.seed)
+
       // First, sort bunkers by X position for collision optimization
       // This ensures the optimization in Play.c:767-769 works correctly
       // IMPORTANT: Only sort active bunkers (those with rot >= 0)
@@ -184,13 +187,11 @@ export const planetSlice = createSlice({
         bunk.alive = true
 
         // For animated bunkers, set random initial rotation and counter
-        // NOTE: Uses Math.random() - deprecated for deterministic gameplay
-        // Use initializeBunkersWithValues instead for deterministic behavior
         if (bunk.kind >= BUNKROTKINDS) {
           // Random rotation (0 to BUNKFRAMES-1)
-          bunk.rot = Math.floor(Math.random() * BUNKFRAMES)
+          bunk.rot = random.rnumber(BUNKFRAMES)
           // Random rotation counter (0 to BUNKFCYCLES-1)
-          bunk.rotcount = Math.floor(Math.random() * BUNKFCYCLES)
+          bunk.rotcount = random.rnumber(BUNKFCYCLES)
         }
 
         // Special case: DIFF bunkers with rotation 2 are harder to kill
@@ -266,14 +267,17 @@ export const planetSlice = createSlice({
     /**
      * Update fuel cell animations
      * Based on the for loop in do_fuels() at Terrain.c:274-286
-     * NOTE: Uses rint() (Math.random) - deprecated for deterministic gameplay
+     * The flash is rolled from a stream seeded by the payload; games use
+     * updateFuelAnimationsWithRandom with the game's RandomService
      */
-    updateFuelAnimations: state => {
+    updateFuelAnimations: (state, action: PayloadAction<{ seed: number }>) => {
       // Check if fuels array exists and has elements
       if (!state.fuels || state.fuels.length === 0) return
 
+      const random = createRandomStream(action.payload.seed)
+
       // Random fuel to flash this frame (Terrain.c:272)
-      const flash = rint(state.fuels.length)
+      const flash = random.rnumber(state.fuels.length)
 
       // Update animations for all fuel cells (Terrain.c:274-286)
       for (let f = 0; f < state.fuels.length; f++) {
@@ -289,7 +293,7 @@ export const planetSlice = createSlice({
         if (fp.alive) {
           if (f === flash) {
             // Flash effect - set to one of last two frames (Terrain.c:277-280)
-            fp.currentfig = FUELFRAMES - 2 + rint(2)
+            fp.currentfig = FUELFRAMES - 2 + random.rnumber(2)
             fp.figcount = 1
           } else if (fp.figcount <= 0) {
             // Advance to next animation frame (Terrain.c:281-286)
@@ -333,19 +337,21 @@ export const planetSlice = createSlice({
       }
     },
 
-    initializeFuels: state => {
-      // Legacy action that uses Math.random() - deprecated for deterministic gameplay
-      // Use initializeFuelsWithValues or the initializeFuels thunk instead
+    initializeFuels: (state, action: PayloadAction<{ seed: number }>) => {
+      // Rolls from a stream seeded by the payload; games use
+      // initializeFuelsWithValues with the game's RandomService
       if (!state.fuels || state.fuels.length === 0) return
 
+      const random = createRandomStream(action.payload.seed)
+
       for (let i = 0; i < state.fuels.length; i++) {
         const fp = state.fuels[i]
         if (!fp) continue
         if (fp.x >= 10000) break
 
         fp.alive = true
-        fp.currentfig = rint(FUELFRAMES)
-        fp.figcount = rint(FUELFCYCLES)
+        fp.currentfig = random.rnumber(FUELFRAMES)
+        fp.figcount = random.rnumber(FUELFCYCLES)
       }
     },
 
@@ -17,7 +17,7 @@ export type PlanetState = {
   fuels: Fuel[]
   craters: Crater[]
   gravityPoints: GravityPoint[] // Array of active generator gravity points
-  wallsSorted: boolean // Debug flag: true if walls were sorted by startx after loading
+  wallsSorted: boolean // Debug flag: true if the file has walls in startx order
 }
 
 export type Bunker = {
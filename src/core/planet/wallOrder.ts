@@ -0,0 +1,23 @@
+/**
+ * @fileoverview Checks whether a planet's walls are in startx order
+ *
+ * The original editor kept walls sorted by startx (QuickEdit.c:850-854)
+ * and the terrain loops rely on it, but planet files from other editors
+ * are not guaranteed to be in order. Walls are kept in file order either
+ * way, as the kind lists and junctions are built from it, and the
+ * terrain scans walk lists that are out of order in full.
+ */
+
+import type { LineRec } from '../shared/types/line'
+
+/**
+ * Whether every wall starts at or right of the one before it
+ */
+export const wallsInStartxOrder = (lines: readonly LineRec[]): boolean => {
+  for (let i = 1; i < lines.length; i++) {
+    if (lines[i]!.startx < lines[i - 1]!.startx) {
+      return false
+    }
+  }
+  return true
+}
@@ -10,7 +10,7 @@ import type {
 } from './types'
 import { hashState } from '@core/validation'
 
-const SNAPSHOT_INTERVAL = 100 // Capture every 100 frames
+export const SNAPSHOT_INTERVAL = 100 // Capture every 100 frames
 
 type RecordingMode = 'idle' | 'recording' | 'replaying'
 
@@ -36,6 +36,8 @@ type RecordingService = {
   stopReplay: () => void
   getReplayControls: (frameCount: number) => ControlMatrix | null
   getLevelSeed: (level: number) => number | null
+  /** Add seeds that arrive after the replay started (streamed recordings) */
+  addReplayLevelSeeds: (seeds: readonly LevelSeed[]) => void
 
   // Current mode
   getMode: () => RecordingMode
@@ -155,7 +157,8 @@ const createRecordingService = (): RecordingService => {
       }
       mode = 'replaying'
       replayInputs = recording.inputs
-      replayRecording = recording
+      // Seeds can be added later, so the caller's list is left alone
+      replayRecording = { ...recording, levelSeeds: [...recording.levelSeeds] }
     },
 
     stopReplay: (): void => {
@@ -191,6 +194,11 @@ const createRecordingService = (): RecordingService => {
       return levelSeed ? levelSeed.seed : null
     },
 
+    addReplayLevelSeeds: (seeds): void => {
+      if (!replayRecording) return
+      replayRecording.levelSeeds.push(...seeds)
+    },
+
     getMode: (): RecordingMode => mode
   }
 }
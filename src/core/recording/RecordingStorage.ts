@@ -1,6 +1,5 @@
 import type { GameRecording } from './types'
-import { encodeRecordingGzip, decodeRecordingAuto } from './binaryCodec'
-import { compress, decompress } from './gzip.browser'
+import { getCodecClient } from '@core/codec/createCodecClient'
 
 const STORAGE_PREFIX = 'continuum_recording_'
 const STORAGE_INDEX_KEY = 'continuum_recording_index'
@@ -89,10 +88,8 @@ const createRecordingStorage = (): RecordingStorage => {
       }
 
       // Encode to binary with gzip and convert to base64 for storage
-      const binaryData = await encodeRecordingGzip(
-        recordingWithVersion,
-        compress
-      )
+      const binaryData =
+        await getCodecClient().encodeRecording(recordingWithVersion)
       const base64Data = arrayBufferToBase64(binaryData)
 
       localStorage.setItem(STORAGE_PREFIX + id, base64Data)
@@ -125,7 +122,7 @@ const createRecordingStorage = (): RecordingStorage => {
       try {
         // Auto-detect format (gzipped binary, binary, or JSON)
         const binaryData = base64ToArrayBuffer(data)
-        return await decodeRecordingAuto(binaryData, decompress)
+        return await getCodecClient().decodeRecording(binaryData)
       } catch (e) {
         // Fallback: try to parse as legacy JSON format
         try {
@@ -9,7 +9,8 @@ export * from './types'
 export {
   createRecordingService,
   type RecordingService,
-  type RecordingMode
+  type RecordingMode,
+  SNAPSHOT_INTERVAL
 } from './RecordingService'
 export {
   createRecordingStorage,
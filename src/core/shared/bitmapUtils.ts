@@ -3,39 +3,21 @@
  * Originally from src/dev/art/utils.ts
  */
 
-const blackPixel = (bArray: number[]): number[] => {
-  bArray.push(0)
-  bArray.push(0)
-  bArray.push(0)
-  bArray.push(255)
-  return bArray
-}
-
-const whitePixel = (bArray: number[]): number[] => {
-  bArray.push(255)
-  bArray.push(255)
-  bArray.push(255)
-  bArray.push(255)
-  return bArray
-}
-
-const byteToPixels = (byte: number, bArray: number[]): number[] => {
-  for (let x = 7; x >= 0; x--) {
-    let bit = byte >>> x
-    bit &= 1
-    bArray = bit === 1 ? blackPixel(bArray) : whitePixel(bArray)
-  }
-  return bArray
-}
+import { blitToPixels } from '@lib/bitmap'
 
+/**
+ * Expand packed 1-bit pixels (set = black) to RGBA, 8 pixels per byte
+ */
 export const bytesToImageData = (
   bytes: Uint8Array<ArrayBuffer>
 ): Uint8ClampedArray<ArrayBuffer> => {
-  let bArray: number[] = []
-  for (let byte of bytes) {
-    bArray = byteToPixels(byte, bArray)
-  }
-  return new Uint8ClampedArray(bArray)
+  const pixels = new Uint32Array(bytes.length * 8)
+  // The bytes are one long row; callers know where the lines break
+  blitToPixels(
+    { data: bytes, width: pixels.length, height: 1, rowBytes: bytes.length },
+    pixels
+  )
+  return new Uint8ClampedArray(pixels.buffer)
 }
 
 const unpackBytes = (
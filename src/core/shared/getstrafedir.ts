@@ -5,6 +5,7 @@
 
 import { LINE_TYPE, LINE_KIND } from './types/line'
 import type { LineRec } from './types/line'
+import { LINE_SHAPE, type LineConstants } from './lineConstants'
 
 /**
  * Bounce direction lookup table
@@ -81,3 +82,34 @@ export function getstrafedir(line: LineRec, x1: number, y1: number): number {
     return stdirtable[above]![table_index]!
   }
 }
+
+/**
+ * getstrafedir() for wall `i` of a precomputed chain, always equal to
+ * getstrafedir(constants.lines[i], x1, y1)
+ *
+ * @param constants - The chain the wall belongs to
+ * @param i - Index of the wall in the chain
+ * @param x1 - X position to check (shot or unbounce position)
+ * @param y1 - Y position to check (shot or unbounce position)
+ */
+export function getstrafedirFast(
+  constants: LineConstants,
+  i: number,
+  x1: number,
+  y1: number
+): number {
+  const startx = constants.startx[i]!
+  const bounce = constants.kind[i] === LINE_KIND.BOUNCE
+
+  if (constants.shape[i] === LINE_SHAPE.VERTICAL) {
+    return x1 > startx ? 4 : bounce ? 12 : -1
+  }
+
+  const y0 = constants.starty[i]! + ((constants.m2[i]! * (x1 - startx)) >> 1)
+  const above = y1 < y0 ? 1 : 0
+  const table_index = constants.dirIndex[i]!
+  if (table_index < 0 || table_index > 10) {
+    return -1
+  }
+  return (bounce ? bouncedirtable : stdirtable)[above]![table_index]!
+}
@@ -13,10 +13,15 @@ export type { Alignment, AlignmentMode } from './alignment'
 export { getAlignment, setAlignmentMode, getAlignmentMode } from './alignment'
 export { getBackgroundPattern } from './backgroundPattern'
 export { ptToAngle } from './ptToAngle'
-export { rint } from './rint'
 export { containShip } from './containShip'
-export { getstrafedir } from './getstrafedir'
-export { pt2line } from './pt2line'
+export { getstrafedir, getstrafedirFast } from './getstrafedir'
+export { pt2line, pt2lineFast } from './pt2line'
+export {
+  buildLineConstants,
+  getKindLineConstants,
+  LINE_SHAPE,
+  type LineConstants
+} from './lineConstants'
 export {
   bytesToImageData,
   expandTitlePage,
@@ -27,3 +32,8 @@ export {
 
 // Random number generation
 export { createRandomService, type RandomService } from './RandomService'
+export {
+  RandomStream,
+  streamSeed,
+  createRandomStream
+} from './randomStreams'
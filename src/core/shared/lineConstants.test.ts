@@ -0,0 +1,128 @@
+import { describe, it, expect } from 'vitest'
+import { join } from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import { initWalls } from '@core/walls/init'
+import { getstrafedir, getstrafedirFast } from './getstrafedir'
+import {
+  buildLineConstants,
+  getKindLineConstants,
+  type LineConstants
+} from './lineConstants'
+import { pt2line, pt2lineFast } from './pt2line'
+import { LINE_DIR, LINE_KIND, LINE_TYPE, type LineRec } from './types/line'
+
+const galaxyService = createGalaxyServiceNode(
+  join(__dirname, '../../game/public/release_galaxy.bin')
+)
+
+// Every point around a wall out past the 50 pixel cutoff, at a stride
+const expectSameAsLineRec = (
+  constants: LineConstants,
+  stride: number
+): void => {
+  for (let i = 0; i < constants.count; i++) {
+    const line = constants.lines[i]!
+    const top = Math.min(line.starty, line.endy) - 60
+    const bottom = Math.max(line.starty, line.endy) + 60
+    for (let v = top; v <= bottom; v += stride) {
+      for (let h = line.startx - 60; h <= line.endx + 60; h += stride) {
+        const fast = [
+          pt2lineFast(h, v, constants, i),
+          getstrafedirFast(constants, i, h, v)
+        ]
+        const slow = [pt2line({ h, v }, line), getstrafedir(line, h, v)]
+        if (fast[0] !== slow[0] || fast[1] !== slow[1]) {
+          expect({ id: line.id, h, v, fast }).toEqual({
+            id: line.id,
+            h,
+            v,
+            fast: slow
+          })
+        }
+      }
+    }
+  }
+}
+
+describe('pt2lineFast and getstrafedirFast', () => {
+  it('match the LineRec versions for every direction and kind', () => {
+    const lines: LineRec[] = []
+    for (const type of Object.values(LINE_TYPE)) {
+      for (const up_down of Object.values(LINE_DIR)) {
+        for (const kind of [LINE_KIND.NORMAL, LINE_KIND.BOUNCE]) {
+          for (const length of [0, 1, 7, 40]) {
+            const dx = type === LINE_TYPE.N ? 0 : length
+            const dy =
+              type === LINE_TYPE.E ? 0 : (up_down * length * 2) >> type
+            lines.push({
+              id: `line-${lines.length}`,
+              startx: 300,
+              starty: 200,
+              endx: 300 + dx,
+              endy: 200 + (type === LINE_TYPE.N ? length : dy),
+              length,
+              type,
+              up_down,
+              kind,
+              newtype: 1,
+              nextId: null,
+              nextwhId: null
+            } as LineRec)
+          }
+        }
+      }
+    }
+    expectSameAsLineRec(buildLineConstants(lines), 1)
+  })
+
+  it('match the LineRec versions on every wall of the release galaxy', () => {
+    for (let level = 1; level <= galaxyService.getHeader().planets; level++) {
+      const walls = initWalls(galaxyService.getPlanet(level).lines)
+      for (const kind of Object.values(LINE_KIND)) {
+        expectSameAsLineRec(getKindLineConstants(walls, kind), 7)
+      }
+    }
+  })
+})
+
+describe('getKindLineConstants', () => {
+  it('follows the kind index and builds once per set of walls', () => {
+    const walls = initWalls(galaxyService.getPlanet(2).lines)
+    const bounce = getKindLineConstants(walls, LINE_KIND.BOUNCE)
+
+    const ids: string[] = []
+    let id = walls.kindPointers[LINE_KIND.BOUNCE]
+    while (id !== null) {
+      ids.push(id)
+      id = walls.organizedWalls[id]!.nextId
+    }
+    expect(ids.length).toBeGreaterThan(0)
+    expect(bounce.lines.map(line => line.id)).toEqual(
+      walls.kindIndex[LINE_KIND.BOUNCE].ids
+    )
+    // A sorted planet's index is its list
+    expect(bounce.lines.map(line => line.id)).toEqual(ids)
+    expect([...bounce.rank]).toEqual(ids.map((_, i) => i))
+    expect(getKindLineConstants(walls, LINE_KIND.BOUNCE)).toBe(bounce)
+
+    const reloaded = initWalls(galaxyService.getPlanet(2).lines)
+    expect(getKindLineConstants(reloaded, LINE_KIND.BOUNCE)).not.toBe(bounce)
+  })
+
+  it('ranks walls by list position when the list is out of order', () => {
+    const lines = galaxyService
+      .getPlanet(2)
+      .lines.filter(line => line.kind === LINE_KIND.BOUNCE)
+      .reverse()
+    const walls = initWalls(lines)
+    const bounce = getKindLineConstants(walls, LINE_KIND.BOUNCE)
+
+    const startx = bounce.lines.map(line => line.startx)
+    expect(startx).toEqual([...startx].sort((a, b) => a - b))
+    const listOrder = lines.map(line => line.id)
+    expect(bounce.lines.map(line => line.id)).not.toEqual(listOrder)
+    bounce.lines.forEach((line, i) => {
+      expect(bounce.rank[i]).toBe(listOrder.indexOf(line.id))
+    })
+  })
+})
@@ -0,0 +1,165 @@
+/**
+ * @fileoverview Precomputed line-equation constants for a chain of walls
+ *
+ * pt2line() and getstrafedir() rederive a wall's slope, direction vector
+ * and projection denominator from its LineRec on every call. Bouncing
+ * measures the ship against every bounce wall, so those terms are worked
+ * out once per planet here, in typed arrays for pt2lineFast() and
+ * getstrafedirFast() to read. A kind's arrays follow the walls state's
+ * kindIndex, so the per-kind startx index is the only per-planet order.
+ */
+
+import type { LineKind, LineRec } from './types/line'
+import { LINE_TYPE } from './types/line'
+
+/**
+ * Slope table from orig/Sources/Play.c:43
+ * slopes2[LINE_E+1]={0, 0, 4, 2, 1, 0} - slopes of lines * 2
+ * Indexed by line type (1-5)
+ */
+export const slopes2: Record<number, number> = {
+  0: 0, // Not used (type 0 doesn't exist)
+  1: 0, // LINE_N (vertical)
+  2: 4, // LINE_NNE
+  3: 2, // LINE_NE
+  4: 1, // LINE_ENE
+  5: 0 // LINE_E (horizontal)
+}
+
+/**
+ * Which branch of pt2line() a wall takes
+ */
+export const LINE_SHAPE = {
+  /** Any slope but vertical or horizontal */
+  SLOPED: 0,
+  /** LINE_N: measured against its x and end points */
+  VERTICAL: 1,
+  /** Zero length: measured against its start point */
+  POINT: 2,
+  /** LINE_E: dy is the vertical distance */
+  HORIZONTAL: 3
+} as const
+
+/**
+ * Walls as parallel arrays, in the order they were given
+ */
+export type LineConstants = {
+  count: number
+  lines: LineRec[]
+  /** Position in the linked list, which breaks ties as a list walk does */
+  rank: Int32Array
+  kind: Uint8Array
+  shape: Uint8Array
+  startx: Int32Array
+  starty: Int32Array
+  endx: Int32Array
+  endy: Int32Array
+  minY: Int32Array
+  maxY: Int32Array
+  /** Slope * 2, signed by up_down */
+  m2: Int32Array
+  /** Direction vector */
+  g: Int32Array
+  h: Int32Array
+  /** g + (h * m2 >> 1), the projection divisor in pt2line() */
+  denominator: Int32Array
+  /** 5 + type * up_down, the strafe direction table column */
+  dirIndex: Int8Array
+}
+
+/**
+ * Precompute the constants for a list of walls, keeping their order
+ */
+export const buildLineConstants = (lines: LineRec[]): LineConstants => {
+  const count = lines.length
+  const constants: LineConstants = {
+    count,
+    lines,
+    rank: new Int32Array(count),
+    kind: new Uint8Array(count),
+    shape: new Uint8Array(count),
+    startx: new Int32Array(count),
+    starty: new Int32Array(count),
+    endx: new Int32Array(count),
+    endy: new Int32Array(count),
+    minY: new Int32Array(count),
+    maxY: new Int32Array(count),
+    m2: new Int32Array(count),
+    g: new Int32Array(count),
+    h: new Int32Array(count),
+    denominator: new Int32Array(count),
+    dirIndex: new Int8Array(count)
+  }
+
+  for (let i = 0; i < count; i++) {
+    const line = lines[i]!
+    const m2 = slopes2[line.type]! * line.up_down
+    const g = line.endx - line.startx
+    const h = line.endy - line.starty
+
+    constants.rank[i] = i
+    constants.kind[i] = line.kind
+    constants.shape[i] =
+      line.type === LINE_TYPE.N
+        ? LINE_SHAPE.VERTICAL
+        : line.length === 0
+          ? LINE_SHAPE.POINT
+          : line.type === LINE_TYPE.E
+            ? LINE_SHAPE.HORIZONTAL
+            : LINE_SHAPE.SLOPED
+    constants.startx[i] = line.startx
+    constants.starty[i] = line.starty
+    constants.endx[i] = line.endx
+    constants.endy[i] = line.endy
+    constants.minY[i] = Math.min(line.starty, line.endy)
+    constants.maxY[i] = Math.max(line.starty, line.endy)
+    constants.m2[i] = m2
+    constants.g[i] = g
+    constants.h[i] = h
+    constants.denominator[i] = g + ((h * m2) >> 1)
+    constants.dirIndex[i] = 5 + line.type * line.up_down
+  }
+
+  return constants
+}
+
+// Built on first use per planet; a level load replaces kindIndex
+const kindConstants = new WeakMap<object, LineConstants>()
+
+/**
+ * Constants for every wall of one kind, in the kind index's startx order
+ *
+ * That is list order whenever the list is sorted, as on every shipped
+ * planet. rank keeps the list order for planets that are not.
+ *
+ * @param walls - The walls state's kind pointers, index and wall records
+ * @param kind - Which kind to build
+ */
+export const getKindLineConstants = (
+  walls: {
+    kindPointers: Record<number, string | null>
+    organizedWalls: Record<string, LineRec>
+    kindIndex: Record<number, { ids: readonly string[] }>
+  },
+  kind: LineKind
+): LineConstants => {
+  const index = walls.kindIndex[kind]!
+  let constants = kindConstants.get(index)
+  if (!constants) {
+    constants = buildLineConstants(
+      index.ids.map(id => walls.organizedWalls[id]!)
+    )
+
+    const position = new Map(index.ids.map((id, i) => [id, i]))
+    let lineId = walls.kindPointers[kind] ?? null
+    for (let rank = 0; lineId !== null; rank++) {
+      const line: LineRec | undefined = walls.organizedWalls[lineId]
+      if (!line) break
+      constants.rank[position.get(lineId)!] = rank
+      lineId = line.nextId
+    }
+
+    kindConstants.set(index, constants)
+  }
+  return constants
+}
@@ -8,20 +8,7 @@ import { LINE_TYPE } from './types/line'
 import type { Point } from './pt2xy'
 import { pt2xy } from './pt2xy'
 import { idiv } from '@lib/integer-math'
-
-/**
- * Slope table from orig/Sources/Play.c:43
- * slopes2[LINE_E+1]={0, 0, 4, 2, 1, 0} - slopes of lines * 2
- * Indexed by line type (1-5)
- */
-const slopes2: Record<number, number> = {
-  0: 0, // Not used (type 0 doesn't exist)
-  1: 0, // LINE_N (vertical)
-  2: 4, // LINE_NNE
-  3: 2, // LINE_NE
-  4: 1, // LINE_ENE
-  5: 0 // LINE_E (horizontal)
-}
+import { LINE_SHAPE, slopes2, type LineConstants } from './lineConstants'
 
 /**
  * Calculate squared distance from a point to a line segment
@@ -101,3 +88,76 @@ export function pt2line(thept: Point, line: LineRec): number {
     return dx * dx + dy * dy
   }
 }
+
+/**
+ * pt2line() for wall `i` of a precomputed chain, always equal to
+ * pt2line({ h, v }, constants.lines[i])
+ *
+ * @param h - x of the point to measure from
+ * @param v - y of the point to measure from
+ * @param constants - The chain the wall belongs to
+ * @param i - Index of the wall in the chain
+ */
+export function pt2lineFast(
+  h: number,
+  v: number,
+  constants: LineConstants,
+  i: number
+): number {
+  const startx = constants.startx[i]!
+  const starty = constants.starty[i]!
+  const endx = constants.endx[i]!
+  const endy = constants.endy[i]!
+
+  if (
+    h < startx - 50 ||
+    h > endx + 50 ||
+    v < constants.minY[i]! - 50 ||
+    v > constants.maxY[i]! + 50
+  ) {
+    return 10000
+  }
+
+  const shape = constants.shape[i]!
+  let dx: number
+  let dy: number
+  if (shape === LINE_SHAPE.VERTICAL) {
+    if (v < starty) {
+      dx = h - startx
+      dy = v - starty
+      return dx * dx + dy * dy + 10
+    } else if (v > endy) {
+      dx = h - endx
+      dy = v - endy
+      return dx * dx + dy * dy + 10
+    }
+    dx = h - startx
+    return dx * dx
+  }
+  if (shape === LINE_SHAPE.POINT) {
+    dx = h - startx
+    dy = v - starty
+    return dx * dx + dy * dy
+  }
+
+  // Same integer steps as pt2line(), with the per-wall terms looked up
+  const g = constants.g[i]!
+  const lineH = constants.h[i]!
+  const denominator = constants.denominator[i]!
+  const term1 = (constants.m2[i]! * (startx - h)) >> 1
+  const numerator = lineH * (term1 - starty + v)
+  dx = denominator === 0 ? 0 : idiv(numerator, denominator)
+  dy = shape === LINE_SHAPE.HORIZONTAL ? v - starty : idiv(dx * -g, lineH)
+
+  const x1 = h + dx
+  if (x1 < startx) {
+    const sx = h - startx
+    const sy = v - starty
+    return sx * sx + sy * sy + 10
+  } else if (x1 > endx) {
+    const ex = h - endx
+    const ey = v - endy
+    return ex * ex + ey * ey + 10
+  }
+  return dx * dx + dy * dy
+}
@@ -0,0 +1,44 @@
+import { describe, it, expect } from 'vitest'
+import { createRandomStream, RandomStream, streamSeed } from './randomStreams'
+import { createFizzGenerator } from '@/core/sound-shared'
+
+const roll = (seed: number): number[] => {
+  const random = createRandomStream(seed)
+  return Array.from({ length: 32 }, () => random.rnumber(1000))
+}
+
+describe('randomStreams', () => {
+  it('derives the same seed from the same inputs', () => {
+    expect(streamSeed(RandomStream.RENDER, 1234, 56)).toBe(
+      streamSeed(RandomStream.RENDER, 1234, 56)
+    )
+    expect(roll(streamSeed(RandomStream.AUDIO, 1234, 56, 2))).toEqual(
+      roll(streamSeed(RandomStream.AUDIO, 1234, 56, 2))
+    )
+  })
+
+  it('gives each stream, frame and part its own seed', () => {
+    const seeds = [
+      streamSeed(RandomStream.RENDER, 1234, 56),
+      streamSeed(RandomStream.AUDIO, 1234, 56),
+      streamSeed(RandomStream.RENDER, 1234, 57),
+      streamSeed(RandomStream.RENDER, 1235, 56),
+      streamSeed(RandomStream.AUDIO, 1234, 56, 0),
+      streamSeed(RandomStream.AUDIO, 1234, 56, 1)
+    ]
+    expect(new Set(seeds).size).toBe(seeds.length)
+    expect(roll(seeds[0]!)).not.toEqual(roll(seeds[2]!))
+  })
+
+  it('makes seeded sound generators reproducible', () => {
+    const samples = (seed: number): number[] => {
+      const generator = createFizzGenerator(createRandomStream(seed))
+      generator.reset()
+      return Array.from({ length: 4 }, () => [
+        ...generator.generateChunk()
+      ]).flat()
+    }
+    expect(samples(7)).toEqual(samples(7))
+    expect(samples(7)).not.toEqual(samples(8))
+  })
+})
@@ -0,0 +1,56 @@
+/**
+ * @fileoverview Seeded random streams for rendering and audio
+ *
+ * The simulation draws from the RandomService seeded at each level load.
+ * Cosmetic randomness (starfields, sound noise) draws from separate
+ * Mulberry32 streams instead, so it never advances the simulation's
+ * sequence. Each stream is seeded from the game seed and the frame number,
+ * so a frame's pixels and a sound's samples come out the same every time
+ * that frame is played or replayed.
+ */
+
+import { createRandomService, type RandomService } from './RandomService'
+
+/**
+ * Stream ids, mixed into the seed so streams never share a sequence
+ */
+export const RandomStream = {
+  RENDER: 0x52454e44, // 'REND'
+  AUDIO: 0x41554449 // 'AUDI'
+} as const
+
+export type RandomStream = (typeof RandomStream)[keyof typeof RandomStream]
+
+// Murmur3 finalizer: every input bit affects every output bit
+const fmix32 = (value: number): number => {
+  let h = value
+  h = Math.imul(h ^ (h >>> 16), 0x85ebca6b)
+  h = Math.imul(h ^ (h >>> 13), 0xc2b2ae35)
+  return (h ^ (h >>> 16)) >>> 0
+}
+
+/**
+ * Seed for a stream from the game seed, the frame number and any further
+ * parts (such as the index of a sound requested within the frame)
+ */
+export const streamSeed = (
+  stream: RandomStream,
+  gameSeed: number,
+  frame: number,
+  ...parts: number[]
+): number => {
+  let hash = fmix32(stream ^ gameSeed)
+  for (const part of [frame, ...parts]) {
+    hash = fmix32(Math.imul(hash, 0x9e3779b1) ^ part)
+  }
+  return hash
+}
+
+/**
+ * A Mulberry32 stream starting from a seed
+ */
+export const createRandomStream = (seed: number): RandomService => {
+  const random = createRandomService()
+  random.setSeed(seed)
+  return random
+}
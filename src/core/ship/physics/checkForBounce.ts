@@ -25,6 +25,8 @@ export type CheckForBounceDeps = {
   wallData: CheckForBounceData
   viewport: { x: number; y: number; b: number; r: number }
   worldwidth: number
+  /** Tracked start for the bounce-wall walk (see getVisibleSet) */
+  startId?: string | null
 }
 
 /**
@@ -35,7 +37,15 @@ export type CheckForBounceDeps = {
  * @see orig/Sources/Play.c:268-287 check_for_bounce()
  */
 export function checkForBounce(deps: CheckForBounceDeps): MonochromeBitmap {
-  const { screen, store, shipDef, wallData, viewport, worldwidth } = deps
+  const {
+    screen,
+    store,
+    shipDef,
+    wallData,
+    viewport,
+    worldwidth,
+    startId
+  } = deps
   const shipState = store.getState().ship
 
   const { globalx, globaly } = shipState
@@ -56,7 +66,8 @@ export function checkForBounce(deps: CheckForBounceDeps): MonochromeBitmap {
     kindPointers: wallData.kindPointers,
     organizedWalls: wallData.organizedWalls,
     viewport,
-    worldwidth
+    worldwidth,
+    startId
   })(screen)
 
   // Step 3: Check for collision after adding bounce walls
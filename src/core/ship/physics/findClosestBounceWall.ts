@@ -3,13 +3,18 @@
  * Corresponds to bounce_ship() at Play.c:302-313 and getstrafedir() at Terrain.c:242-263
  */
 
-import type { LineRec } from '@core/walls'
-import type { Point } from '@core/shared/pt2xy'
-import { getstrafedir, LINE_KIND, pt2line } from '@core/shared'
+import type { LineRec, SortedWallIndex } from '@core/walls'
+import {
+  getKindLineConstants,
+  getstrafedirFast,
+  LINE_KIND,
+  pt2lineFast
+} from '@core/shared'
 
 export type WallData = {
   kindPointers: Record<number, string | null>
   organizedWalls: Record<string, LineRec>
+  kindIndex: Record<number, SortedWallIndex>
 }
 
 /**
@@ -24,39 +29,37 @@ export function findClosestBounceWall(
   wallData: WallData,
   _worldwidth: number
 ): { norm: number } | null {
-  const firstBounceId = wallData.kindPointers[LINE_KIND.BOUNCE]
-  if (!firstBounceId) return null
+  // The bounce walls in startx order, with each wall's line terms
+  // precomputed
+  const bounceWalls = getKindLineConstants(wallData, LINE_KIND.BOUNCE)
 
-  let closestWall: LineRec | null = null
+  let closest = -1
   let minDistance = 1000 // Start with large squared distance like original (Play.c:304)
 
-  // Create Point object for ship position (Play.c:302-303)
-  const shipPoint: Point = { h: globalx, v: globaly }
-
   // Check all bounce walls (Play.c:305-310)
-  let lineId: string | null = firstBounceId
-  while (lineId !== null) {
-    const line: LineRec | undefined = wallData.organizedWalls[lineId]
-    if (!line) break
-
+  for (let i = 0; i < bounceWalls.count; i++) {
     // Calculate actual distance from ship to line segment using pt2line
     // This matches the original pt2line() call at Play.c:306
-    const distance = pt2line(shipPoint, line)
+    const distance = pt2lineFast(globalx, globaly, bounceWalls, i)
 
-    // Compare squared distances (pt2line returns squared distance)
-    if (distance < minDistance) {
+    // Compare squared distances (pt2line returns squared distance). The
+    // original walks the list and keeps the first of equal distances.
+    if (
+      distance < minDistance ||
+      (distance === minDistance &&
+        closest >= 0 &&
+        bounceWalls.rank[i]! < bounceWalls.rank[closest]!)
+    ) {
       minDistance = distance
-      closestWall = line
+      closest = i
     }
-
-    lineId = line.nextId
   }
 
-  if (!closestWall) return null
+  if (closest < 0) return null
 
   // Calculate norm using getstrafedir (Play.c:313)
   // The norm should point away from the wall toward unbouncex/unbouncey
-  const norm = getstrafedir(closestWall, unbouncex, unbouncey)
+  const norm = getstrafedirFast(bounceWalls, closest, unbouncex, unbouncey)
 
   return { norm }
 }
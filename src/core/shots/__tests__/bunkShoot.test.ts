@@ -0,0 +1,120 @@
+import { describe, it, expect } from 'vitest'
+import { BunkerKind, type Bunker } from '@core/planet'
+import { createRandomService } from '@core/shared'
+import { bunkShoot } from '../bunkShoot'
+import { BUNKER_FIRE_WEIGHT, SHOT } from '../constants'
+import type { ShotRec } from '../types'
+
+// bunk_shoot()'s weights as the original switch computes them
+const switchWeight = (kind: number, rot: number): number => {
+  if (kind === BunkerKind.GENERATOR) return 0
+  if (kind !== BunkerKind.DIFF) return 1
+  switch (rot & 3) {
+    case 0:
+      return 0
+    case 1:
+    case 3:
+      return 2
+    default:
+      return 1
+  }
+}
+
+const emptyShot: ShotRec = {
+  x: 0,
+  y: 0,
+  x8: 0,
+  y8: 0,
+  lifecount: 0,
+  v: 0,
+  h: 0,
+  strafedir: -1,
+  btime: 0,
+  hitlineId: '',
+  origin: { x: 0, y: 0 }
+}
+
+const bunker = (x: number, kind: BunkerKind, rot: number): Bunker => ({
+  x,
+  y: 200,
+  rot,
+  ranges: [
+    { low: 0, high: 64 },
+    { low: 256, high: 320 }
+  ],
+  alive: true,
+  kind
+})
+
+describe('bunkShoot', () => {
+  it('weights bunkers as bunk_shoot() does', () => {
+    for (let kind = 0; kind < BUNKER_FIRE_WEIGHT.length; kind++) {
+      for (let rot = 0; rot < 16; rot++) {
+        expect(BUNKER_FIRE_WEIGHT[kind]![rot], `${kind}/${rot}`).toBe(
+          switchWeight(kind, rot)
+        )
+      }
+    }
+  })
+
+  it('only picks bunkers that can fire', () => {
+    const bunkrecs = [
+      bunker(100, BunkerKind.GENERATOR, 0),
+      bunker(150, BunkerKind.DIFF, 4),
+      bunker(200, BunkerKind.FOLLOW, 2),
+      bunker(250, BunkerKind.DIFF, 1)
+    ]
+    const shoot = (seed: number): ShotRec[] => {
+      const randomService = createRandomService()
+      randomService.setSeed(seed)
+      return bunkShoot({
+        screenx: 0,
+        screenr: 512,
+        screeny: 0,
+        screenb: 318,
+        bunkrecs,
+        walls: [],
+        worldwidth: 2000,
+        worldwrap: false,
+        globalx: 260,
+        globaly: 120,
+        randomService
+      })(Array.from({ length: SHOT.NUMSHOTS }, () => emptyShot))
+    }
+
+    for (let seed = 1; seed < 40; seed++) {
+      const shot = shoot(seed)[0]!
+      expect([200, 250]).toContain(shot.origin.x)
+    }
+  })
+
+  it('survives rotations and kinds outside the tables', () => {
+    const bunkrecs = [
+      bunker(150, BunkerKind.DIFF, 16),
+      bunker(200, 9 as BunkerKind, 3),
+      bunker(250, BunkerKind.DIFF, 17)
+    ]
+
+    for (let seed = 1; seed < 40; seed++) {
+      const randomService = createRandomService()
+      randomService.setSeed(seed)
+      const shot = bunkShoot({
+        screenx: 0,
+        screenr: 512,
+        screeny: 0,
+        screenb: 318,
+        bunkrecs,
+        walls: [],
+        worldwidth: 2000,
+        worldwrap: false,
+        globalx: 260,
+        globaly: 120,
+        randomService
+      })(Array.from({ length: SHOT.NUMSHOTS }, () => emptyShot))[0]!
+
+      // rot 16 wraps to 0, where difference bunkers never fire
+      expect([200, 250]).toContain(shot.origin.x)
+      expect(Number.isFinite(shot.x8) && Number.isFinite(shot.y8)).toBe(true)
+    }
+  })
+})
@@ -4,6 +4,8 @@ import { aimDir } from './aimDir'
 /**
  * Calculate rotation direction for following bunker
  * See orig/Sources/Bunkers.c at aim_bunk():53-74
+ *
+ * @param toShip - aimDir(bunk, deps), if the caller already has it
  */
 export function aimBunk(
   bunk: Bunker,
@@ -12,9 +14,10 @@ export function aimBunk(
     globaly: number
     worldwidth: number
     worldwrap: boolean
-  }
+  },
+  toShip: number = aimDir(bunk, deps)
 ): number {
-  let angle = aimDir(bunk, deps) /* 0-359 */
+  let angle = toShip /* 0-359 */
 
   angle += 11
   if (angle >= 360) {
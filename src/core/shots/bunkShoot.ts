@@ -2,7 +2,12 @@ import type { Bunker } from '@core/planet'
 import { BunkerKind } from '@core/planet'
 import type { ShotRec } from './types'
 import type { LineRec, RandomService } from '@core/shared'
-import { SHOT, xbshotstart, ybshotstart } from './constants'
+import {
+  BUNKER_FIRE_WEIGHT,
+  SHOT,
+  xbshotstart,
+  ybshotstart
+} from './constants'
 import { SCRWTH } from '@core/screen'
 import { PLANET } from '@core/planet'
 import { aimBunk } from './aimBunk'
@@ -22,15 +27,17 @@ function followShot(deps: {
   randomService: RandomService
 }): (sp: ShotRec) => ShotRec {
   return sp => {
-    const straight = aimBunk(deps.bp, deps)
+    // The original calls aim_dir() up to three times with the same inputs
+    const toShip = aimDir(deps.bp, deps)
+    const straight = aimBunk(deps.bp, deps, toShip)
     let angle: number
 
     if (straight === 0) {
       /* if aiming at ship */
-      angle = aimDir(deps.bp, deps)
+      angle = toShip
     } else {
       angle = (deps.bp.rot * 45) >> 1
-      const dang = aimDir(deps.bp, deps) - angle
+      const dang = toShip - angle
       if ((dang > 90 && dang < 270) || dang < -90) {
         angle += 180
       }
@@ -90,8 +97,9 @@ function initializeShot(deps: {
 }): (sp: ShotRec) => ShotRec {
   return sp => {
     const { bp, lifecount } = deps
-    const x8 = (bp.x + xbshotstart[bp.kind]![bp.rot]!) << 3
-    const y8 = (bp.y + ybshotstart[bp.kind]![bp.rot]!) << 3
+    // Same guards as the fire weights: no offset for an unknown kind
+    const x8 = (bp.x + (xbshotstart[bp.kind]?.[bp.rot & 15] ?? 0)) << 3
+    const y8 = (bp.y + (ybshotstart[bp.kind]?.[bp.rot & 15] ?? 0)) << 3
 
     return {
       ...sp,
@@ -154,7 +162,7 @@ export function bunkShoot(deps: {
     const bot = screenb + SHOT.SHOOTMARG
 
     // Build eligible bunker list with weights
-    const eligible = new Array<number>(PLANET.NUMBUNKERS).fill(0)
+    const eligible = new Uint8Array(PLANET.NUMBUNKERS)
     let sum = 0
 
     for (let i = 0; i < bunkrecs.length && bunkrecs[i]!.rot >= 0; i++) {
@@ -165,23 +173,10 @@ export function bunkShoot(deps: {
         bp.y < bot &&
         ((bp.x > left && bp.x < right) || (bp.x > farleft && bp.x < farright))
       ) {
-        let c = 1
-        if (bp.kind === BunkerKind.GENERATOR) {
-          c = 0
-        } else if (bp.kind === BunkerKind.DIFF) {
-          switch (bp.rot & 3) {
-            case 0:
-              c = 0
-              break
-            case 1:
-            case 3:
-              c = 2
-              break
-            case 2:
-              c = 1
-              break // default case implicitly gives c=1
-          }
-        }
+        // A rotation or kind outside the tables would make the sum NaN
+        // and the pick below loop forever. Unknown kinds take the
+        // switch's default weight.
+        const c = BUNKER_FIRE_WEIGHT[bp.kind]?.[bp.rot & 15] ?? 1
         eligible[i] = c
         sum += c
       }
@@ -51,6 +51,24 @@ export const ybshotstart: number[][] = [
   [0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0]
 ]
 
+/**
+ * Weight of each bunker in the random pick of which one fires
+ * From orig/Sources/Bunkers.c at bunk_shoot() (lines 146-158)
+ *
+ * Generators never fire. Difference bunkers fire by rotation: never when
+ * rot & 3 is 0, twice as often when it is 1 or 3. Everything else has
+ * weight 1.
+ *
+ * Index by: [bunkerKind][rotation]
+ */
+export const BUNKER_FIRE_WEIGHT: readonly (readonly number[])[] = [
+  [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1],
+  [0, 2, 1, 2, 0, 2, 1, 2, 0, 2, 1, 2, 0, 2, 1, 2],
+  [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1],
+  [1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1],
+  [0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0]
+]
+
 /**
  * Bounce vectors for wall normal calculations
  * From orig/Sources/Play.c (line 289-290)
@@ -4,11 +4,7 @@
 
 import { describe, it, expect, beforeEach } from 'vitest'
 import { createMixer } from '../mixer'
-import {
-  SoundType,
-  SOUND_PRIORITIES,
-  createFireGenerator
-} from '@/core/sound-shared'
+import { SoundType, SOUND_PRIORITIES } from '@/core/sound-shared'
 
 describe('createMixer', () => {
   let mixer: ReturnType<typeof createMixer>
@@ -30,8 +26,7 @@ describe('createMixer', () => {
 
   describe('allocateChannel', () => {
     it('allocates first available channel for new sound', () => {
-      const generator = createFireGenerator()
-      const request = mixer.allocateChannel(SoundType.FIRE_SOUND, generator)
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       expect(request).not.toBeNull()
       expect(request!.channelId).toBe(0)
@@ -44,13 +39,9 @@ describe('createMixer', () => {
     })
 
     it('allocates multiple channels for different sounds', () => {
-      const gen1 = createFireGenerator()
-      const gen2 = createFireGenerator()
-      const gen3 = createFireGenerator()
-
-      const req1 = mixer.allocateChannel(SoundType.FIRE_SOUND, gen1)
-      const req2 = mixer.allocateChannel(SoundType.EXP1_SOUND, gen2)
-      const req3 = mixer.allocateChannel(SoundType.BUNK_SOUND, gen3)
+      const req1 = mixer.allocateChannel(SoundType.FIRE_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.EXP1_SOUND)
+      const req3 = mixer.allocateChannel(SoundType.BUNK_SOUND)
 
       expect(req1!.channelId).toBe(0)
       expect(req2!.channelId).toBe(1)
@@ -65,8 +56,7 @@ describe('createMixer', () => {
     it('can allocate all 8 channels', () => {
       const requests = []
       for (let i = 0; i < 8; i++) {
-        const gen = createFireGenerator()
-        requests.push(mixer.allocateChannel(SoundType.FIRE_SOUND, gen))
+        requests.push(mixer.allocateChannel(SoundType.FIRE_SOUND))
       }
 
       expect(requests.every(req => req !== null)).toBe(true)
@@ -81,14 +71,11 @@ describe('createMixer', () => {
     it('interrupts lower-priority sound when all channels busy', () => {
       // Fill all channels with low-priority sounds (SOFT_SOUND priority=30)
       for (let i = 0; i < 8; i++) {
-        mixer.allocateChannel(SoundType.SOFT_SOUND, createFireGenerator())
+        mixer.allocateChannel(SoundType.SOFT_SOUND)
       }
 
       // Try to play high-priority sound (FIRE_SOUND priority=70)
-      const request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       expect(request).not.toBeNull()
       expect(request!.soundType).toBe(SoundType.FIRE_SOUND)
@@ -109,14 +96,11 @@ describe('createMixer', () => {
     it('drops sound if priority too low and all channels busy', () => {
       // Fill all channels with high-priority sounds (FIRE_SOUND priority=70)
       for (let i = 0; i < 8; i++) {
-        mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+        mixer.allocateChannel(SoundType.FIRE_SOUND)
       }
 
       // Try to play low-priority sound (SOFT_SOUND priority=30)
-      const request = mixer.allocateChannel(
-        SoundType.SOFT_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.SOFT_SOUND)
 
       expect(request).toBeNull()
 
@@ -127,9 +111,18 @@ describe('createMixer', () => {
       )
     })
 
+    it('records the request tick on the claimed channel', () => {
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND, 42)
+
+      expect(request!.tick).toBe(42)
+      expect(mixer.getChannels()[request!.channelId]!.startTick).toBe(42)
+
+      mixer.markChannelEnded(request!.channelId)
+      expect(mixer.getChannels()[request!.channelId]!.startTick).toBe(0)
+    })
+
     it('allocates thrust sound (no special continuous handling)', () => {
-      const generator = createFireGenerator()
-      const request = mixer.allocateChannel(SoundType.THRU_SOUND, generator)
+      const request = mixer.allocateChannel(SoundType.THRU_SOUND)
 
       expect(request).not.toBeNull()
       expect(request!.soundType).toBe(SoundType.THRU_SOUND)
@@ -141,29 +134,23 @@ describe('createMixer', () => {
 
     it('interrupts channel with exactly equal priority', () => {
       // Play a FIRE_SOUND (priority 70)
-      mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+      mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       // Fill remaining 7 channels with same priority
       for (let i = 0; i < 7; i++) {
-        mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+        mixer.allocateChannel(SoundType.FIRE_SOUND)
       }
 
       // All 8 channels now have FIRE_SOUND at priority 70
       // Try to play another FIRE_SOUND - should fail (priority not HIGHER)
-      const request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       expect(request).toBeNull()
     })
 
     it('interrupts channel with lower priority after decay', () => {
       // Play a FIRE_SOUND (priority 70, decays by 5 per frame)
-      const req1 = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const req1 = mixer.allocateChannel(SoundType.FIRE_SOUND)
       expect(req1).not.toBeNull()
 
       // Decay priorities once
@@ -175,17 +162,14 @@ describe('createMixer', () => {
 
       // Fill remaining channels with priority 60
       for (let i = 0; i < 7; i++) {
-        mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+        mixer.allocateChannel(SoundType.FIRE_SOUND)
         // Decay once so they're at 55
         mixer.updatePriorities()
       }
 
       // Now try to play FIRE_SOUND (initial priority 70)
       // Should interrupt one of the decayed sounds
-      const req2 = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const req2 = mixer.allocateChannel(SoundType.FIRE_SOUND)
       expect(req2).not.toBeNull()
     })
   })
@@ -193,10 +177,7 @@ describe('createMixer', () => {
   describe('stopSound', () => {
     it('stops a playing sound by type', () => {
       // Start thrust sound
-      const request = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.THRU_SOUND)
       expect(request).not.toBeNull()
 
       const channelId = request!.channelId
@@ -218,7 +199,7 @@ describe('createMixer', () => {
 
     it('stops any sound type (not just continuous sounds)', () => {
       // Play a fire sound
-      mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+      mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       // Stop it with stopSound
       const stopRequest = mixer.stopSound(SoundType.FIRE_SOUND)
@@ -234,7 +215,7 @@ describe('createMixer', () => {
     it('clears all active channels', () => {
       // Fill all channels
       for (let i = 0; i < 8; i++) {
-        mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+        mixer.allocateChannel(SoundType.FIRE_SOUND)
       }
 
       expect(mixer.getChannels().every(ch => ch.active)).toBe(true)
@@ -258,10 +239,7 @@ describe('createMixer', () => {
 
   describe('markChannelEnded', () => {
     it('marks channel as inactive', () => {
-      const request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
       const channelId = request!.channelId
 
       expect(mixer.getChannels()[channelId]!.active).toBe(true)
@@ -280,10 +258,7 @@ describe('createMixer', () => {
 
   describe('updatePriorities', () => {
     it('decays FIRE_SOUND priority by 5', () => {
-      const request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
       const channelId = request!.channelId
 
       const initialPriority = SOUND_PRIORITIES[SoundType.FIRE_SOUND]
@@ -299,10 +274,7 @@ describe('createMixer', () => {
     })
 
     it('decays BUNK_SOUND priority by 1', () => {
-      const request = mixer.allocateChannel(
-        SoundType.BUNK_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.BUNK_SOUND)
       const channelId = request!.channelId
 
       const initialPriority = SOUND_PRIORITIES[SoundType.BUNK_SOUND]
@@ -311,10 +283,7 @@ describe('createMixer', () => {
     })
 
     it('does not decay THRU_SOUND priority', () => {
-      const request = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.THRU_SOUND)
       const channelId = request!.channelId
 
       const initialPriority = SOUND_PRIORITIES[SoundType.THRU_SOUND]
@@ -323,10 +292,7 @@ describe('createMixer', () => {
     })
 
     it('does not decay EXP2_SOUND priority (ship explosion)', () => {
-      const request = mixer.allocateChannel(
-        SoundType.EXP2_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.EXP2_SOUND)
       const channelId = request!.channelId
 
       const initialPriority = SOUND_PRIORITIES[SoundType.EXP2_SOUND]
@@ -335,10 +301,7 @@ describe('createMixer', () => {
     })
 
     it('does not decay below zero', () => {
-      const request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
       const channelId = request!.channelId
 
       // Decay many times
@@ -350,10 +313,7 @@ describe('createMixer', () => {
     })
 
     it('only updates active channels', () => {
-      const request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
       const channelId = request!.channelId
 
       mixer.markChannelEnded(channelId)
@@ -366,8 +326,8 @@ describe('createMixer', () => {
 
   describe('findChannelPlayingSound', () => {
     it('finds channel playing specific sound', () => {
-      mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
-      mixer.allocateChannel(SoundType.THRU_SOUND, createFireGenerator())
+      mixer.allocateChannel(SoundType.FIRE_SOUND)
+      mixer.allocateChannel(SoundType.THRU_SOUND)
 
       const channel = mixer.findChannelPlayingSound(SoundType.THRU_SOUND)
       expect(channel).not.toBeNull()
@@ -380,8 +340,8 @@ describe('createMixer', () => {
     })
 
     it('returns first matching channel if multiple playing', () => {
-      mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
-      mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+      mixer.allocateChannel(SoundType.FIRE_SOUND)
+      mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       const channel = mixer.findChannelPlayingSound(SoundType.FIRE_SOUND)
       expect(channel).not.toBeNull()
@@ -392,18 +352,12 @@ describe('createMixer', () => {
   describe('singleton sounds', () => {
     it('prevents duplicate thrust sounds from playing simultaneously', () => {
       // Allocate thrust on first channel
-      const req1 = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const req1 = mixer.allocateChannel(SoundType.THRU_SOUND)
       expect(req1).not.toBeNull()
       expect(req1!.channelId).toBe(0)
 
       // Try to allocate another thrust - should be rejected
-      const req2 = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const req2 = mixer.allocateChannel(SoundType.THRU_SOUND)
       expect(req2).toBeNull()
 
       // Verify only one thrust sound is playing
@@ -415,50 +369,32 @@ describe('createMixer', () => {
     })
 
     it('prevents duplicate shield sounds', () => {
-      mixer.allocateChannel(SoundType.SHLD_SOUND, createFireGenerator())
-      const req2 = mixer.allocateChannel(
-        SoundType.SHLD_SOUND,
-        createFireGenerator()
-      )
+      mixer.allocateChannel(SoundType.SHLD_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.SHLD_SOUND)
       expect(req2).toBeNull()
     })
 
     it('prevents duplicate ship explosion sounds', () => {
-      mixer.allocateChannel(SoundType.EXP2_SOUND, createFireGenerator())
-      const req2 = mixer.allocateChannel(
-        SoundType.EXP2_SOUND,
-        createFireGenerator()
-      )
+      mixer.allocateChannel(SoundType.EXP2_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.EXP2_SOUND)
       expect(req2).toBeNull()
     })
 
     it('prevents duplicate fizz sounds', () => {
-      mixer.allocateChannel(SoundType.FIZZ_SOUND, createFireGenerator())
-      const req2 = mixer.allocateChannel(
-        SoundType.FIZZ_SOUND,
-        createFireGenerator()
-      )
+      mixer.allocateChannel(SoundType.FIZZ_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.FIZZ_SOUND)
       expect(req2).toBeNull()
     })
 
     it('prevents duplicate echo sounds', () => {
-      mixer.allocateChannel(SoundType.ECHO_SOUND, createFireGenerator())
-      const req2 = mixer.allocateChannel(
-        SoundType.ECHO_SOUND,
-        createFireGenerator()
-      )
+      mixer.allocateChannel(SoundType.ECHO_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.ECHO_SOUND)
       expect(req2).toBeNull()
     })
 
     it('allows multiple fire sounds (not a singleton)', () => {
-      const req1 = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
-      const req2 = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      const req1 = mixer.allocateChannel(SoundType.FIRE_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.FIRE_SOUND)
 
       expect(req1).not.toBeNull()
       expect(req2).not.toBeNull()
@@ -472,14 +408,8 @@ describe('createMixer', () => {
     })
 
     it('allows multiple bunker explosions (not a singleton)', () => {
-      const req1 = mixer.allocateChannel(
-        SoundType.EXP1_SOUND,
-        createFireGenerator()
-      )
-      const req2 = mixer.allocateChannel(
-        SoundType.EXP1_SOUND,
-        createFireGenerator()
-      )
+      const req1 = mixer.allocateChannel(SoundType.EXP1_SOUND)
+      const req2 = mixer.allocateChannel(SoundType.EXP1_SOUND)
 
       expect(req1).not.toBeNull()
       expect(req2).not.toBeNull()
@@ -487,58 +417,58 @@ describe('createMixer', () => {
 
     it('allows singleton to play again after previous instance ends', () => {
       // Play thrust
-      const req1 = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const req1 = mixer.allocateChannel(SoundType.THRU_SOUND)
       expect(req1).not.toBeNull()
 
       // Try to play again - blocked
-      const req2 = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const req2 = mixer.allocateChannel(SoundType.THRU_SOUND)
       expect(req2).toBeNull()
 
       // End the first thrust
       mixer.markChannelEnded(req1!.channelId)
 
       // Now we can play thrust again
-      const req3 = mixer.allocateChannel(
-        SoundType.THRU_SOUND,
-        createFireGenerator()
-      )
+      const req3 = mixer.allocateChannel(SoundType.THRU_SOUND)
       expect(req3).not.toBeNull()
     })
   })
 
+  describe('setChannelLimit', () => {
+    it('only allocates channels below the limit', () => {
+      mixer.setChannelLimit(2)
+
+      expect(mixer.allocateChannel(SoundType.SOFT_SOUND)!.channelId).toBe(0)
+      expect(mixer.allocateChannel(SoundType.SOFT_SOUND)!.channelId).toBe(1)
+
+      // Higher priority sound steals within the limit rather than using 2-7
+      const request = mixer.allocateChannel(SoundType.FIRE_SOUND)
+      expect(request).not.toBeNull()
+      expect(request!.channelId).toBeLessThan(2)
+      expect(mixer.getChannels()[2]!.active).toBe(false)
+    })
+
+    it('clamps the limit to at least one channel', () => {
+      mixer.setChannelLimit(0)
+      expect(mixer.allocateChannel(SoundType.FIRE_SOUND)!.channelId).toBe(0)
+      expect(mixer.allocateChannel(SoundType.FIRE_SOUND)).toBeNull()
+    })
+  })
+
   describe('complex scenarios', () => {
     it('handles rapid allocation and deallocation', () => {
       // Allocate 4 sounds
-      const req1 = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )!
-      mixer.allocateChannel(SoundType.BUNK_SOUND, createFireGenerator())!
-      const req3 = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )!
-      mixer.allocateChannel(SoundType.THRU_SOUND, createFireGenerator())!
+      const req1 = mixer.allocateChannel(SoundType.FIRE_SOUND)!
+      mixer.allocateChannel(SoundType.BUNK_SOUND)!
+      const req3 = mixer.allocateChannel(SoundType.FIRE_SOUND)!
+      mixer.allocateChannel(SoundType.THRU_SOUND)!
 
       // End first and third
       mixer.markChannelEnded(req1.channelId)
       mixer.markChannelEnded(req3.channelId)
 
       // Allocate two more - should reuse freed channels
-      const req5 = mixer.allocateChannel(
-        SoundType.EXP1_SOUND,
-        createFireGenerator()
-      )!
-      const req6 = mixer.allocateChannel(
-        SoundType.FUEL_SOUND,
-        createFireGenerator()
-      )!
+      const req5 = mixer.allocateChannel(SoundType.EXP1_SOUND)!
+      const req6 = mixer.allocateChannel(SoundType.FUEL_SOUND)!
 
       // Should have reused channels 0 and 2
       expect([req5.channelId, req6.channelId].sort()).toEqual([0, 2])
@@ -551,15 +481,12 @@ describe('createMixer', () => {
     it('priority system allows same sound to interrupt itself after decay', () => {
       // Fill all 8 channels with FIRE_SOUND (priority 70, decays by 5)
       for (let i = 0; i < 8; i++) {
-        mixer.allocateChannel(SoundType.FIRE_SOUND, createFireGenerator())
+        mixer.allocateChannel(SoundType.FIRE_SOUND)
       }
 
       // All channels busy with FIRE_SOUND at priority 70
       // Try to play FIRE_SOUND - should fail (not higher priority)
-      let request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      let request = mixer.allocateChannel(SoundType.FIRE_SOUND)
       expect(request).toBeNull()
 
       // Decay priorities once
@@ -567,10 +494,7 @@ describe('createMixer', () => {
 
       // All FIRE_SOUND now at priority 65
       // New FIRE_SOUND at 70 should interrupt one of the decayed FIRE_SOUND
-      request = mixer.allocateChannel(
-        SoundType.FIRE_SOUND,
-        createFireGenerator()
-      )
+      request = mixer.allocateChannel(SoundType.FIRE_SOUND)
       expect(request).not.toBeNull()
 
       // Verify all 8 channels still have FIRE_SOUND (interrupted one, added new one)
@@ -0,0 +1,123 @@
+/**
+ * Tests for the mixer worklet's channel lifetime
+ */
+
+import { describe, it, expect, beforeAll } from 'vitest'
+import {
+  SoundType,
+  convertSample,
+  createFireGenerator
+} from '@/core/sound-shared'
+import { WorkletEventType, WorkletMessageType } from '../types'
+import type { ChannelState, WorkletEvent, WorkletMessage } from '../types'
+
+const QUANTUM = 128
+
+type Processor = {
+  port: {
+    onmessage: ((event: { data: WorkletMessage }) => void) | null
+    posted: WorkletEvent[]
+  }
+  process: (
+    inputs: Float32Array[][],
+    outputs: Float32Array[][],
+    parameters: Record<string, Float32Array>
+  ) => boolean
+}
+
+let Processor: new () => Processor
+
+beforeAll(async () => {
+  // Just enough of the AudioWorkletGlobalScope for the processor
+  const scope = globalThis as Record<string, unknown>
+  scope.sampleRate = 22200
+  scope.AudioWorkletProcessor = class {
+    port = {
+      onmessage: null,
+      posted: [] as WorkletEvent[],
+      postMessage(event: WorkletEvent): void {
+        this.posted.push(event)
+      }
+    }
+  }
+  scope.registerProcessor = (
+    _name: string,
+    ctor: new () => Processor
+  ): void => {
+    Processor = ctor
+  }
+  await import('../worklet/mixerProcessor.worklet')
+})
+
+const play = (processor: Processor, soundType: SoundType): void => {
+  processor.port.onmessage!({
+    data: { type: WorkletMessageType.PLAY, soundType, tick: 0, seed: 1 }
+  })
+}
+
+const render = (processor: Processor): Float32Array => {
+  const output = new Float32Array(QUANTUM)
+  processor.process([], [[output]], {})
+  return output
+}
+
+const lastChannelState = (processor: Processor): ChannelState[] => {
+  const states = processor.port.posted.filter(
+    event => event.type === WorkletEventType.CHANNEL_STATE
+  )
+  return states[states.length - 1]!.channels
+}
+
+// Every sample the fire sound produces, as the worklet outputs them
+const fireSamples = (): number[] => {
+  const generator = createFireGenerator()
+  generator.start()
+  const samples: number[] = []
+  do {
+    for (const sample of generator.generateChunk()) {
+      samples.push(convertSample(sample))
+    }
+  } while (!generator.hasEnded())
+  return samples
+}
+
+describe('MixerAudioProcessor', () => {
+  it('keeps an ended sound allocated until its tail has played', () => {
+    const processor = new Processor()
+    const expected = fireSamples()
+    play(processor, SoundType.FIRE_SOUND)
+
+    const played: number[] = []
+    const ended = (): boolean =>
+      processor.port.posted.some(
+        event => event.type === WorkletEventType.SOUND_ENDED
+      )
+    while (!ended()) {
+      played.push(...render(processor))
+      if (played.length < expected.length) {
+        expect(lastChannelState(processor)[0]!.active).toBe(true)
+      }
+    }
+
+    expect(played.length).toBeGreaterThanOrEqual(expected.length)
+    expect(played.slice(0, expected.length)).toEqual(expected)
+    expect(lastChannelState(processor)[0]!.active).toBe(false)
+  })
+
+  it('puts a new sound on another channel while a tail drains', () => {
+    const processor = new Processor()
+    const expected = fireSamples()
+    play(processor, SoundType.FIRE_SOUND)
+
+    // Render until the last chunk is buffered but not all of it played
+    const played: number[] = []
+    while (played.length + QUANTUM < expected.length) {
+      played.push(...render(processor))
+    }
+    play(processor, SoundType.BUNK_SOUND)
+
+    const channels = lastChannelState(processor)
+    expect(channels[0]!.soundType).toBe(SoundType.FIRE_SOUND)
+    expect(channels[1]!.soundType).toBe(SoundType.BUNK_SOUND)
+  })
+})
@@ -9,12 +9,21 @@
  * - Buffer management per channel
  * - Mixing algorithm
  * - Format conversion
+ * - Channel allocation and priority decay
  *
- * This module handles control and setup from the main thread.
+ * This module handles control and setup from the main thread. Messages sent
+ * while the engine is still starting are queued and delivered once the
+ * worklet node exists, so the first sound of a session is not lost.
  */
 
 import workletUrl from './worklet/mixerProcessor.worklet.ts?worker&url'
-import type { PlayMessage, StopMessage, WorkletEvent } from './types'
+import type {
+  ChannelState,
+  PlayMessage,
+  StopMessage,
+  WorkletEvent,
+  WorkletMessage
+} from './types'
 import { WorkletMessageType, WorkletEventType } from './types'
 
 export type AudioOutput = {
@@ -50,9 +59,9 @@ export type AudioOutput = {
   setVolume(volume: number): void
 
   /**
-   * Send PLAY message to worklet to start sound on a channel
+   * Send PLAY request to worklet (it allocates the channel)
    */
-  playOnChannel(message: Omit<PlayMessage, 'type'>): void
+  requestSound(message: Omit<PlayMessage, 'type'>): void
 
   /**
    * Send STOP message to worklet to stop a continuous sound
@@ -64,6 +73,11 @@ export type AudioOutput = {
    */
   clearAllSounds(): void
 
+  /**
+   * Limit how many channels the worklet may allocate
+   */
+  setChannelLimit(limit: number): void
+
   /**
    * Register callback for when a sound ends on a channel
    */
@@ -75,6 +89,11 @@ export type AudioOutput = {
   onUnderrun(
     callback: (channelId: number, available: number, needed: number) => void
   ): void
+
+  /**
+   * Register callback for mirrored channel state (for debugging)
+   */
+  onChannelState(callback: (channels: ChannelState[]) => void): void
 }
 
 /**
@@ -86,6 +105,11 @@ export const createAudioOutput = (): AudioOutput => {
   let gainNode: GainNode | null = null
   let isPlaying = false
   let workletLoaded = false
+  let startPromise: Promise<void> | null = null
+  let channelLimit: number | null = null // Re-sent to every new worklet node
+
+  // Messages posted while the engine is starting, with the time they were sent
+  let pendingMessages: Array<{ message: WorkletMessage; sentAt: number }> = []
 
   // Event callbacks
   let soundEndedCallback:
@@ -94,10 +118,12 @@ export const createAudioOutput = (): AudioOutput => {
   let underrunCallback:
     | ((channelId: number, available: number, needed: number) => void)
     | null = null
+  let channelStateCallback: ((channels: ChannelState[]) => void) | null = null
 
   // Constants
   const SAMPLE_RATE = 22200 // Original Mac sample rate
   const MASTER_GAIN_SCALE = 0.5 // Scale down overall volume (100% = 50% of max)
+  const MAX_PENDING_PLAY_AGE_MS = 250 // Queued sounds older than this drop
 
   /**
    * Load the audio worklet module
@@ -143,17 +169,68 @@ export const createAudioOutput = (): AudioOutput => {
         }
         break
 
+      case WorkletEventType.CHANNEL_STATE:
+        if (channelStateCallback) {
+          channelStateCallback(message.channels)
+        }
+        break
+
       default:
         console.warn('[MixerAudioOutput] Unknown worklet message:', message)
     }
   }
 
+  /**
+   * Post a message to the worklet, queueing it if the engine is starting
+   */
+  const post = (message: WorkletMessage): void => {
+    if (workletNode) {
+      workletNode.port.postMessage(message)
+    } else if (startPromise) {
+      pendingMessages.push({ message, sentAt: performance.now() })
+    }
+  }
+
+  /**
+   * Deliver messages queued during startup
+   *
+   * Play requests that waited too long are dropped - a late shot sound is
+   * worse than none. Stop and clear messages are always delivered so
+   * continuous sounds cannot get stuck on.
+   */
+  const flushPendingMessages = (): void => {
+    const now = performance.now()
+    const queued = pendingMessages
+    pendingMessages = []
+
+    for (const { message, sentAt } of queued) {
+      if (
+        message.type === WorkletMessageType.PLAY &&
+        now - sentAt > MAX_PENDING_PLAY_AGE_MS
+      ) {
+        continue
+      }
+      workletNode?.port.postMessage(message)
+    }
+  }
+
   /**
    * Start audio playback
+   *
+   * Concurrent callers share the same start attempt.
    */
-  const start = async (): Promise<void> => {
-    if (isPlaying) return
+  const start = (): Promise<void> => {
+    if (isPlaying) return Promise.resolve()
 
+    if (!startPromise) {
+      startPromise = startEngine().finally(() => {
+        startPromise = null
+      })
+    }
+    return startPromise
+  }
+
+  const startEngine = async (): Promise<void> => {
     try {
       // Create audio context if needed
       if (!audioContext) {
@@ -192,6 +269,13 @@ export const createAudioOutput = (): AudioOutput => {
       gainNode.connect(audioContext.destination)
 
       isPlaying = true
+      if (channelLimit !== null) {
+        workletNode.port.postMessage({
+          type: WorkletMessageType.SET_CHANNEL_LIMIT,
+          limit: channelLimit
+        })
+      }
+      flushPendingMessages()
 
       console.log('[MixerAudioOutput] Audio started (AudioWorklet Mixer):', {
         sampleRate: audioContext.sampleRate,
@@ -209,6 +293,8 @@ export const createAudioOutput = (): AudioOutput => {
    * Stop audio playback
    */
   const stop = (): void => {
+    pendingMessages = []
+
     if (workletNode) {
       workletNode.disconnect()
       workletNode.port.onmessage = null
@@ -283,36 +369,43 @@ export const createAudioOutput = (): AudioOutput => {
   }
 
   /**
-   * Send PLAY message to worklet
+   * Send PLAY request to worklet
    */
-  const playOnChannel = (message: Omit<PlayMessage, 'type'>): void => {
-    if (workletNode) {
-      workletNode.port.postMessage({
-        type: WorkletMessageType.PLAY,
-        ...message
-      })
-    }
+  const requestSound = (message: Omit<PlayMessage, 'type'>): void => {
+    post({
+      type: WorkletMessageType.PLAY,
+      ...message
+    })
   }
 
   /**
    * Send STOP message to worklet
    */
   const stopSound = (message: Omit<StopMessage, 'type'>): void => {
-    if (workletNode) {
-      workletNode.port.postMessage({
-        type: WorkletMessageType.STOP,
-        ...message
-      })
-    }
+    post({
+      type: WorkletMessageType.STOP,
+      ...message
+    })
   }
 
   /**
    * Send CLEAR message to worklet
    */
   const clearAllSounds = (): void => {
+    post({
+      type: WorkletMessageType.CLEAR
+    })
+  }
+
+  /**
+   * Send SET_CHANNEL_LIMIT message to worklet
+   */
+  const setChannelLimit = (limit: number): void => {
+    channelLimit = limit
     if (workletNode) {
       workletNode.port.postMessage({
-        type: WorkletMessageType.CLEAR
+        type: WorkletMessageType.SET_CHANNEL_LIMIT,
+        limit
       })
     }
   }
@@ -335,6 +428,15 @@ export const createAudioOutput = (): AudioOutput => {
     underrunCallback = callback
   }
 
+  /**
+   * Register callback for mirrored channel state
+   */
+  const onChannelState = (
+    callback: (channels: ChannelState[]) => void
+  ): void => {
+    channelStateCallback = callback
+  }
+
   // Return public interface
   return {
     start,
@@ -342,11 +444,13 @@ export const createAudioOutput = (): AudioOutput => {
     isPlaying: getIsPlaying,
     getContext,
     setVolume,
-    playOnChannel,
+    requestSound,
     stopSound,
     clearAllSounds,
+    setChannelLimit,
     resumeContext,
     onSoundEnded,
-    onUnderrun
+    onUnderrun,
+    onChannelState
   }
 }
@@ -9,6 +9,7 @@
 
 // Main service factory
 export { createModernSoundService } from './service'
+export type { ModernSoundService } from './service'
 
 // Export types (users typically import from @/core/sound/types for SoundService)
 export type { MAX_CHANNELS } from './types'
@@ -5,6 +5,10 @@
  * Implements priority-based channel selection where higher-priority sounds
  * can interrupt lower-priority sounds.
  *
+ * The mixer is pure bookkeeping - it never touches generators. It is owned
+ * by the mixer worklet, which is the single authority for channel state;
+ * the main thread only sees the mirrored snapshots the worklet posts back.
+ *
  * Traced from: orig/Sources/Sound.c (priority system)
  */
 
@@ -14,7 +18,6 @@ import {
   SOUND_PRIORITY_DECAY,
   SINGLETON_SOUNDS
 } from '@/core/sound-shared'
-import type { SampleGenerator } from '@/core/sound-shared'
 import type { ChannelState, PlayRequest, StopRequest } from './types'
 import { MAX_CHANNELS } from './types'
 
@@ -30,7 +33,7 @@ export function createMixer(): {
   /** Allocate a channel for a sound, returns channel ID or null if can't play */
   allocateChannel(
     soundType: SoundType,
-    generator: SampleGenerator
+    tick?: number
   ): PlayRequest | null
 
   /** Stop a sound if it's playing */
@@ -47,6 +50,9 @@ export function createMixer(): {
 
   /** Get the channel currently playing a specific sound type (if any) */
   findChannelPlayingSound(soundType: SoundType): ChannelState | null
+
+  /** Restrict new allocations to the first `limit` channels */
+  setChannelLimit(limit: number): void
 } {
   // Initialize 8 channels, all inactive
   const channels: ChannelState[] = Array.from(
@@ -56,10 +62,13 @@ export function createMixer(): {
       soundType: SoundType.NO_SOUND,
       priority: 0,
       active: false,
-      generator: null
+      startTick: 0
     })
   )
 
+  // Number of channels new sounds may claim (quality governor can lower it)
+  let channelLimit = MAX_CHANNELS
+
   /**
    * Find an available channel or the lowest priority channel
    * Returns null if no suitable channel found (new sound priority too low)
@@ -69,7 +78,9 @@ export function createMixer(): {
     priority: number
   ): number | null {
     // First, try to find an inactive channel
-    const inactiveChannel = channels.find(ch => !ch.active)
+    const inactiveChannel = channels.find(
+      ch => !ch.active && ch.id < channelLimit
+    )
     if (inactiveChannel) {
       return inactiveChannel.id
     }
@@ -79,6 +90,8 @@ export function createMixer(): {
     let lowestPriority = priority // Only consider channels with lower priority
 
     for (const channel of channels) {
+      if (channel.id >= channelLimit) break
+
       if (channel.priority < lowestPriority) {
         lowestPriority = channel.priority
         lowestPriorityChannel = channel
@@ -105,12 +118,12 @@ export function createMixer(): {
    * 5. Otherwise, drop the new sound
    *
    * @param soundType - Type of sound to play
-   * @param generator - Generator for producing samples
+   * @param tick - Request tick from the main thread (recorded for debugging)
    * @returns PlayRequest if channel allocated, null if sound should be dropped
    */
   function allocateChannel(
     soundType: SoundType,
-    generator: SampleGenerator
+    tick = 0
   ): PlayRequest | null {
     // Special case: fuel blocks shield from playing
     // If shield is trying to play while fuel is active, drop the shield request
@@ -150,13 +163,13 @@ export function createMixer(): {
     channel.soundType = soundType
     channel.priority = priority
     channel.active = true
-    channel.generator = generator
+    channel.startTick = tick
 
     return {
       channelId,
       soundType,
       priority,
-      generator
+      tick
     }
   }
 
@@ -182,7 +195,7 @@ export function createMixer(): {
     channel.active = false
     channel.soundType = SoundType.NO_SOUND
     channel.priority = 0
-    channel.generator = null
+    channel.startTick = 0
 
     return { soundType }
   }
@@ -198,7 +211,7 @@ export function createMixer(): {
       channel.active = false
       channel.soundType = SoundType.NO_SOUND
       channel.priority = 0
-      channel.generator = null
+      channel.startTick = 0
     }
   }
 
@@ -219,7 +232,7 @@ export function createMixer(): {
     channel.active = false
     channel.soundType = SoundType.NO_SOUND
     channel.priority = 0
-    channel.generator = null
+    channel.startTick = 0
   }
 
   /**
@@ -229,7 +242,8 @@ export function createMixer(): {
    * Some sounds have their priority decrease over time, allowing
    * sounds of the same type to interrupt each other.
    *
-   * Should be called once per game frame.
+   * Should be called once per VBL (60Hz). The worklet drives this from
+   * the audio clock, once every CHUNK_SIZE rendered samples.
    */
   function updatePriorities(): void {
     for (const channel of channels) {
@@ -252,6 +266,18 @@ export function createMixer(): {
     return channels.find(ch => ch.active && ch.soundType === soundType) ?? null
   }
 
+  /**
+   * Restrict allocation to the first `limit` channels
+   *
+   * Sounds already playing above the limit are left to finish; they just
+   * can't be replaced. Used to shed mixing work on slow devices.
+   *
+   * @param limit - Number of usable channels (clamped to 1..MAX_CHANNELS)
+   */
+  function setChannelLimit(limit: number): void {
+    channelLimit = Math.max(1, Math.min(MAX_CHANNELS, Math.floor(limit)))
+  }
+
   return {
     getChannels: () => channels as ReadonlyArray<ChannelState>,
     allocateChannel,
@@ -259,6 +285,7 @@ export function createMixer(): {
     clearAll,
     markChannelEnded,
     updatePriorities,
-    findChannelPlayingSound
+    findChannelPlayingSound,
+    setChannelLimit
   }
 }
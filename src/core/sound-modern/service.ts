@@ -10,63 +10,29 @@
  * - Multiple bunker shots, explosions can play at same time
  * - Backward compatible API (implements exact same SoundService interface)
  *
+ * The mixer worklet is authoritative for channel allocation, priority decay
+ * and generator lifecycle. This service only sends fire-and-forget
+ * (soundType, tick, seed) requests and keeps a mirrored copy of channel
+ * state.
+ *
  * Traced from: orig/Sources/Sound.c (adapted for multi-channel)
  */
 
 import { createAudioOutput, type AudioOutput } from './audioOutput'
-import { createMixer } from './mixer'
 import type { SoundService } from '@/core/sound/types'
-import {
-  SoundType,
-  type SampleGenerator,
-  createFireGenerator,
-  createExplosionGenerator,
-  ExplosionType,
-  createThrusterGenerator,
-  createShieldGenerator,
-  createBunkerGenerator,
-  createSoftGenerator,
-  createFuelGenerator,
-  createCrackGenerator,
-  createFizzGenerator,
-  createEchoGenerator
-} from '@/core/sound-shared'
-
-// Vertical blanking interval for screen interrupts on original Mac
-const VERT_BLANK_PER_SEC = 60
+import { SoundType } from '@/core/sound-shared'
+import { RandomStream, streamSeed } from '@/core/shared/randomStreams'
+import type { ChannelState } from './types'
+import { MAX_CHANNELS } from './types'
 
 /**
- * Create a generator for a given sound type
+ * Modern sound service - the standard API plus a debug view of the
+ * channel state mirrored back from the mixer worklet
  */
-function createGeneratorForSound(soundType: SoundType): SampleGenerator {
-  switch (soundType) {
-    case SoundType.FIRE_SOUND:
-      return createFireGenerator()
-    case SoundType.EXP1_SOUND:
-      return createExplosionGenerator(ExplosionType.BUNKER)
-    case SoundType.THRU_SOUND:
-      return createThrusterGenerator()
-    case SoundType.BUNK_SOUND:
-      return createBunkerGenerator()
-    case SoundType.SOFT_SOUND:
-      return createSoftGenerator()
-    case SoundType.SHLD_SOUND:
-      return createShieldGenerator()
-    case SoundType.FUEL_SOUND:
-      return createFuelGenerator()
-    case SoundType.EXP2_SOUND:
-      return createExplosionGenerator(ExplosionType.SHIP)
-    case SoundType.EXP3_SOUND:
-      return createExplosionGenerator(ExplosionType.ALIEN)
-    case SoundType.CRACK_SOUND:
-      return createCrackGenerator()
-    case SoundType.FIZZ_SOUND:
-      return createFizzGenerator()
-    case SoundType.ECHO_SOUND:
-      return createEchoGenerator()
-    default:
-      throw new Error(`Unknown sound type: ${soundType}`)
-  }
+export type ModernSoundService = SoundService & {
+  getChannels(): ReadonlyArray<ChannelState>
+  setChannelLimit(limit: number): void
+  getUnderrunCount(): number
 }
 
 /**
@@ -76,16 +42,26 @@ function createGeneratorForSound(soundType: SoundType): SampleGenerator {
 export async function createModernSoundService(initialSettings: {
   volume: number
   muted: boolean
-}): Promise<SoundService> {
-  // Create mixer for channel management
-  const mixer = createMixer()
-
+}): Promise<ModernSoundService> {
   // Internal state for this instance
   let audioOutput: AudioOutput
   let isEngineRunning = false
   let isMuted = initialSettings.muted
   let currentVolume = initialSettings.volume
-  let decayIntervalId: NodeJS.Timeout | null = null
+
+  // Monotonic request counter, echoed back as ChannelState.startTick
+  let tick = 0
+
+  // Seed of the current frame and how many sounds it has requested so far
+  let gameSeed = 0
+  let frame = 0
+  let frameRequests = 0
+
+  // Last channel state reported by the worklet (debugging only)
+  let mirroredChannels: ReadonlyArray<ChannelState> = createIdleChannels()
+
+  // Total underruns reported by the worklet, for the quality governor
+  let underrunCount = 0
 
   try {
     // Create and initialize the audio output
@@ -94,35 +70,35 @@ export async function createModernSoundService(initialSettings: {
     // Apply initial volume
     audioOutput.setVolume(currentVolume)
 
-    // Handle sound ended events from worklet
-    audioOutput.onSoundEnded((channelId, _soundType) => {
-      // Notify mixer that this channel has ended
-      mixer.markChannelEnded(channelId)
+    // Mirror channel state from the worklet
+    audioOutput.onChannelState(channels => {
+      mirroredChannels = channels
     })
 
     // Handle underrun events for debugging
     audioOutput.onUnderrun((channelId, available, needed) => {
+      underrunCount++
       console.warn(
         `[ModernSoundService] Underrun on channel ${channelId}: ${available}/${needed} samples`
       )
     })
 
     /**
-     * Internal helper to play a sound
-     * @returns true if sound was played, false if blocked/dropped
+     * Internal helper to request a sound
+     *
+     * The worklet decides whether the sound actually plays (priority,
+     * singleton rules), so this is fire-and-forget.
      */
-    function playSound(soundType: SoundType): boolean {
-      // Ensure the decay timer is running when sounds are being played
-      ensureDecayTimer()
-
+    function playSound(soundType: SoundType): void {
       // Check if muted
       if (isMuted) {
-        return false
+        return
       }
 
       // Start the engine if not already running
       if (!isEngineRunning) {
-        // Lazy start on first sound
+        // Lazy start on first sound - the request below is queued by the
+        // audio output and delivered once the worklet is ready
         audioOutput
           .start()
           .then(() => {
@@ -135,53 +111,20 @@ export async function createModernSoundService(initialSettings: {
               err
             )
           })
-        return false // Don't play this time, will work next time
       }
 
-      // Create generator for this sound
-      const generator = createGeneratorForSound(soundType)
-
-      // Try to allocate a channel from the mixer
-      const request = mixer.allocateChannel(soundType, generator)
-
-      if (!request) {
-        // No channel available (all busy with higher priority sounds)
-        return false
-      }
-
-      // Send PLAY message to worklet
-      audioOutput.playOnChannel({
-        channelId: request.channelId,
-        soundType: request.soundType,
-        priority: request.priority
-      })
-
-      return true
-    }
-
-    /**
-     * Decay all channel priorities
-     * Matches the VBL-based priority decay from Sound.c do_*_sound() functions
-     */
-    function decayPriorities(): void {
-      mixer.updatePriorities()
-    }
-
-    /**
-     * Ensure the decay timer is running
-     * Starts a 60Hz timer if not already running (matches VBL timing from Sound.c:92-104)
-     */
-    function ensureDecayTimer(): void {
-      if (decayIntervalId === null) {
-        // VBL on classic Macs runs at 60.15Hz ≈ 16.67ms per tick
-        decayIntervalId = setInterval(() => {
-          decayPriorities()
-        }, 1000 / VERT_BLANK_PER_SEC) // ~16.67ms
-      }
+      tick += 1
+      const seed = streamSeed(
+        RandomStream.AUDIO,
+        gameSeed,
+        frame,
+        frameRequests++
+      )
+      audioOutput.requestSound({ soundType, tick, seed })
     }
 
     // Create the service instance
-    const serviceInstance: SoundService = {
+    const serviceInstance: ModernSoundService = {
       // Engine lifecycle
       startEngine: async (): Promise<void> => {
         // Don't start if muted (audio will start when unmuted)
@@ -210,11 +153,8 @@ export async function createModernSoundService(initialSettings: {
       },
 
       stopShipThrust: (): void => {
-        // Stop the sound if it's playing
-        const stopRequest = mixer.stopSound(SoundType.THRU_SOUND)
-        if (stopRequest) {
-          audioOutput.stopSound({ soundType: SoundType.THRU_SOUND })
-        }
+        // Worklet ignores the stop if thrust isn't playing
+        audioOutput.stopSound({ soundType: SoundType.THRU_SOUND })
       },
 
       playShipShield: (): void => {
@@ -222,11 +162,8 @@ export async function createModernSoundService(initialSettings: {
       },
 
       stopShipShield: (): void => {
-        // Stop the sound if it's playing
-        const stopRequest = mixer.stopSound(SoundType.SHLD_SOUND)
-        if (stopRequest) {
-          audioOutput.stopSound({ soundType: SoundType.SHLD_SOUND })
-        }
+        // Worklet ignores the stop if shield isn't playing
+        audioOutput.stopSound({ soundType: SoundType.SHLD_SOUND })
       },
 
       playShipExplosion: (): void => {
@@ -273,7 +210,12 @@ export async function createModernSoundService(initialSettings: {
       clearSound: (): void => {
         // Clear all channels
         audioOutput.clearAllSounds()
-        mixer.clearAll()
+      },
+
+      seedFrame: (seed: number, frameNumber: number): void => {
+        gameSeed = seed
+        frame = frameNumber
+        frameRequests = 0
       },
 
       setVolume: (volume: number): void => {
@@ -287,27 +229,26 @@ export async function createModernSoundService(initialSettings: {
           // Stop all sounds when muting
           audioOutput.stop()
           isEngineRunning = false
-          mixer.clearAll()
-        } else if (!muted) {
-          // When unmuting, clear state so new sounds can play
-          mixer.clearAll()
+          mirroredChannels = createIdleChannels()
         }
       },
 
-      // Cleanup method - stops sounds and timer but keeps audio output alive for reuse
-      cleanup: (): void => {
-        // Clear the decay timer
-        if (decayIntervalId) {
-          clearInterval(decayIntervalId)
-          decayIntervalId = null
-        }
+      getChannels: (): ReadonlyArray<ChannelState> => mirroredChannels,
 
+      setChannelLimit: (limit: number): void => {
+        audioOutput.setChannelLimit(limit)
+      },
+
+      getUnderrunCount: (): number => underrunCount,
+
+      // Cleanup method - stops sounds but keeps audio output alive for reuse
+      cleanup: (): void => {
         if (isEngineRunning) {
           audioOutput.stop()
         }
 
-        // Clear all channels
-        mixer.clearAll()
+        // A new worklet node starts with all channels idle
+        mirroredChannels = createIdleChannels()
 
         // Don't null out audioOutput - keep it alive for next game
         isEngineRunning = false
@@ -320,3 +261,16 @@ export async function createModernSoundService(initialSettings: {
     throw error
   }
 }
+
+/**
+ * Channel state as it looks before the worklet reports anything
+ */
+function createIdleChannels(): ChannelState[] {
+  return Array.from({ length: MAX_CHANNELS }, (_, i) => ({
+    id: i,
+    soundType: SoundType.NO_SOUND,
+    priority: 0,
+    active: false,
+    startTick: 0
+  }))
+}
@@ -7,7 +7,6 @@
  */
 
 import type { SoundType } from '@/core/sound-shared'
-import type { SampleGenerator } from '@/core/sound-shared'
 
 /**
  * Number of simultaneous audio channels supported by the mixer
@@ -17,6 +16,9 @@ export const MAX_CHANNELS = 8
 
 /**
  * Represents the state of a single audio channel
+ *
+ * The worklet owns the authoritative copy of this state; the main thread
+ * only holds mirrored snapshots for debugging.
  */
 export type ChannelState = {
   /** Channel index (0-7) */
@@ -31,8 +33,8 @@ export type ChannelState = {
   /** Whether this channel is currently active */
   active: boolean
 
-  /** Generator instance for this channel (null if inactive) */
-  generator: SampleGenerator | null
+  /** Tick of the request that claimed this channel (0 if inactive) */
+  startTick: number
 }
 
 /**
@@ -48,8 +50,8 @@ export type PlayRequest = {
   /** Initial priority */
   priority: number
 
-  /** Generator for producing samples */
-  generator: SampleGenerator
+  /** Tick of the originating request */
+  tick: number
 }
 
 /**
@@ -78,7 +80,7 @@ export type MixerConfig = {
  * Message types sent from main thread to worklet
  */
 export enum WorkletMessageType {
-  /** Start playing a sound on a channel */
+  /** Request a sound - the worklet decides whether and where it plays */
   PLAY = 'play',
 
   /** Stop a continuous sound if it's playing */
@@ -88,7 +90,10 @@ export enum WorkletMessageType {
   CLEAR = 'clear',
 
   /** Update global volume */
-  SET_VOLUME = 'setVolume'
+  SET_VOLUME = 'setVolume',
+
+  /** Limit how many channels new sounds may use */
+  SET_CHANNEL_LIMIT = 'setChannelLimit'
 }
 
 /**
@@ -99,17 +104,24 @@ export enum WorkletEventType {
   SOUND_ENDED = 'soundEnded',
 
   /** Buffer underrun occurred (for debugging) */
-  UNDERRUN = 'underrun'
+  UNDERRUN = 'underrun',
+
+  /** Snapshot of the worklet's channel state (for debugging) */
+  CHANNEL_STATE = 'channelState'
 }
 
 /**
  * Play message payload
+ *
+ * Fire-and-forget: channel allocation, singleton rules and priority
+ * decay all happen in the worklet, so the request carries no channel.
  */
 export type PlayMessage = {
   type: WorkletMessageType.PLAY
-  channelId: number
   soundType: SoundType
-  priority: number
+  tick: number
+  /** Seed for the generator's noise (see randomStreams) */
+  seed: number
 }
 
 /**
@@ -135,6 +147,14 @@ export type SetVolumeMessage = {
   volume: number
 }
 
+/**
+ * Set channel limit message payload
+ */
+export type SetChannelLimitMessage = {
+  type: WorkletMessageType.SET_CHANNEL_LIMIT
+  limit: number
+}
+
 /**
  * Union of all message types
  */
@@ -143,6 +163,7 @@ export type WorkletMessage =
   | StopMessage
   | ClearMessage
   | SetVolumeMessage
+  | SetChannelLimitMessage
 
 /**
  * Sound ended event payload
@@ -163,7 +184,17 @@ export type UnderrunEvent = {
   needed: number
 }
 
+/**
+ * Channel state event payload
+ *
+ * Posted whenever the worklet's channel allocation changes
+ */
+export type ChannelStateEvent = {
+  type: WorkletEventType.CHANNEL_STATE
+  channels: ChannelState[]
+}
+
 /**
  * Union of all event types
  */
-export type WorkletEvent = SoundEndedEvent | UnderrunEvent
+export type WorkletEvent = SoundEndedEvent | UnderrunEvent | ChannelStateEvent
@@ -7,8 +7,10 @@
  * Architecture:
  * - 8 independent audio channels (all for SFX in Phase 2)
  * - Each channel has own ring buffer + generator
- * - Main thread sends messages to control channel playback
- * - Worklet mixes all active channels and posts messages back when sounds end
+ * - Worklet owns channel allocation, singleton rules and priority decay
+ *   (via the shared mixer), so the main thread never builds generators
+ * - Main thread sends fire-and-forget (soundType, tick, seed) requests
+ * - Worklet mixes all active channels and mirrors channel state back
  *
  * Traced from: orig/Sources/Sound.c (adapted for multi-channel)
  */
@@ -32,6 +34,7 @@ import {
   createFizzGenerator,
   createEchoGenerator
 } from '@/core/sound-shared'
+import { createRandomStream } from '@/core/shared/randomStreams'
 import type {
   WorkletMessage,
   WorkletEvent,
@@ -39,11 +42,15 @@ import type {
   StopMessage
 } from '../types'
 import { WorkletMessageType, WorkletEventType, MAX_CHANNELS } from '../types'
+import { createMixer } from '../mixer'
 
 // Constants
 const CHUNK_SIZE = 370
 const BUFFER_SIZE = 8192 // Must be power of 2
 
+// Vertical blanking interval for screen interrupts on original Mac
+const VERT_BLANK_PER_SEC = 60
+
 /**
  * Represents the state of a single channel
  */
@@ -52,7 +59,10 @@ type ChannelData = {
   generator: SampleGenerator | null
   soundType: SoundType
   active: boolean
-  hasReportedEnded: boolean
+  /** The generator has ended and the buffer is playing out its tail */
+  draining: boolean
+  /** Samples of the tail still to play before the channel is freed */
+  tailSamples: number
 }
 
 /**
@@ -62,19 +72,33 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
   // 8 audio channels
   private channels: ChannelData[]
 
+  // Channel allocation and priority bookkeeping (authoritative copy)
+  private mixer: ReturnType<typeof createMixer>
+
+  // Priority decay runs on the audio clock, once per VBL worth of samples
+  private samplesPerDecay: number
+  private samplesUntilDecay: number
+
   // Performance tracking
   private totalCallbacks: number
 
   constructor() {
     super()
 
+    this.mixer = createMixer()
+
+    // 22200Hz / 60 = 370 samples, i.e. one CHUNK_SIZE per VBL
+    this.samplesPerDecay = Math.round(sampleRate / VERT_BLANK_PER_SEC)
+    this.samplesUntilDecay = this.samplesPerDecay
+
     // Initialize 8 channels
     this.channels = Array.from({ length: MAX_CHANNELS }, () => ({
       buffer: createRingBuffer(BUFFER_SIZE),
       generator: null,
       soundType: SoundType.NO_SOUND,
       active: false,
-      hasReportedEnded: false
+      draining: false,
+      tailSamples: 0
     }))
 
     // Fill all buffers with silence to prevent underruns on first callback
@@ -107,28 +131,37 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
         this.handleClear()
         break
 
+      case WorkletMessageType.SET_CHANNEL_LIMIT:
+        this.mixer.setChannelLimit(message.limit)
+        break
+
       default:
         console.warn('[MixerWorklet] Unknown message type:', message)
     }
   }
 
   /**
-   * Handle PLAY message - start playing a sound on a channel
+   * Handle PLAY message - allocate a channel and start playing a sound
+   *
+   * Requests that lose the priority contest (or hit a singleton that is
+   * already playing) are silently dropped, as in the original Sound.c.
    */
   private handlePlay(message: PlayMessage): void {
-    const { channelId, soundType } = message
+    const { soundType, tick, seed } = message
 
-    if (channelId < 0 || channelId >= MAX_CHANNELS) {
-      console.warn(`[MixerWorklet] Invalid channel ID: ${channelId}`)
+    const request = this.mixer.allocateChannel(soundType, tick)
+    if (!request) {
       return
     }
 
+    const { channelId } = request
     const channel = this.channels[channelId]!
 
     // Create the generator
-    const generator = this.createGenerator(soundType)
+    const generator = this.createGenerator(soundType, seed)
     if (!generator) {
       console.warn(`[MixerWorklet] Failed to create generator for ${soundType}`)
+      this.mixer.markChannelEnded(channelId)
       return
     }
 
@@ -143,7 +176,8 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
     channel.generator = generator
     channel.soundType = soundType
     channel.active = true
-    channel.hasReportedEnded = false
+    channel.draining = false
+    channel.tailSamples = 0
 
     /**
      * Critical timing: clear() must be called immediately before generateChunk() to ensure zero-latency sound start.
@@ -153,6 +187,8 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
      */
     channel.buffer.clear()
     this.generateChunk(channelId)
+
+    this.postChannelState()
   }
 
   /**
@@ -161,6 +197,11 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
   private handleStop(message: StopMessage): void {
     const { soundType } = message
 
+    if (!this.mixer.stopSound(soundType)) {
+      // Sound not currently playing
+      return
+    }
+
     // Find the channel playing this sound and stop it
     for (let i = 0; i < MAX_CHANNELS; i++) {
       const channel = this.channels[i]!
@@ -168,44 +209,64 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
         channel.active = false
         channel.generator = null
         channel.soundType = SoundType.NO_SOUND
-        channel.hasReportedEnded = false
+        channel.draining = false
         channel.buffer.reset()
       }
     }
+
+    this.postChannelState()
   }
 
   /**
    * Handle CLEAR message - clear all channels
    */
   private handleClear(): void {
+    this.mixer.clearAll()
+
     for (const channel of this.channels) {
       channel.active = false
       channel.generator = null
       channel.soundType = SoundType.NO_SOUND
-      channel.hasReportedEnded = false
+      channel.draining = false
       channel.buffer.reset()
     }
+
+    this.postChannelState()
   }
 
   /**
-   * Create a generator for a given sound type
+   * Mirror the mixer's channel state back to the main thread
    */
-  private createGenerator(soundType: SoundType): SampleGenerator | null {
+  private postChannelState(): void {
+    this.port.postMessage({
+      type: WorkletEventType.CHANNEL_STATE,
+      channels: this.mixer.getChannels().map(ch => ({ ...ch }))
+    } as WorkletEvent)
+  }
+
+  /**
+   * Create a generator for a given sound type, seeding its noise
+   */
+  private createGenerator(
+    soundType: SoundType,
+    seed: number
+  ): SampleGenerator | null {
+    const random = createRandomStream(seed)
     switch (soundType) {
       case SoundType.NO_SOUND:
         return createSilenceGenerator()
       case SoundType.FIRE_SOUND:
         return createFireGenerator()
       case SoundType.THRU_SOUND:
-        return createThrusterGenerator()
+        return createThrusterGenerator(random)
       case SoundType.SHLD_SOUND:
         return createShieldGenerator()
       case SoundType.EXP1_SOUND:
-        return createExplosionGenerator(ExplosionType.BUNKER)
+        return createExplosionGenerator(ExplosionType.BUNKER, random)
       case SoundType.EXP2_SOUND:
-        return createExplosionGenerator(ExplosionType.SHIP)
+        return createExplosionGenerator(ExplosionType.SHIP, random)
       case SoundType.EXP3_SOUND:
-        return createExplosionGenerator(ExplosionType.ALIEN)
+        return createExplosionGenerator(ExplosionType.ALIEN, random)
       case SoundType.BUNK_SOUND:
         return createBunkerGenerator()
       case SoundType.SOFT_SOUND:
@@ -213,11 +274,11 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
       case SoundType.FUEL_SOUND:
         return createFuelGenerator()
       case SoundType.CRACK_SOUND:
-        return createCrackGenerator()
+        return createCrackGenerator(random)
       case SoundType.FIZZ_SOUND:
-        return createFizzGenerator()
+        return createFizzGenerator(random)
       case SoundType.ECHO_SOUND:
-        return createEchoGenerator()
+        return createEchoGenerator(random)
       default:
         console.warn(`[MixerWorklet] Unknown sound type: ${soundType}`)
         return createSilenceGenerator()
@@ -241,26 +302,18 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
     // Generate chunk from generator
     const chunk = channel.generator.generateChunk()
 
-    // Check if sound has ended
-    if (!channel.hasReportedEnded && channel.generator.hasEnded()) {
-      channel.hasReportedEnded = true
-
-      // Notify main thread
-      this.port.postMessage({
-        type: WorkletEventType.SOUND_ENDED,
-        channelId,
-        soundType: channel.soundType
-      } as WorkletEvent)
+    // Add chunk to ring buffer
+    const written = channel.buffer.writeSamples(chunk)
 
-      // Clear generator but keep channel active so buffer can drain
-      // Channel will become inactive when buffer is empty
+    // Once the sound has ended, stop generating but keep the channel
+    // allocated until the samples already buffered have played, so a new
+    // sound on it cannot clear() away the end of this one
+    if (channel.generator.hasEnded()) {
       channel.generator = null
-      channel.soundType = SoundType.NO_SOUND
+      channel.draining = true
+      channel.tailSamples = channel.buffer.getAvailableSamples()
     }
 
-    // Add chunk to ring buffer
-    const written = channel.buffer.writeSamples(chunk)
-
     // Track underruns if we couldn't write the full chunk
     if (written < chunk.length) {
       this.port.postMessage({
@@ -272,6 +325,29 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
     }
   }
 
+  /**
+   * Free a channel whose tail has finished playing
+   */
+  private finishChannel(channelId: number): void {
+    const channel = this.channels[channelId]!
+
+    // Notify main thread
+    this.port.postMessage({
+      type: WorkletEventType.SOUND_ENDED,
+      channelId,
+      soundType: channel.soundType
+    } as WorkletEvent)
+
+    channel.active = false
+    channel.soundType = SoundType.NO_SOUND
+    channel.draining = false
+    channel.tailSamples = 0
+    channel.buffer.reset()
+
+    this.mixer.markChannelEnded(channelId)
+    this.postChannelState()
+  }
+
   /**
    * Ensure enough samples are available in a channel
    */
@@ -290,8 +366,7 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
    * This is where the mixing happens:
    * 1. Read samples from all active channels
    * 2. Sum them together
-   * 3. Apply global volume
-   * 4. Clip to prevent distortion
+   * 3. Decay channel priorities on the audio clock
    */
   process(
     _inputs: Float32Array[][],
@@ -333,11 +408,25 @@ class MixerAudioProcessor extends AudioWorkletProcessor {
         for (let j = 0; j < sampleCount; j++) {
           outputChannel[j]! += channelSamples[j]!
         }
+
+        if (channel.draining) {
+          channel.tailSamples -= sampleCount
+          if (channel.tailSamples <= 0) {
+            this.finishChannel(i)
+          }
+        }
       }
 
       // No clipping - matches original system behavior
       // Volume and any necessary limiting handled by GainNode in main thread
 
+      // Decay priorities once per VBL (Sound.c:92-104)
+      this.samplesUntilDecay -= sampleCount
+      while (this.samplesUntilDecay <= 0) {
+        this.mixer.updatePriorities()
+        this.samplesUntilDecay += this.samplesPerDecay
+      }
+
       // Copy to other channels if stereo
       for (let channel = 1; channel < output.length; channel++) {
         output[channel]!.set(outputChannel)
@@ -28,12 +28,16 @@ import type { SampleGenerator } from '../sampleGenerator'
 import { CHUNK_SIZE, CENTER_VALUE } from '../sampleGenerator'
 import { HISS_RANDS } from './hissRandsData'
 import { build68kArch } from '@lib/asm/emulator'
+import type { RandomService } from '@/core/shared/RandomService'
+import { createRandomStream } from '@/core/shared/randomStreams'
 
 // Constants from original
 const SNDBUFLEN = 370
 const CRACK_COUNT_START = 6 // From Sound.c:514
 
-export const createCrackGenerator = (): SampleGenerator => {
+export const createCrackGenerator = (
+  random: RandomService = createRandomStream(0)
+): SampleGenerator => {
   // Create 68K emulator context
   const asm = build68kArch()
 
@@ -68,7 +72,7 @@ export const createCrackGenerator = (): SampleGenerator => {
     crackcount--
     if (crackcount > 0) {
       // vals = hiss_rands + (Random() & 31)
-      const valsIndex = Math.floor(Math.random() * 32) & 31
+      const valsIndex = random.rnumber(32) & 31
       let vals = valsIndex
 
       // move.l soundbuffer(A5), A0
@@ -28,6 +28,8 @@ import type { SampleGenerator } from '../sampleGenerator'
 import { CHUNK_SIZE, CENTER_VALUE } from '../sampleGenerator'
 import { HISS_RANDS } from './hissRandsData'
 import { build68kArch } from '@lib/asm/emulator'
+import type { RandomService } from '@/core/shared/RandomService'
+import { createRandomStream } from '@/core/shared/randomStreams'
 
 // Constants from original
 const SNDBUFLEN = 370
@@ -36,7 +38,9 @@ const ECHO_COUNT_START = 20 * 6 - 1 // From Sound.c:521 = 119
 // Echo strength values for each stage
 const ECHOSTRS = [1, 2, 5, 9, 19, 37]
 
-export const createEchoGenerator = (): SampleGenerator => {
+export const createEchoGenerator = (
+  random: RandomService = createRandomStream(0)
+): SampleGenerator => {
   // Create 68K emulator context
   const asm = build68kArch()
 
@@ -88,7 +92,7 @@ export const createEchoGenerator = (): SampleGenerator => {
         const amp = 128 - (((15 - c1) * ECHOSTRS[c2]!) >> 4)
 
         // vals = hiss_rands + (Random() & 31)
-        const valsIndex = Math.floor(Math.random() * 32) & 31
+        const valsIndex = random.rnumber(32) & 31
         let vals = valsIndex
 
         // move.l soundbuffer(A5), A0
@@ -30,6 +30,8 @@
 import type { SampleGenerator } from '../sampleGenerator'
 import { CHUNK_SIZE, CENTER_VALUE } from '../sampleGenerator'
 import { build68kArch } from '@lib/asm/emulator'
+import type { RandomService } from '@/core/shared/RandomService'
+import { createRandomStream } from '@/core/shared/randomStreams'
 
 // Constants from original
 const SNDBUFLEN = 370
@@ -63,7 +65,8 @@ const EXPLOSION_PARAMS = {
 }
 
 export const createExplosionGenerator = (
-  type: ExplosionType
+  type: ExplosionType,
+  random: RandomService = createRandomStream(0)
 ): SampleGenerator => {
   // Create 68K emulator context
   const asm = build68kArch()
@@ -83,7 +86,7 @@ export const createExplosionGenerator = (
   // Original generates 64 random values between EXPL_LO_PER and EXPL_LO_PER+EXPL_ADD_PER
   const expl_rands = new Uint8Array(64)
   for (let i = 0; i < 64; i++) {
-    expl_rands[i] = EXPL_LO_PER + Math.floor(Math.random() * EXPL_ADD_PER)
+    expl_rands[i] = EXPL_LO_PER + random.rnumber(EXPL_ADD_PER)
   }
 
   // Auto-start on creation for testing
@@ -108,7 +111,7 @@ export const createExplosionGenerator = (
 
     // Implementation of the assembly code
     // pers = expl_rands + (Random() & 63)
-    const persIndex = Math.floor(Math.random() * 64) & 63
+    const persIndex = random.rnumber(64) & 63
     let pers = persIndex
 
     // move.l soundbuffer(A5), A0
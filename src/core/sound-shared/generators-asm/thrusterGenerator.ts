@@ -30,13 +30,17 @@
 import type { SampleGenerator } from '../sampleGenerator'
 import { CHUNK_SIZE, CENTER_VALUE } from '../sampleGenerator'
 import { build68kArch } from '@lib/asm/emulator'
+import type { RandomService } from '@/core/shared/RandomService'
+import { createRandomStream } from '@/core/shared/randomStreams'
 
 // Constants from original
 const SNDBUFLEN = 370
 const THRU_LO_AMP = 64
 const THRU_ADD_AMP = 128
 
-export const createThrusterGenerator = (): SampleGenerator => {
+export const createThrusterGenerator = (
+  random: RandomService = createRandomStream(0)
+): SampleGenerator => {
   // Create 68K emulator context
   const asm = build68kArch()
 
@@ -51,7 +55,7 @@ export const createThrusterGenerator = (): SampleGenerator => {
   // Original generates 64 random values between THRU_LO_AMP and THRU_LO_AMP+THRU_ADD_AMP
   const thru_rands = new Uint8Array(64)
   for (let i = 0; i < 64; i++) {
-    thru_rands[i] = THRU_LO_AMP + Math.floor(Math.random() * THRU_ADD_AMP)
+    thru_rands[i] = THRU_LO_AMP + random.rnumber(THRU_ADD_AMP)
   }
 
   // Auto-start on creation for testing (thruster should repeat while held)
@@ -76,7 +80,7 @@ export const createThrusterGenerator = (): SampleGenerator => {
 
     // Implementation of the assembly code
     // pers = thru_rands + (Random() & 63)
-    const persIndex = Math.floor(Math.random() * 64) & 63
+    const persIndex = random.rnumber(64) & 63
     let pers = persIndex
 
     // Save count register
@@ -8,6 +8,9 @@
  * architecture while adapting to modern browser audio APIs.
  */
 
+import type { RandomService } from '@/core/shared/RandomService'
+import { createRandomStream } from '@/core/shared/randomStreams'
+
 /**
  * Sample rate of the original Mac game audio
  */
@@ -118,14 +121,16 @@ export const buildSineWaveGenerator = (frequency: number): SampleGenerator => {
 /**
  * Builder for white noise generator - produces random samples
  */
-export const buildWhiteNoiseGenerator: SampleGeneratorBuilder = () => {
+export const buildWhiteNoiseGenerator = (
+  random: RandomService = createRandomStream(0)
+): SampleGenerator => {
   return {
     generateChunk(): Uint8Array {
       const chunk = new Uint8Array(CHUNK_SIZE)
 
       for (let i = 0; i < CHUNK_SIZE; i++) {
         // Generate random value 0-255
-        chunk[i] = Math.floor(Math.random() * 256)
+        chunk[i] = random.rnumber(256)
       }
 
       return chunk
@@ -49,8 +49,9 @@ export type AudioOutput = {
 
   /**
    * Send message to worklet to set generator
+   * @param seed - Seed for the generator's noise (see randomStreams)
    */
-  setGenerator(generatorType: string, onEnded?: () => void): void
+  setGenerator(generatorType: string, seed: number, onEnded?: () => void): void
 
   /**
    * Send message to worklet to clear sound
@@ -259,14 +260,19 @@ export const createAudioOutput = (): AudioOutput => {
   /**
    * Send message to worklet to set generator
    */
-  const setGenerator = (generatorType: string, onEnded?: () => void): void => {
+  const setGenerator = (
+    generatorType: string,
+    seed: number,
+    onEnded?: () => void
+  ): void => {
     // Store the callback to invoke when worklet reports sound ended
     onSoundEndedCallback = onEnded || null
 
     if (workletNode) {
       workletNode.port.postMessage({
         type: 'setGenerator',
-        generatorType
+        generatorType,
+        seed
       })
     }
   }
@@ -12,6 +12,7 @@ import {
   SOUND_PRIORITIES,
   SOUND_PRIORITY_DECAY
 } from '@/core/sound-shared'
+import { RandomStream, streamSeed } from '@/core/shared/randomStreams'
 
 // Vertical blanking interval for screen interrupts on original Mac
 const VERT_BLANK_PER_SEC = 60
@@ -51,6 +52,10 @@ export async function createSoundService(initialSettings: {
   let isMuted = initialSettings.muted
   let currentVolume = initialSettings.volume
   let decayIntervalId: NodeJS.Timeout | null = null
+  // Seed of the current frame and how many sounds it has requested so far
+  let gameSeed = 0
+  let frame = 0
+  let frameRequests = 0
 
   try {
     // Create and initialize the audio output
@@ -62,7 +67,10 @@ export async function createSoundService(initialSettings: {
     /**
      * Internal helper to play a sound by engine type
      */
-    async function playSoundByType(soundType: GameSoundType): Promise<void> {
+    async function playSoundByType(
+      soundType: GameSoundType,
+      seed = 0
+    ): Promise<void> {
       if (!audioOutput) return
 
       // Try to resume audio context on any play attempt (in case it's suspended)
@@ -89,13 +97,13 @@ export async function createSoundService(initialSettings: {
 
       if (needsCallback) {
         // Add callback to clear state when sound ends (like original's clear_sound())
-        audioOutput.setGenerator(soundType, () => {
+        audioOutput.setGenerator(soundType, seed, () => {
           currentSound = null
           currentSoundPriority = 0
         })
       } else {
         // Continuous sounds and silence play without callbacks
-        audioOutput.setGenerator(soundType)
+        audioOutput.setGenerator(soundType, seed)
       }
     }
 
@@ -123,8 +131,11 @@ export async function createSoundService(initialSettings: {
         }
       }
 
-      // Play the sound
-      playSoundByType(engineType)
+      // Play the sound, seeded by its place among this frame's requests
+      playSoundByType(
+        engineType,
+        streamSeed(RandomStream.AUDIO, gameSeed, frame, frameRequests++)
+      )
 
       // Track current sound and priority for ALL sounds
       currentSound = soundType
@@ -254,6 +265,12 @@ export async function createSoundService(initialSettings: {
       // Control methods
       clearSound: (): void => clearCurrentSound(),
 
+      seedFrame: (seed: number, frameNumber: number): void => {
+        gameSeed = seed
+        frame = frameNumber
+        frameRequests = 0
+      },
+
       setVolume: (volume: number): void => {
         currentVolume = volume
         audioOutput.setVolume(volume)
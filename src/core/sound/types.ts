@@ -56,6 +56,9 @@ export type SoundService = {
   setVolume(volume: number): void
   setMuted(muted: boolean): void
 
+  // Seed the noise of sounds played this frame (see randomStreams)
+  seedFrame(gameSeed: number, frame: number): void
+
   // Engine lifecycle
   startEngine(): Promise<void> // Pre-start audio engine to eliminate first-sound delay
   cleanup(): void
@@ -33,6 +33,7 @@ import {
   createFizzGenerator,
   createEchoGenerator
 } from '@/core/sound-shared'
+import { createRandomStream } from '@/core/shared/randomStreams'
 
 // Constants
 const CHUNK_SIZE = 370
@@ -42,7 +43,7 @@ const BUFFER_SIZE = 8192 // Must be power of 2
  * Message types from main thread to worklet
  */
 type MainToWorkletMessage =
-  | { type: 'setGenerator'; generatorType: string }
+  | { type: 'setGenerator'; generatorType: string; seed: number }
   | { type: 'clearSound' }
 
 /**
@@ -91,7 +92,7 @@ class BasicAudioProcessor extends AudioWorkletProcessor {
   private handleMessage(message: MainToWorkletMessage): void {
     switch (message.type) {
       case 'setGenerator':
-        this.setGenerator(message.generatorType)
+        this.setGenerator(message.generatorType, message.seed)
         break
 
       case 'clearSound':
@@ -103,9 +104,10 @@ class BasicAudioProcessor extends AudioWorkletProcessor {
   }
 
   /**
-   * Set the current generator based on type string
+   * Set the current generator based on type string, seeding its noise
    */
-  private setGenerator(generatorType: string): void {
+  private setGenerator(generatorType: string, seed: number): void {
+    const random = createRandomStream(seed)
     // Create the appropriate generator based on the sound type
     switch (generatorType) {
       case 'silence':
@@ -115,19 +117,28 @@ class BasicAudioProcessor extends AudioWorkletProcessor {
         this.currentGenerator = createFireGenerator()
         break
       case 'thruster':
-        this.currentGenerator = createThrusterGenerator()
+        this.currentGenerator = createThrusterGenerator(random)
         break
       case 'shield':
         this.currentGenerator = createShieldGenerator()
         break
       case 'explosionBunker':
-        this.currentGenerator = createExplosionGenerator(ExplosionType.BUNKER)
+        this.currentGenerator = createExplosionGenerator(
+          ExplosionType.BUNKER,
+          random
+        )
         break
       case 'explosionShip':
-        this.currentGenerator = createExplosionGenerator(ExplosionType.SHIP)
+        this.currentGenerator = createExplosionGenerator(
+          ExplosionType.SHIP,
+          random
+        )
         break
       case 'explosionAlien':
-        this.currentGenerator = createExplosionGenerator(ExplosionType.ALIEN)
+        this.currentGenerator = createExplosionGenerator(
+          ExplosionType.ALIEN,
+          random
+        )
         break
       case 'bunker':
         this.currentGenerator = createBunkerGenerator()
@@ -139,13 +150,13 @@ class BasicAudioProcessor extends AudioWorkletProcessor {
         this.currentGenerator = createFuelGenerator()
         break
       case 'crack':
-        this.currentGenerator = createCrackGenerator()
+        this.currentGenerator = createCrackGenerator(random)
         break
       case 'fizz':
-        this.currentGenerator = createFizzGenerator()
+        this.currentGenerator = createFizzGenerator(random)
         break
       case 'echo':
-        this.currentGenerator = createEchoGenerator()
+        this.currentGenerator = createEchoGenerator(random)
         break
       default:
         console.warn(`Unknown generator type: ${generatorType}`)
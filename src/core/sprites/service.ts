@@ -121,8 +121,7 @@ export async function createSpriteService(assetPaths: {
     throw new Error('Failed to load sprite resource')
   }
 
-  const arrayBuffer = await response.arrayBuffer()
-  const allSprites = extractAllSprites(arrayBuffer)
+  const spriteResource = await response.arrayBuffer()
 
   // Load status bar template
   const statusBarResponse = await fetch(assetPaths.statusBarResource)
@@ -130,33 +129,57 @@ export async function createSpriteService(assetPaths: {
     throw new Error('Failed to load status bar resource')
   }
 
-  const statusBarBuffer = await statusBarResponse.arrayBuffer()
-
-  // Decompress status bar (24 rows as per SBARHT)
-  const statusBarData = expandTitlePage(statusBarBuffer, 24)
-
-  // Convert to MonochromeBitmap (512 pixels wide, 24 pixels tall)
-  const statusBarTemplate = createMonochromeBitmap(512, 24)
-  statusBarTemplate.data.set(statusBarData)
+  const statusBarResource = await statusBarResponse.arrayBuffer()
 
   // Load title page if provided
-  let titlePage: MonochromeBitmap | null = null
+  let titlePageResource: ArrayBuffer | null = null
   if (assetPaths.titlePageResource) {
     try {
       const titlePageResponse = await fetch(assetPaths.titlePageResource)
       if (titlePageResponse.ok) {
-        const titlePageBuffer = await titlePageResponse.arrayBuffer()
-        // Decompress title page (342 rows as per SCRHT)
-        const titlePageData = expandTitlePage(titlePageBuffer, 342)
-        // Convert to MonochromeBitmap (512 pixels wide, 342 pixels tall)
-        titlePage = createMonochromeBitmap(512, 342)
-        titlePage.data.set(titlePageData)
+        titlePageResource = await titlePageResponse.arrayBuffer()
       }
     } catch (error) {
       console.warn('Failed to load title page resource:', error)
     }
   }
 
+  return createSpriteServiceFromResources({
+    spriteResource,
+    statusBarResource,
+    titlePageResource
+  })
+}
+
+/**
+ * Creates the full sprite service from already-loaded resource files
+ *
+ * Used by createSpriteService after fetching, and directly by headless
+ * tools (e.g. render tests) that read the files from disk.
+ */
+export function createSpriteServiceFromResources(resources: {
+  spriteResource: ArrayBuffer
+  statusBarResource: ArrayBuffer
+  titlePageResource?: ArrayBuffer | null
+}): SpriteService {
+  const allSprites = extractAllSprites(resources.spriteResource)
+
+  // Decompress status bar (24 rows as per SBARHT)
+  const statusBarData = expandTitlePage(resources.statusBarResource, 24)
+
+  // Convert to MonochromeBitmap (512 pixels wide, 24 pixels tall)
+  const statusBarTemplate = createMonochromeBitmap(512, 24)
+  statusBarTemplate.data.set(statusBarData)
+
+  let titlePage: MonochromeBitmap | null = null
+  if (resources.titlePageResource) {
+    // Decompress title page (342 rows as per SCRHT)
+    const titlePageData = expandTitlePage(resources.titlePageResource, 342)
+    // Convert to MonochromeBitmap (512 pixels wide, 342 pixels tall)
+    titlePage = createMonochromeBitmap(512, 342)
+    titlePage.data.set(titlePageData)
+  }
+
   // Pre-compute all sprite data at initialization
   const storage = precomputeAllSprites(allSprites, statusBarTemplate, titlePage)
 
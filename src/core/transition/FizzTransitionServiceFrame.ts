@@ -12,6 +12,7 @@ import { starmapPixelsToBitmap } from '@render/transition/starmapToBitmap'
 import { advanceLFSR, shouldSkipSeed } from './lfsrUtils'
 import { SCRWTH, VIEWHT, SBARHT, SBARSIZE } from '@/core/screen'
 import type { MonochromeBitmap } from '@/lib/bitmap'
+import type { RandomService } from '@/core/shared'
 
 /**
  * Service type for managing Frame-based fizz transitions
@@ -22,7 +23,8 @@ export type FizzTransitionServiceFrame = {
     fromFrame: Frame,
     shipInfo: { x: number; y: number; rotation: number } | null,
     starCount: number,
-    durationFrames: number
+    durationFrames: number,
+    random: RandomService
   ): void
 
   /** Get drawables for next frame of progressive reveal (returns complete frame) */
@@ -158,7 +160,8 @@ export function createFizzTransitionServiceFrame(
       fromFrame: Frame,
       ship: { x: number; y: number; rotation: number } | null,
       starCount: number,
-      duration: number
+      duration: number,
+      random: RandomService
     ): void {
       // Find all ship-related drawables in the fromFrame
       shipDrawables = []
@@ -193,7 +196,7 @@ export function createFizzTransitionServiceFrame(
       }
 
       // Generate random star coordinates and create "to" bitmap (same as original)
-      const starPixels = generateStarmapPixels(starCount)
+      const starPixels = generateStarmapPixels(starCount, random)
       toBitmap = starmapPixelsToBitmap(starPixels)
 
       // Reset accumulated pixels (like cloning workingBitmap in original)
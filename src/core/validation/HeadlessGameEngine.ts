@@ -11,13 +11,17 @@ import { TOTAL_INITIAL_LIVES } from '@core/ship'
 type HeadlessGameEngine = {
   step: (frameCount: number, controls: ControlMatrix) => void
   getFinalState: () => GameRootState | null
+  /** The level the current transition will load, wrapping to level 1 */
+  getNextLevel: () => number
 }
 
 const createHeadlessGameEngine = (
   store: HeadlessStore,
   galaxyService: GalaxyService,
   randomService: RandomService,
-  galaxyId: string
+  galaxyId: string,
+  // Called when a transition ends, for callers that draw the fizz
+  onTransitionReset?: () => void
 ): HeadlessGameEngine => {
   // Track fizz state to simulate correct duration in headless mode
   let fizzFramesElapsed = 0
@@ -38,6 +42,7 @@ const createHeadlessGameEngine = (
     reset: (): void => {
       // Reset fizz frame counter
       fizzFramesElapsed = 0
+      onTransitionReset?.()
     }
   }
 
@@ -100,6 +105,13 @@ const createHeadlessGameEngine = (
     },
     getFinalState: (): GameRootState | null => {
       return capturedFinalState
+    },
+    getNextLevel: (): number => {
+      // As transitionToNextLevel picks it
+      const { currentlevel } = store.getState().status
+      return currentlevel >= galaxyService.getHeader().planets
+        ? 1
+        : currentlevel + 1
     }
   }
 }
@@ -0,0 +1,234 @@
+import { describe, it, expect } from 'vitest'
+import { join } from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import { createSpriteServiceNode } from '@core/sprites/createSpriteServiceNode'
+import { createRandomService } from '@/core/shared'
+import { createCollisionService } from '@core/collision'
+import { ControlAction, type ControlMatrix } from '@/core/controls'
+import { createRecordingService, type GameRecording } from '@core/recording'
+import { loadLevel } from '@core/game'
+import { SCRWTH, VIEWHT } from '@core/screen'
+import { createHeadlessStore } from './createHeadlessStore'
+import { createHeadlessGameEngine } from './HeadlessGameEngine'
+import { createRecordingValidator } from './RecordingValidator'
+import {
+  createStreamingValidator,
+  type RecordingChunk
+} from './StreamingValidator'
+
+const PUBLIC_DIR = join(__dirname, '../../game/public')
+const GALAXY_ID = 'test-galaxy'
+const FRAMES = 380
+
+const galaxyService = createGalaxyServiceNode(
+  join(PUBLIC_DIR, 'release_galaxy.bin')
+)
+const spriteService = createSpriteServiceNode(join(PUBLIC_DIR, 'rsrc_260.bin'))
+
+const createHeadless = (): {
+  store: ReturnType<typeof createHeadlessStore>
+  engine: ReturnType<typeof createHeadlessGameEngine>
+  recordingService: ReturnType<typeof createRecordingService>
+} => {
+  const randomService = createRandomService()
+  const recordingService = createRecordingService()
+  const collisionService = createCollisionService()
+  collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+  const store = createHeadlessStore(
+    {
+      galaxyService,
+      randomService,
+      recordingService,
+      collisionService,
+      spriteService
+    },
+    1
+  )
+  const engine = createHeadlessGameEngine(
+    store,
+    galaxyService,
+    randomService,
+    GALAXY_ID
+  )
+  return { store, engine, recordingService }
+}
+
+// Turn, thrust and fire in a fixed pattern, changing every few frames. The
+// ship crashes twice within FRAMES but the game is not over when it ends
+const controlsAt = (frame: number): ControlMatrix => {
+  const controls = Object.fromEntries(
+    Object.values(ControlAction).map(action => [action, false])
+  ) as ControlMatrix
+  const phase = Math.floor(frame / 7) % 6
+  controls.thrust = phase === 1 || phase === 4
+  controls.left = phase === 2
+  controls.right = phase === 5
+  controls.fire = frame % 11 < 3
+  return controls
+}
+
+const record = (
+  controlsFor: (frame: number) => ControlMatrix = controlsAt
+): GameRecording => {
+  const { store, engine, recordingService } = createHeadless()
+  recordingService.startRecording({
+    engineVersion: 1,
+    galaxyId: GALAXY_ID,
+    startLevel: 1,
+    timestamp: 0,
+    initialState: { lives: store.getState().ship.lives }
+  })
+  // eslint-disable-next-line @typescript-eslint/no-explicit-any
+  void store.dispatch(loadLevel(1) as any)
+
+  for (let frame = 0; frame < FRAMES; frame++) {
+    recordingService.recordFrame(frame, controlsFor(frame), store.getState())
+    engine.step(frame, controlsFor(frame))
+  }
+  return recordingService.stopRecording(store.getState())!
+}
+
+const chunksOf = (
+  recording: GameRecording,
+  size: number
+): RecordingChunk[] => {
+  const chunks: RecordingChunk[] = []
+  for (let start = 0; start < FRAMES; start += size) {
+    const inFrames = ({ frame }: { frame: number }): boolean =>
+      frame >= start && frame < start + size
+    chunks.push({
+      inputs: recording.inputs.filter(inFrames),
+      snapshots: recording.snapshots.filter(inFrames),
+      throughFrame: start + size - 1
+    })
+  }
+  return chunks
+}
+
+describe('createStreamingValidator', () => {
+  const recording = record()
+  const { inputs, snapshots, fullSnapshots, finalState, ...header } = recording
+
+  it('validates chunk by chunk with the same report as a whole recording', () => {
+    const whole = createHeadless()
+    const expected = createRecordingValidator(
+      whole.engine,
+      whole.store,
+      whole.recordingService
+    ).validate(recording)
+    expect(expected.success).toBe(true)
+    expect(expected.snapshotsChecked).toBeGreaterThan(1)
+
+    const streamed = createHeadless()
+    const validator = createStreamingValidator(
+      streamed.engine,
+      streamed.store,
+      streamed.recordingService
+    )
+    validator.start(header)
+    let framesSoFar = 0
+    for (const chunk of chunksOf(recording, 64)) {
+      const progress = validator.push(chunk)
+      expect(progress.framesValidated).toBeGreaterThanOrEqual(framesSoFar)
+      framesSoFar = progress.framesValidated
+    }
+
+    expect(validator.finish(finalState)).toEqual(expected)
+    expect(streamed.store.getState()).toEqual(whole.store.getState())
+  })
+
+  it('rejects a run at the first mismatching snapshot', () => {
+    const tampered = snapshots.map(snapshot =>
+      snapshot.frame === 200 ? { ...snapshot, hash: 'bad' } : snapshot
+    )
+
+    const { store, engine, recordingService } = createHeadless()
+    const validator = createStreamingValidator(engine, store, recordingService)
+    validator.start(header)
+
+    const chunks = chunksOf({ ...recording, snapshots: tampered }, 64)
+    const progress = chunks.map(chunk => validator.push(chunk))
+
+    // Chunk 3 holds frame 200; nothing after it is simulated
+    expect(progress[2]!.rejected).toBe(false)
+    expect(progress[3]).toEqual({
+      framesValidated: 200,
+      snapshotsChecked: 3,
+      divergenceFrame: 200,
+      rejected: true
+    })
+    expect(progress[progress.length - 1]).toEqual(progress[3])
+
+    const report = validator.finish(finalState)
+    expect(report.success).toBe(false)
+    expect(report.errors).toHaveLength(1)
+    expect(report.errors[0]!.expectedHash).toBe('bad')
+  })
+
+  it('waits for later inputs before simulating past the last one', () => {
+    const { store, engine, recordingService } = createHeadless()
+    const validator = createStreamingValidator(engine, store, recordingService)
+    validator.start(header)
+
+    const lastInput = inputs[inputs.length - 1]!.frame
+    const progress = validator.push({
+      inputs: inputs.slice(0, 1),
+      throughFrame: FRAMES
+    })
+    expect(progress.framesValidated).toBe(inputs[0]!.frame + 1)
+
+    validator.push({ inputs: inputs.slice(1), snapshots, throughFrame: FRAMES })
+    expect(validator.progress().framesValidated).toBe(lastInput + 1)
+    expect(validator.finish(finalState).success).toBe(true)
+  })
+
+  it('waits for the seed of the level a transition loads', () => {
+    // Skip to level 2 early on, so the recording holds two level seeds
+    const skipping = record(frame => ({
+      ...controlsAt(frame),
+      nextLevel: frame === 10
+    }))
+    expect(skipping.levelSeeds.map(({ level }) => level)).toEqual([1, 2])
+    const [firstSeed, ...laterSeeds] = skipping.levelSeeds
+    const { inputs, snapshots, finalState, ...rest } = skipping
+    const streamedHeader = { ...rest, levelSeeds: [firstSeed!] }
+
+    const whole = createHeadless()
+    const expected = createRecordingValidator(
+      whole.engine,
+      whole.store,
+      whole.recordingService
+    ).validate(skipping)
+    expect(expected.success).toBe(true)
+
+    const { store, engine, recordingService } = createHeadless()
+    const validator = createStreamingValidator(engine, store, recordingService)
+    validator.start(streamedHeader)
+    const waiting = validator.push({ inputs, snapshots, throughFrame: FRAMES })
+    expect(waiting.rejected).toBe(false)
+    expect(waiting.framesValidated).toBeLessThan(FRAMES)
+    expect(store.getState().status.currentlevel).toBe(1)
+
+    validator.push({ levelSeeds: laterSeeds })
+    expect(validator.finish(finalState)).toEqual(expected)
+
+    // Without the seed the run stops short instead of diverging
+    const unseeded = createHeadless()
+    const stalled = createStreamingValidator(
+      unseeded.engine,
+      unseeded.store,
+      unseeded.recordingService
+    )
+    stalled.start(streamedHeader)
+    stalled.push({ inputs, snapshots, throughFrame: FRAMES })
+    const report = stalled.finish(finalState)
+    expect(report.success).toBe(false)
+    expect(report.errors).toEqual([
+      {
+        frame: waiting.framesValidated,
+        type: 'MISSING_LEVEL_SEED',
+        message: 'No seed recorded for level 2'
+      }
+    ])
+  })
+})
@@ -0,0 +1,464 @@
+import type {
+  FinalGameState,
+  FullStateSnapshot,
+  GameRecording,
+  InputFrame,
+  LevelSeed,
+  RecordingService,
+  StateSnapshot
+} from '@core/recording'
+import type { ControlMatrix } from '@/core/controls'
+import type { GameRootState } from '@core/game'
+import type { HeadlessGameEngine } from './HeadlessGameEngine'
+import type { HeadlessStore } from './createHeadlessStore'
+import { loadLevel } from '@core/game'
+import { hashState } from './hashState'
+
+type StateDiff = {
+  path: string
+  expected: unknown
+  actual: unknown
+}[]
+
+type FinalStateError = {
+  field: string
+  expected: number
+  actual: number
+}
+
+type ValidationReport = {
+  success: boolean
+  framesValidated: number
+  snapshotsChecked: number
+  divergenceFrame: number | null
+  finalStateMatch: boolean
+  finalStateErrors?: FinalStateError[]
+  errors: {
+    frame: number
+    type:
+      | 'SNAPSHOT_MISMATCH'
+      | 'MISSING_INPUT'
+      | 'MISSING_LEVEL_SEED'
+      | 'IMPLAUSIBLE'
+    /** Why the plausibility pre-filter or a missing seed stopped the run */
+    message?: string
+    expectedHash?: string
+    actualHash?: string
+    stateDiff?: StateDiff // Detailed diff when full snapshots available
+  }[]
+}
+
+/**
+ * Everything a recording holds besides its inputs, snapshots and final
+ * state, sent before the first chunk
+ */
+type RecordingHeader = Omit<
+  GameRecording,
+  'inputs' | 'snapshots' | 'fullSnapshots' | 'finalState'
+>
+
+/**
+ * Part of a recording, in frame order
+ *
+ * Inputs, snapshots and level seeds continue where the previous chunk
+ * left off. `throughFrame` promises that every input and snapshot up to
+ * that frame has now been pushed; it defaults to the last frame in the
+ * chunk.
+ */
+type RecordingChunk = {
+  inputs?: readonly InputFrame[]
+  snapshots?: readonly StateSnapshot[]
+  fullSnapshots?: readonly FullStateSnapshot[]
+  levelSeeds?: readonly LevelSeed[]
+  throughFrame?: number
+}
+
+type ValidationProgress = {
+  framesValidated: number
+  snapshotsChecked: number
+  divergenceFrame: number | null
+  /** Diverged and stopped; later chunks are ignored */
+  rejected: boolean
+}
+
+type StreamingValidatorOptions = {
+  /**
+   * Stop simulating at the first mismatching snapshot (default true).
+   * When false every frame is still simulated, as a whole-recording
+   * validation does.
+   */
+  stopAtDivergence?: boolean
+}
+
+type StreamingValidator = {
+  /** Load the first level; must come before any chunk */
+  start: (header: RecordingHeader) => void
+  /** Take a chunk and simulate as far as it allows */
+  push: (chunk: RecordingChunk) => ValidationProgress
+  progress: () => ValidationProgress
+  /** Simulate what is left, check the final state and end the replay */
+  finish: (finalState?: FinalGameState) => ValidationReport
+}
+
+const SLICES = [
+  'game',
+  'ship',
+  'shots',
+  'planet',
+  'screen',
+  'status',
+  'explosions',
+  'walls',
+  'transition'
+] as const
+
+const compareStates = (
+  expected: FullStateSnapshot['state'],
+  actual: GameRootState
+): StateDiff => {
+  const diffs: StateDiff = []
+
+  for (const slice of SLICES) {
+    const expectedSlice = expected[slice]
+    const actualSlice = actual[slice]
+
+    // Deep comparison using JSON (simple but effective for validation)
+    const expectedJson = JSON.stringify(expectedSlice)
+    const actualJson = JSON.stringify(actualSlice)
+
+    if (expectedJson !== actualJson) {
+      diffs.push({
+        path: slice,
+        expected: expectedSlice,
+        actual: actualSlice
+      })
+    }
+  }
+
+  return diffs
+}
+
+const finalStateErrorsFor = (
+  finalState: GameRootState,
+  expected: FinalGameState
+): FinalStateError[] => {
+  const errors: FinalStateError[] = []
+
+  if (finalState.status.score !== expected.score) {
+    errors.push({
+      field: 'score',
+      expected: expected.score,
+      actual: finalState.status.score
+    })
+  }
+
+  if (finalState.ship.fuel !== expected.fuel) {
+    errors.push({
+      field: 'fuel',
+      expected: expected.fuel,
+      actual: finalState.ship.fuel
+    })
+  }
+
+  if (finalState.status.currentlevel !== expected.level) {
+    errors.push({
+      field: 'level',
+      expected: expected.level,
+      actual: finalState.status.currentlevel
+    })
+  }
+
+  return errors
+}
+
+/**
+ * Validate a recording as it arrives
+ *
+ * Only inputs and snapshots for frames not yet simulated are kept, so
+ * memory stays bounded however long the recording is. Frames are
+ * simulated once their inputs and snapshots are known, and never past the
+ * last input received: like whole-recording validation, the run ends at
+ * the last recorded input. A level transition is not run to its end until
+ * the seed of the level it loads has arrived.
+ */
+const createStreamingValidator = (
+  engine: HeadlessGameEngine,
+  store: HeadlessStore,
+  recordingService: RecordingService,
+  options: StreamingValidatorOptions = {}
+): StreamingValidator => {
+  const { stopAtDivergence = true } = options
+
+  const errors: ValidationReport['errors'] = []
+  let framesValidated = 0
+  let snapshotsChecked = 0
+  let divergenceFrame: number | null = null
+  let started = false
+
+  // Next frame to simulate, and how far the stream has been promised
+  let nextFrame = 0
+  let throughFrame = -1
+  let lastInputFrame = 0
+
+  // Inputs not yet reached from inputHead on, and the controls in force
+  let pendingInputs: InputFrame[] = []
+  let inputHead = 0
+  let controls: ControlMatrix | null = null
+
+  // Snapshots not yet reached; the first one pushed for a frame wins
+  const hashSnapshots = new Map<number, string>()
+  const fullSnapshots = new Map<number, GameRootState>()
+
+  // Levels whose seeds the recording service has been given
+  const seededLevels = new Set<number>()
+  let currentLevel = 0
+
+  const rejected = (): boolean => stopAtDivergence && divergenceFrame !== null
+
+  const progress = (): ValidationProgress => ({
+    framesValidated,
+    snapshotsChecked,
+    divergenceFrame,
+    rejected: rejected()
+  })
+
+  // Check snapshots BEFORE stepping (recording captures pre-update state)
+  const checkSnapshot = (frame: number): void => {
+    const fullSnapshot = fullSnapshots.get(frame)
+    const hash = hashSnapshots.get(frame)
+    fullSnapshots.delete(frame)
+    hashSnapshots.delete(frame)
+
+    if (fullSnapshot) {
+      const diffs = compareStates(fullSnapshot, store.getState())
+      snapshotsChecked++
+
+      if (diffs.length > 0 && divergenceFrame === null) {
+        divergenceFrame = frame
+        errors.push({
+          frame,
+          type: 'SNAPSHOT_MISMATCH',
+          stateDiff: diffs
+        })
+      }
+    } else if (hash !== undefined) {
+      const actualHash = hashState(store.getState())
+      snapshotsChecked++
+
+      if (actualHash !== hash && divergenceFrame === null) {
+        divergenceFrame = frame
+        errors.push({
+          frame,
+          type: 'SNAPSHOT_MISMATCH',
+          expectedHash: hash,
+          actualHash
+        })
+      }
+    }
+  }
+
+  const addLevelSeeds = (seeds: readonly LevelSeed[]): void => {
+    for (const { level } of seeds) {
+      seededLevels.add(level)
+    }
+  }
+
+  // The level a transition in progress will load, if its seed is unknown
+  const missingSeedLevel = (): number | null => {
+    if (store.getState().transition.status === 'inactive') return null
+    const level = engine.getNextLevel()
+    return seededLevels.has(level) ? null : level
+  }
+
+  const simulateThrough = (lastFrame: number): void => {
+    for (; nextFrame <= lastFrame && !rejected(); nextFrame++) {
+      const frame = nextFrame
+
+      // Without its recorded seed, loadLevel would make up a new one and
+      // the run would diverge; wait for a chunk that brings it
+      if (missingSeedLevel() !== null) {
+        break
+      }
+
+      // Inputs are sparse: controls hold until the next recorded change
+      while (
+        inputHead < pendingInputs.length &&
+        pendingInputs[inputHead]!.frame <= frame
+      ) {
+        controls = pendingInputs[inputHead++]!.controls
+      }
+
+      if (controls === null) {
+        errors.push({ frame, type: 'MISSING_INPUT' })
+        hashSnapshots.delete(frame)
+        fullSnapshots.delete(frame)
+        continue
+      }
+
+      checkSnapshot(frame)
+      if (rejected()) {
+        break
+      }
+
+      engine.step(frame, controls)
+      framesValidated++
+
+      // The engine loads the next level itself when the starmap completes
+      const { status, transition } = store.getState()
+      if (
+        status.currentlevel !== currentLevel &&
+        transition.status === 'inactive'
+      ) {
+        currentLevel = status.currentlevel
+        console.log(`Level transition completed: Now on level ${currentLevel}`)
+      }
+    }
+  }
+
+  return {
+    start: (header): void => {
+      if (started) {
+        throw new Error('Validation already started')
+      }
+      started = true
+
+      // Initialize recording service in replay mode
+      recordingService.startReplay({ ...header, inputs: [], snapshots: [] })
+      addLevelSeeds(header.levelSeeds)
+
+      // Initialize first level before starting validation
+      // Use the recorded seed to ensure deterministic replay
+      const firstLevelSeed = header.levelSeeds[0]
+      if (!firstLevelSeed) {
+        throw new Error('Recording has no level seeds')
+      }
+
+      // Pass the recorded seed to loadLevel so it uses that instead of Date.now()
+      // Type assertion needed due to thunk typing complexity in validation context
+      void store.dispatch(
+        // eslint-disable-next-line @typescript-eslint/no-explicit-any
+        loadLevel(firstLevelSeed.level, firstLevelSeed.seed) as any
+      )
+      currentLevel = firstLevelSeed.level
+
+      console.log(
+        `Initialized level ${firstLevelSeed.level} with seed ${firstLevelSeed.seed}`
+      )
+    },
+
+    push: (chunk): ValidationProgress => {
+      if (!started) {
+        throw new Error('Validation not started')
+      }
+      if (rejected()) {
+        return progress()
+      }
+
+      if (chunk.levelSeeds) {
+        recordingService.addReplayLevelSeeds(chunk.levelSeeds)
+        addLevelSeeds(chunk.levelSeeds)
+      }
+      pendingInputs = pendingInputs.slice(inputHead)
+      inputHead = 0
+
+      let chunkEnd = throughFrame
+      for (const input of chunk.inputs ?? []) {
+        if (input.frame >= nextFrame) {
+          pendingInputs.push(input)
+        }
+        lastInputFrame = Math.max(lastInputFrame, input.frame)
+        chunkEnd = Math.max(chunkEnd, input.frame)
+      }
+      for (const snapshot of chunk.snapshots ?? []) {
+        if (snapshot.frame >= nextFrame && !hashSnapshots.has(snapshot.frame)) {
+          hashSnapshots.set(snapshot.frame, snapshot.hash)
+        }
+        chunkEnd = Math.max(chunkEnd, snapshot.frame)
+      }
+      for (const snapshot of chunk.fullSnapshots ?? []) {
+        if (snapshot.frame >= nextFrame && !fullSnapshots.has(snapshot.frame)) {
+          fullSnapshots.set(snapshot.frame, snapshot.state)
+        }
+        chunkEnd = Math.max(chunkEnd, snapshot.frame)
+      }
+
+      throughFrame = Math.max(throughFrame, chunk.throughFrame ?? chunkEnd)
+      simulateThrough(Math.min(throughFrame, lastInputFrame))
+      return progress()
+    },
+
+    progress,
+
+    finish: (finalState): ValidationReport => {
+      if (!started) {
+        throw new Error('Validation not started')
+      }
+
+      // Nothing more is coming, so every frame up to the last input is known
+      simulateThrough(lastInputFrame)
+      pendingInputs = []
+      hashSnapshots.clear()
+      fullSnapshots.clear()
+
+      // A seed that never came leaves the run short of the last input
+      const missingLevel =
+        nextFrame <= lastInputFrame && !rejected() ? missingSeedLevel() : null
+      if (missingLevel !== null) {
+        errors.push({
+          frame: nextFrame,
+          type: 'MISSING_LEVEL_SEED',
+          message: `No seed recorded for level ${missingLevel}`
+        })
+        divergenceFrame ??= nextFrame
+      }
+      const stoppedEarly = rejected() || missingLevel !== null
+
+      // Validate final state if present in recording
+      let finalStateErrors: FinalStateError[] = []
+      if (stoppedEarly) {
+        // The run stopped early, so the final state says nothing
+      } else if (finalState) {
+        // Get final state from engine (captured before reset) or fall back to current store state
+        finalStateErrors = finalStateErrorsFor(
+          engine.getFinalState() ?? store.getState(),
+          finalState
+        )
+
+        if (finalStateErrors.length > 0) {
+          console.error('Final state validation failed:', finalStateErrors)
+        } else {
+          console.log('Final state validation passed ✓')
+        }
+      } else {
+        console.warn(
+          'Recording does not contain finalState - skipping final state validation (old recording format)'
+        )
+      }
+      const finalStateMatch = finalStateErrors.length === 0 && !stoppedEarly
+
+      // Clean up
+      recordingService.stopReplay()
+
+      return {
+        success: errors.length === 0 && finalStateMatch,
+        framesValidated,
+        snapshotsChecked,
+        divergenceFrame,
+        finalStateMatch,
+        finalStateErrors:
+          finalStateErrors.length > 0 ? finalStateErrors : undefined,
+        errors
+      }
+    }
+  }
+}
+
+export {
+  createStreamingValidator,
+  type StreamingValidator,
+  type StreamingValidatorOptions,
+  type RecordingHeader,
+  type RecordingChunk,
+  type ValidationProgress,
+  type ValidationReport
+}
@@ -0,0 +1,120 @@
+import { describe, it, expect } from 'vitest'
+import { readFileSync } from 'fs'
+import { join } from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import type { GalaxyService } from '@core/galaxy'
+import { createSpriteServiceNode } from '@core/sprites/createSpriteServiceNode'
+import { createRandomService } from '@/core/shared'
+import { createCollisionService } from '@core/collision'
+import { createRecordingService } from '@core/recording'
+import { decodeRecordingAuto } from '@core/recording/binaryCodec'
+import { SCRWTH, VIEWHT } from '@core/screen'
+import { GALAXIES } from '@/game/galaxyConfig'
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import { decompress } from '../../../scripts/gzip.node'
+import { CORPUS_ENTRIES, type CorpusManifest } from './corpus'
+import { createHeadlessStore } from './createHeadlessStore'
+import { createHeadlessGameEngine } from './HeadlessGameEngine'
+import { createRecordingValidator } from './RecordingValidator'
+import { hashState } from './hashState'
+
+const CORPUS_DIR = join(__dirname, '../../../corpus')
+const PUBLIC_DIR = join(__dirname, '../../game/public')
+
+// The marathon replays thousands of frames
+const ENTRY_TIMEOUT_MS = 60_000
+
+const manifest = JSON.parse(
+  readFileSync(join(CORPUS_DIR, 'manifest.json'), 'utf8')
+) as CorpusManifest
+
+const spriteService = createSpriteServiceNode(join(PUBLIC_DIR, 'rsrc_260.bin'))
+const galaxyServices = new Map<string, GalaxyService>()
+const galaxyService = (galaxyId: string): GalaxyService => {
+  let service = galaxyServices.get(galaxyId)
+  if (!service) {
+    const config = GALAXIES.find(g => g.id === galaxyId)!
+    service = createGalaxyServiceNode(join(PUBLIC_DIR, config.path))
+    galaxyServices.set(galaxyId, service)
+  }
+  return service
+}
+
+const readRecording = (file: string): ArrayBuffer => {
+  const buffer = readFileSync(join(CORPUS_DIR, file))
+  return buffer.buffer.slice(
+    buffer.byteOffset,
+    buffer.byteOffset + buffer.byteLength
+  )
+}
+
+describe('benchmark corpus', () => {
+  it('is generated from the current entries and engine', () => {
+    expect(manifest.engineVersion).toBe(GAME_ENGINE_VERSION)
+    expect(
+      manifest.entries.map(
+        ({ name, description, galaxyId, startLevel, frames, pilot }) => ({
+          name,
+          description,
+          galaxyId,
+          startLevel,
+          frames,
+          pilot
+        })
+      )
+    ).toEqual(CORPUS_ENTRIES)
+  })
+
+  for (const entry of manifest.entries) {
+    it(
+      `replays ${entry.name} to its manifest hash and score`,
+      async () => {
+        const recording = await decodeRecordingAuto(
+          readRecording(entry.file),
+          decompress
+        )
+        expect(recording.galaxyId).toBe(entry.galaxyId)
+        expect(recording.startLevel).toBe(entry.startLevel)
+
+        const galaxy = galaxyService(entry.galaxyId)
+        const randomService = createRandomService()
+        const recordingService = createRecordingService()
+        const collisionService = createCollisionService()
+        collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+        const store = createHeadlessStore(
+          {
+            galaxyService: galaxy,
+            randomService,
+            recordingService,
+            collisionService,
+            spriteService
+          },
+          entry.startLevel
+        )
+        const engine = createHeadlessGameEngine(
+          store,
+          galaxy,
+          randomService,
+          entry.galaxyId
+        )
+
+        const report = createRecordingValidator(
+          engine,
+          store,
+          recordingService
+        ).validate(recording)
+
+        expect(report.errors).toEqual([])
+        expect(report.success).toBe(true)
+        expect(report.framesValidated).toBe(entry.frames)
+        expect(report.snapshotsChecked).toBe(entry.snapshots)
+
+        const finalState = engine.getFinalState() ?? store.getState()
+        expect(hashState(finalState)).toBe(entry.finalHash)
+        expect(finalState.status.score).toBe(entry.finalScore)
+        expect(finalState.status.currentlevel).toBe(entry.finalLevel)
+      },
+      ENTRY_TIMEOUT_MS
+    )
+  }
+})
@@ -0,0 +1,299 @@
+/**
+ * @fileoverview Scripted recordings for the benchmark corpus
+ *
+ * Each corpus entry plays a galaxy from a start level under a scripted
+ * pilot through the headless engine and records it like a real game. The
+ * entries cover every shipped galaxy plus long sessions, explosion-heavy
+ * fights, wrapping planets and shield and bounce-wall stress, so
+ * performance work can be measured on the same inputs and the recordings
+ * double as validation test data.
+ *
+ * scripts/generate-corpus.ts writes the recordings and corpus/manifest.json;
+ * corpus.test.ts replays them against the manifest.
+ */
+
+import { ControlAction, type ControlMatrix } from '@/core/controls'
+import { createCollisionService } from '@core/collision'
+import type { GalaxyService } from '@core/galaxy'
+import { loadLevel, type GameRootState } from '@core/game'
+import { createRecordingService, type GameRecording } from '@core/recording'
+import { SCRWTH, VIEWHT } from '@core/screen'
+import { createRandomService } from '@/core/shared'
+import type { SpriteService } from '@core/sprites'
+import { GALAXIES } from '@/game/galaxyConfig'
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import { createHeadlessStore } from './createHeadlessStore'
+import { createHeadlessGameEngine } from './HeadlessGameEngine'
+import { hashState } from './hashState'
+
+/**
+ * Controls for a frame, from the frame number and the state before it.
+ * Pilots are pure, so a recording of one replays like any other game.
+ */
+export type CorpusPilot = (frame: number, state: GameRootState) => ControlMatrix
+
+export type CorpusPilotName =
+  | 'tour'
+  | 'marathon'
+  | 'demolition'
+  | 'wrap'
+  | 'bounce'
+
+export type CorpusEntry = {
+  /** File stem under corpus/, e.g. "tour-release" */
+  name: string
+  description: string
+  galaxyId: string
+  startLevel: number
+  frames: number
+  pilot: CorpusPilotName
+}
+
+/**
+ * What a corpus recording must replay to, as stored in the manifest
+ */
+export type CorpusManifestEntry = CorpusEntry & {
+  file: string
+  finalHash: string
+  finalScore: number
+  finalLevel: number
+  snapshots: number
+}
+
+export type CorpusManifest = {
+  engineVersion: number
+  entries: CorpusManifestEntry[]
+}
+
+const controls = (pressed: Partial<ControlMatrix>): ControlMatrix => {
+  const matrix = Object.fromEntries(
+    Object.values(ControlAction).map(action => [action, false])
+  ) as ControlMatrix
+  return Object.assign(matrix, pressed)
+}
+
+// Turn, thrust and fire in a fixed pattern that changes every few frames
+const patrol = (frame: number): Partial<ControlMatrix> => {
+  const phase = Math.floor(frame / 7) % 6
+  return {
+    thrust: phase === 1 || phase === 4,
+    left: phase === 2,
+    right: phase === 5,
+    fire: frame % 11 < 3
+  }
+}
+
+// A cheat life whenever the pilot is down to its last ship, so a scripted
+// game never ends before its entry does
+const lifeline = (state: GameRootState): boolean => state.ship.lives < 2
+
+// Turn toward a rotation (0 up, 8 right, 16 down) the short way round
+const steer = (
+  state: GameRootState,
+  target: number
+): Partial<ControlMatrix> => {
+  const turn = (target - state.ship.shiprot) & 31
+  return { right: turn > 0 && turn < 16, left: turn >= 16 }
+}
+
+export const CORPUS_PILOTS: Record<CorpusPilotName, CorpusPilot> = {
+  // Patrol each planet for 300 frames, then skip to the next
+  tour: (frame, state) =>
+    controls({
+      ...patrol(frame),
+      extraLife: lifeline(state),
+      nextLevel: frame % 300 === 299
+    }),
+
+  // Patrol for minutes, skipping to the next planet every 2000 frames
+  marathon: (frame, state) =>
+    controls({
+      ...patrol(frame),
+      extraLife: lifeline(state),
+      nextLevel: frame % 2000 === 1999
+    }),
+
+  // Fire on every other frame while sweeping round, and blow the ship up
+  // every 250 frames for the shard and spark bursts
+  demolition: (frame, state) => {
+    const sweep = Math.floor(frame / 24) % 4
+    return controls({
+      fire: frame % 2 === 0,
+      left: sweep === 0 || (sweep === 2 && frame % 3 === 0),
+      right: sweep === 1,
+      thrust: sweep === 3 && frame % 4 < 2,
+      selfDestruct: frame % 250 === 200,
+      extraLife: lifeline(state)
+    })
+  },
+
+  // Fly right across the seam at a steady height above the start, nosing
+  // up to climb whenever below it
+  wrap: (frame, state) => {
+    const { dx, dy, globaly, starty } = state.ship
+    const climbing = globaly > Math.max(starty - 100, 40) && dy > -300
+    return controls({
+      ...steer(state, climbing ? 0 : 8),
+      thrust: climbing || dx < 600,
+      fire: frame % 9 === 0,
+      extraLife: lifeline(state)
+    })
+  },
+
+  // Shield most of the time while thrusting into walls from every angle
+  bounce: (frame, state) => {
+    const phase = Math.floor(frame / 10) % 5
+    return controls({
+      shield: frame % 40 < 28,
+      thrust: phase !== 4,
+      left: phase === 1,
+      right: phase === 3,
+      fire: frame % 40 >= 30 && frame % 2 === 0,
+      extraLife: lifeline(state)
+    })
+  }
+}
+
+export const CORPUS_ENTRIES: readonly CorpusEntry[] = [
+  ...GALAXIES.map(
+    (galaxy): CorpusEntry => ({
+      name: `tour-${galaxy.id}`,
+      description: `First two planets of ${galaxy.name}`,
+      galaxyId: galaxy.id,
+      startLevel: 1,
+      frames: 600,
+      pilot: 'tour'
+    })
+  ),
+  {
+    name: 'marathon-release',
+    description: 'Five minutes over three release planets',
+    galaxyId: 'release',
+    startLevel: 1,
+    frames: 6000,
+    pilot: 'marathon'
+  },
+  {
+    name: 'demolition-andys-12',
+    description: 'Constant fire and self-destructs among 24 bunkers',
+    galaxyId: 'andys',
+    startLevel: 12,
+    frames: 1200,
+    pilot: 'demolition'
+  },
+  {
+    name: 'demolition-zephyrs_short-13',
+    description: 'Constant fire and self-destructs among 24 bunkers',
+    galaxyId: 'zephyrs_short',
+    startLevel: 13,
+    frames: 1200,
+    pilot: 'demolition'
+  },
+  {
+    name: 'wrap-zephyrs_short-11',
+    description: 'Repeated flights across the seam of a wrapping planet',
+    galaxyId: 'zephyrs_short',
+    startLevel: 11,
+    frames: 1200,
+    pilot: 'wrap'
+  },
+  {
+    name: 'wrap-release-28',
+    description: 'Repeated flights across the seam of a wrapping planet',
+    galaxyId: 'release',
+    startLevel: 28,
+    frames: 1200,
+    pilot: 'wrap'
+  },
+  {
+    name: 'bounce-andys-3',
+    description: 'Shielded thrusting into a planet of bounce walls',
+    galaxyId: 'andys',
+    startLevel: 3,
+    frames: 1200,
+    pilot: 'bounce'
+  },
+  {
+    name: 'bounce-zephyrs_short-7',
+    description: 'Shielded thrusting into a planet of bounce walls',
+    galaxyId: 'zephyrs_short',
+    startLevel: 7,
+    frames: 1200,
+    pilot: 'bounce'
+  }
+]
+
+/**
+ * Seed for the nth level an entry loads, in place of the clock a live game
+ * uses
+ */
+const seedFor = (name: string, n: number): number => {
+  let hash = n
+  for (let i = 0; i < name.length; i++) {
+    hash = (Math.imul(hash, 31) + name.charCodeAt(i)) | 0
+  }
+  return hash >>> 0
+}
+
+/**
+ * Play an entry's pilot through the headless engine and record it
+ *
+ * The game is quit on the last frame, as a player ends one, so the final
+ * state is captured and a replay covers every frame. Level seeds come from
+ * Date.now() in a live game; here the store is given per-entry seeds
+ * instead, so every run produces the same file.
+ */
+export const recordCorpusEntry = (
+  entry: CorpusEntry,
+  galaxyService: GalaxyService,
+  spriteService: SpriteService
+): { recording: GameRecording; finalHash: string } => {
+  const randomService = createRandomService()
+  const recordingService = createRecordingService()
+  const collisionService = createCollisionService()
+  collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+
+  let levelsLoaded = 0
+  const store = createHeadlessStore(
+    {
+      galaxyService,
+      randomService,
+      recordingService,
+      collisionService,
+      spriteService,
+      levelSeedSource: () => seedFor(entry.name, levelsLoaded++)
+    },
+    entry.startLevel
+  )
+  const engine = createHeadlessGameEngine(
+    store,
+    galaxyService,
+    randomService,
+    entry.galaxyId
+  )
+  const pilot = CORPUS_PILOTS[entry.pilot]
+
+  recordingService.startRecording({
+    engineVersion: GAME_ENGINE_VERSION,
+    galaxyId: entry.galaxyId,
+    startLevel: entry.startLevel,
+    timestamp: 0,
+    initialState: { lives: store.getState().ship.lives }
+  })
+  // eslint-disable-next-line @typescript-eslint/no-explicit-any
+  void store.dispatch(loadLevel(entry.startLevel) as any)
+
+  for (let frame = 0; frame < entry.frames; frame++) {
+    const state = store.getState()
+    const frameControls = pilot(frame, state)
+    frameControls.quit = frame === entry.frames - 1
+    recordingService.recordFrame(frame, frameControls, state)
+    engine.step(frame, frameControls)
+  }
+
+  const finalState = engine.getFinalState() ?? store.getState()
+  return {
+    recording: recordingService.stopRecording(finalState)!,
+    finalHash: hashState(finalState)
+  }
+}
@@ -1,13 +1,7 @@
-import { combineSlices, configureStore } from '@reduxjs/toolkit'
-import { gameSlice } from '@core/game'
+import { configureStore } from '@reduxjs/toolkit'
+import { gameSlice, gameReducer } from '@core/game'
 import { shipSlice, TOTAL_INITIAL_LIVES } from '@core/ship'
-import { shotsSlice } from '@core/shots'
-import { planetSlice } from '@core/planet'
-import { screenSlice } from '@core/screen'
 import { statusSlice } from '@core/status'
-import { explosionsSlice } from '@core/explosions'
-import { wallsSlice } from '@core/walls'
-import { transitionSlice } from '@core/transition'
 import { createSyncThunkMiddleware } from '@lib/redux'
 import type { GameRootState } from '@core/game'
 import type { GalaxyService } from '@core/galaxy'
@@ -24,20 +18,10 @@ type HeadlessServices = {
   recordingService: RecordingService
   collisionService: CollisionService
   spriteService: SpriteService
+  /** Seeds for new levels in place of Date.now() */
+  levelSeedSource?: (level: number) => number
 }
 
-const headlessReducer = combineSlices(
-  gameSlice,
-  shipSlice,
-  shotsSlice,
-  planetSlice,
-  screenSlice,
-  statusSlice,
-  explosionsSlice,
-  wallsSlice,
-  transitionSlice
-)
-
 const createHeadlessStore = (
   services: HeadlessServices,
   startLevel: number
@@ -49,7 +33,7 @@ const createHeadlessStore = (
   >()
 
   const store = configureStore({
-    reducer: headlessReducer,
+    reducer: gameReducer,
     middleware: getDefaultMiddleware =>
       getDefaultMiddleware({
         thunk: {
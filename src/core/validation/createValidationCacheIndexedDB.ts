@@ -0,0 +1,62 @@
+/**
+ * @fileoverview IndexedDB-backed validation cache for the browser
+ *
+ * The database version is the engine version, so the first open after an
+ * engine change drops every entry written by the old engine.
+ */
+
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import type {
+  ValidationCacheEntry,
+  ValidationCacheStore
+} from './validationCache'
+
+const DATABASE_NAME = 'continuum_validation_cache'
+const STORE_NAME = 'results'
+
+const request = <T>(req: IDBRequest<T>): Promise<T> =>
+  new Promise((resolve, reject) => {
+    req.onsuccess = (): void => resolve(req.result)
+    req.onerror = (): void => reject(req.error)
+  })
+
+const openDatabase = (): Promise<IDBDatabase> => {
+  const open = indexedDB.open(DATABASE_NAME, GAME_ENGINE_VERSION)
+  open.onupgradeneeded = (): void => {
+    const db = open.result
+    if (db.objectStoreNames.contains(STORE_NAME)) {
+      db.deleteObjectStore(STORE_NAME)
+    }
+    db.createObjectStore(STORE_NAME)
+  }
+  return request(open)
+}
+
+/**
+ * Open the browser's validation cache
+ *
+ * The database opens on first use. If IndexedDB is unavailable every
+ * lookup misses and validation runs as if there were no cache.
+ */
+export const createValidationCacheIndexedDB = (): ValidationCacheStore => {
+  let database: Promise<IDBDatabase> | null = null
+  const db = (): Promise<IDBDatabase> => (database ??= openDatabase())
+
+  return {
+    get: async (key): Promise<ValidationCacheEntry | null> => {
+      const store = (await db())
+        .transaction(STORE_NAME, 'readonly')
+        .objectStore(STORE_NAME)
+      const entry = await request<ValidationCacheEntry | undefined>(
+        store.get(key)
+      )
+      return entry ?? null
+    },
+    set: async (key, entry): Promise<void> => {
+      const store = (await db())
+        .transaction(STORE_NAME, 'readwrite')
+        .objectStore(STORE_NAME)
+      await request(store.put(entry, key))
+    }
+  }
+}
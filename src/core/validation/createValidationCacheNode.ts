@@ -0,0 +1,49 @@
+/**
+ * @fileoverview File-backed validation cache for CLI tools
+ *
+ * One JSON file per entry, named by its cache key. Files written by other
+ * engine versions can never be hit again and are removed when the cache
+ * is opened.
+ */
+
+import { mkdirSync, readdirSync, rmSync } from 'fs'
+import { readFile, writeFile } from 'fs/promises'
+import { join } from 'path'
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import type {
+  ValidationCacheEntry,
+  ValidationCacheStore
+} from './validationCache'
+
+/**
+ * Open a validation cache in a directory, creating it if needed
+ */
+export const createValidationCacheNode = (
+  directory: string
+): ValidationCacheStore => {
+  mkdirSync(directory, { recursive: true })
+
+  const current = `${GAME_ENGINE_VERSION}-`
+  for (const file of readdirSync(directory)) {
+    if (file.endsWith('.json') && !file.startsWith(current)) {
+      rmSync(join(directory, file), { force: true })
+    }
+  }
+
+  const pathFor = (key: string): string => join(directory, `${key}.json`)
+
+  return {
+    get: async (key): Promise<ValidationCacheEntry | null> => {
+      try {
+        return JSON.parse(
+          await readFile(pathFor(key), 'utf8')
+        ) as ValidationCacheEntry
+      } catch {
+        return null
+      }
+    },
+    set: async (key, entry): Promise<void> => {
+      await writeFile(pathFor(key), JSON.stringify(entry))
+    }
+  }
+}
@@ -16,6 +16,39 @@ export {
   createRecordingValidator,
   type ValidationReport
 } from './RecordingValidator'
+export {
+  createStreamingValidator,
+  type StreamingValidator,
+  type StreamingValidatorOptions,
+  type RecordingHeader,
+  type RecordingChunk,
+  type ValidationProgress
+} from './StreamingValidator'
+
+// Pre-filter
+export {
+  checkPlausibility,
+  implausibleReport,
+  MIN_FRAMES_PER_LEVEL,
+  type PlausibilityError,
+  type PlausibilityErrorType,
+  type PlausibilityReport
+} from './plausibility'
+
+// Result cache (createValidationCacheNode is imported by path, as it
+// needs fs)
+export {
+  createValidationCacheMemory,
+  galaxyContentHash,
+  validateCached,
+  validationCacheKey,
+  type CachedValidation,
+  type ValidationCacheEntry,
+  type ValidationCacheStore
+} from './validationCache'
+export {
+  createValidationCacheIndexedDB
+} from './createValidationCacheIndexedDB'
 
 // Hash function
 export { hashState } from './hashState'
@@ -0,0 +1,175 @@
+import { describe, it, expect } from 'vitest'
+import { readFileSync } from 'fs'
+import { join } from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import type { GalaxyService } from '@core/galaxy'
+import { decodeRecordingAuto } from '@core/recording/binaryCodec'
+import type { GameRecording } from '@core/recording'
+import { GALAXIES } from '@/game/galaxyConfig'
+import { decompress } from '../../../scripts/gzip.node'
+import { CORPUS_ENTRIES } from './corpus'
+import {
+  checkPlausibility,
+  implausibleReport,
+  MIN_FRAMES_PER_LEVEL,
+  type PlausibilityErrorType
+} from './plausibility'
+
+const CORPUS_DIR = join(__dirname, '../../../corpus')
+const PUBLIC_DIR = join(__dirname, '../../game/public')
+
+const galaxyServices = new Map<string, GalaxyService>()
+const galaxyService = (galaxyId: string): GalaxyService => {
+  let service = galaxyServices.get(galaxyId)
+  if (!service) {
+    const config = GALAXIES.find(g => g.id === galaxyId)!
+    service = createGalaxyServiceNode(join(PUBLIC_DIR, config.path))
+    galaxyServices.set(galaxyId, service)
+  }
+  return service
+}
+
+const loadRecording = (name: string): Promise<GameRecording> => {
+  const buffer = readFileSync(join(CORPUS_DIR, `${name}.bin`))
+  return decodeRecordingAuto(
+    buffer.buffer.slice(
+      buffer.byteOffset,
+      buffer.byteOffset + buffer.byteLength
+    ),
+    decompress
+  )
+}
+
+// Check a tampered copy of the two-planet release tour
+const forged = async (
+  tamper: (recording: GameRecording) => void
+): Promise<PlausibilityErrorType[]> => {
+  const recording = structuredClone(await loadRecording('tour-release'))
+  tamper(recording)
+  const report = checkPlausibility(recording, galaxyService('release'))
+  expect(report.plausible).toBe(report.errors.length === 0)
+  return report.errors.map(error => error.type)
+}
+
+describe('checkPlausibility', () => {
+  it('passes every corpus recording', async () => {
+    for (const entry of CORPUS_ENTRIES) {
+      const recording = await loadRecording(entry.name)
+      const report = checkPlausibility(
+        recording,
+        galaxyService(entry.galaxyId)
+      )
+      expect({ name: entry.name, ...report }).toEqual({
+        name: entry.name,
+        plausible: true,
+        errors: []
+      })
+    }
+  })
+
+  it('rejects a score above what the planets hold', async () => {
+    expect(
+      await forged(recording => {
+        recording.finalState!.score += 1_000_000
+      })
+    ).toEqual(['SCORE_OUT_OF_RANGE'])
+  })
+
+  it('rejects fuel and lives outside their bounds', async () => {
+    expect(
+      await forged(recording => {
+        recording.finalState!.fuel = -1
+      })
+    ).toEqual(['FUEL_OUT_OF_RANGE'])
+    expect(
+      await forged(recording => {
+        recording.finalState!.fuel = 10_000_000
+      })
+    ).toEqual(['FUEL_OUT_OF_RANGE'])
+    expect(
+      await forged(recording => {
+        recording.initialState.lives = 99
+      })
+    ).toEqual(['LIVES_OUT_OF_RANGE'])
+  })
+
+  it('rejects skipped levels and levels loaded too quickly', async () => {
+    expect(
+      await forged(recording => {
+        recording.levelSeeds[1]!.level = 5
+        recording.finalState!.level = 5
+      })
+    ).toEqual(['LEVEL_SEQUENCE'])
+    expect(
+      await forged(recording => {
+        recording.finalState!.level = 1
+      })
+    ).toEqual(['LEVEL_SEQUENCE'])
+
+    // Squeeze the game into fewer frames than a transition takes
+    expect(
+      await forged(recording => {
+        const last = MIN_FRAMES_PER_LEVEL - 1
+        recording.inputs = recording.inputs.filter(input => input.frame < last)
+        recording.inputs.push({
+          ...recording.inputs[recording.inputs.length - 1]!,
+          controls: {
+            ...recording.inputs[recording.inputs.length - 1]!.controls,
+            quit: true
+          },
+          frame: last
+        })
+        recording.snapshots = recording.snapshots.slice(0, 1)
+      })
+    ).toEqual(['LEVELS_TOO_FAST'])
+  })
+
+  it('rejects malformed input deltas', async () => {
+    expect(
+      await forged(recording => {
+        recording.inputs[2]!.frame = recording.inputs[1]!.frame
+      })
+    ).toEqual(['MALFORMED_INPUT'])
+    expect(
+      await forged(recording => {
+        recording.inputs[2]!.controls = { ...recording.inputs[1]!.controls }
+      })
+    ).toEqual(['MALFORMED_INPUT'])
+    expect(
+      await forged(recording => {
+        Object.assign(recording.inputs[3]!.controls, { warp: true })
+      })
+    ).toEqual(['MALFORMED_INPUT'])
+    expect(
+      await forged(recording => {
+        recording.inputs.shift()
+      })
+    ).toEqual(['MALFORMED_INPUT'])
+  })
+
+  it('rejects missing or malformed snapshots', async () => {
+    expect(
+      await forged(recording => {
+        recording.snapshots.splice(2, 1)
+      })
+    ).toEqual(['MALFORMED_SNAPSHOT'])
+    expect(
+      await forged(recording => {
+        recording.snapshots[1]!.hash = 'not a hash'
+      })
+    ).toEqual(['MALFORMED_SNAPSHOT'])
+  })
+
+  it('reports a rejection as a failed validation', async () => {
+    const recording = await loadRecording('tour-release')
+    recording.finalState!.score = -5
+    const report = implausibleReport(
+      checkPlausibility(recording, galaxyService('release'))
+    )
+    expect(report.success).toBe(false)
+    expect(report.framesValidated).toBe(0)
+    expect(report.errors).toEqual([
+      { frame: 0, type: 'IMPLAUSIBLE', message: 'Score -5 outside 0 to 3210' }
+    ])
+  })
+})
@@ -0,0 +1,255 @@
+/**
+ * @fileoverview Plausibility pre-filter for recordings
+ *
+ * Full validation simulates every frame of a recording. This check looks
+ * only at what the recording states about itself - header, level seeds,
+ * inputs, snapshots and final state - and rejects recordings that no real
+ * game could have produced, in time linear in the recording's size. A
+ * recording that passes may still fail full validation; one that fails
+ * here never needs a simulation.
+ */
+
+import { ControlAction } from '@/core/controls'
+import type { GalaxyService } from '@core/galaxy'
+import { SNAPSHOT_INTERVAL, type GameRecording } from '@core/recording'
+import { FUELGAIN, FUELSTART, TOTAL_INITIAL_LIVES } from '@core/ship'
+import { getBunkerScore, SCORE_FUEL } from '@core/status'
+import { FIZZ_DURATION, TRANSITION_DELAY_FRAMES } from '@core/transition'
+import type { ValidationReport } from './StreamingValidator'
+
+type PlausibilityErrorType =
+  | 'MALFORMED_HEADER'
+  | 'MALFORMED_INPUT'
+  | 'MALFORMED_SNAPSHOT'
+  | 'LEVEL_SEQUENCE'
+  | 'LEVELS_TOO_FAST'
+  | 'LIVES_OUT_OF_RANGE'
+  | 'FUEL_OUT_OF_RANGE'
+  | 'SCORE_OUT_OF_RANGE'
+
+type PlausibilityError = {
+  type: PlausibilityErrorType
+  /** Frame the error was found at, where it belongs to one */
+  frame?: number
+  message: string
+}
+
+type PlausibilityReport = {
+  plausible: boolean
+  errors: PlausibilityError[]
+}
+
+/**
+ * Fewest frames between two level loads: a skipped level still plays the
+ * whole fizz and starmap
+ */
+const MIN_FRAMES_PER_LEVEL = FIZZ_DURATION + TRANSITION_DELAY_FRAMES
+
+// What hashState produces: a signed 32-bit integer in hex
+const HASH_PATTERN = /^-?[0-9a-f]{1,8}$/
+
+const CONTROL_ACTIONS: readonly string[] = Object.values(ControlAction)
+
+const isCount = (value: unknown): value is number =>
+  typeof value === 'number' && Number.isInteger(value) && value >= 0
+
+const isControlMatrix = (controls: unknown): boolean => {
+  if (typeof controls !== 'object' || controls === null) return false
+  const entries = Object.entries(controls)
+  return (
+    entries.length === CONTROL_ACTIONS.length &&
+    entries.every(
+      ([action, pressed]) =>
+        CONTROL_ACTIONS.includes(action) && typeof pressed === 'boolean'
+    )
+  )
+}
+
+const sameControls = (
+  a: Record<string, boolean>,
+  b: Record<string, boolean>
+): boolean => CONTROL_ACTIONS.every(action => a[action] === b[action])
+
+/**
+ * Most a planet can give up: every bunker, every fuel cell and the whole
+ * planet bonus
+ */
+const levelLimits = (
+  galaxyService: GalaxyService,
+  level: number
+): { score: number; fuelCells: number } => {
+  const planet = galaxyService.getPlanet(level)
+  let score = planet.planetbonus
+  let fuelCells = 0
+  for (const bunker of planet.bunkers) {
+    if (bunker.alive) score += getBunkerScore(bunker.kind, bunker.rot)
+  }
+  // The fuel list has holes before its end marker
+  for (const fuel of planet.fuels) {
+    if (fuel?.alive) fuelCells++
+  }
+  return { score: score + fuelCells * SCORE_FUEL, fuelCells }
+}
+
+/**
+ * Check a recording for anything impossible on its face
+ *
+ * @param recording - Decoded recording
+ * @param galaxyService - Service holding the recording's galaxy, for the
+ * planet count and what each planet can score
+ */
+const checkPlausibility = (
+  recording: GameRecording,
+  galaxyService: GalaxyService
+): PlausibilityReport => {
+  // The first impossibility is enough to reject
+  const fail = (
+    type: PlausibilityErrorType,
+    message: string,
+    frame?: number
+  ): PlausibilityReport => ({
+    plausible: false,
+    errors: [frame === undefined ? { type, message } : { type, frame, message }]
+  })
+
+  const planets = galaxyService.getHeader().planets
+  const { startLevel, initialState, levelSeeds, inputs, snapshots } =
+    recording
+
+  // Header
+  if (!isCount(startLevel) || startLevel < 1 || startLevel > planets) {
+    return fail('MALFORMED_HEADER', `Start level ${startLevel} not in galaxy`)
+  }
+  const lives = initialState?.lives
+  if (!isCount(lives) || lives < 1 || lives > TOTAL_INITIAL_LIVES) {
+    return fail('LIVES_OUT_OF_RANGE', `Starting lives ${lives}`)
+  }
+
+  // Inputs: sparse, so strictly increasing from frame 0 and each one a
+  // change from the last
+  if (inputs.length === 0 || inputs[0]!.frame !== 0) {
+    return fail('MALFORMED_INPUT', 'Inputs do not start at frame 0')
+  }
+  for (let i = 0; i < inputs.length; i++) {
+    const { frame, controls } = inputs[i]!
+    if (!isCount(frame) || !isControlMatrix(controls)) {
+      return fail('MALFORMED_INPUT', `Malformed input at index ${i}`)
+    }
+    const previous = inputs[i - 1]
+    if (previous && frame <= previous.frame) {
+      return fail('MALFORMED_INPUT', 'Input frames out of order', frame)
+    }
+    if (previous && sameControls(previous.controls, controls)) {
+      return fail('MALFORMED_INPUT', 'Input repeats the controls before', frame)
+    }
+  }
+  const lastFrame = inputs[inputs.length - 1]!.frame
+
+  // Snapshots: one every SNAPSHOT_INTERVAL frames with none missing, at
+  // least up to the last input
+  for (let i = 0; i < snapshots.length; i++) {
+    const { frame, hash } = snapshots[i]!
+    if (frame !== i * SNAPSHOT_INTERVAL) {
+      return fail(
+        'MALFORMED_SNAPSHOT',
+        'Snapshot missing or out of place',
+        frame
+      )
+    }
+    if (typeof hash !== 'string' || !HASH_PATTERN.test(hash)) {
+      return fail('MALFORMED_SNAPSHOT', 'Malformed snapshot hash', frame)
+    }
+  }
+  if (snapshots.length <= Math.floor(lastFrame / SNAPSHOT_INTERVAL)) {
+    return fail(
+      'MALFORMED_SNAPSHOT',
+      'Snapshots stop before the last input',
+      snapshots.length * SNAPSHOT_INTERVAL
+    )
+  }
+
+  // Levels: the start level, then each one the next, wrapping to 1 after
+  // a won galaxy, with a full transition between each
+  if (levelSeeds.length === 0 || levelSeeds[0]!.level !== startLevel) {
+    return fail('LEVEL_SEQUENCE', 'First level is not the start level')
+  }
+  let maxScore = 0
+  let fuelCells = 0
+  for (let i = 0; i < levelSeeds.length; i++) {
+    const { level, seed } = levelSeeds[i]!
+    const previous = levelSeeds[i - 1]?.level
+    const expected =
+      previous === undefined
+        ? startLevel
+        : previous === planets
+          ? 1
+          : previous + 1
+    if (level !== expected || !isCount(seed)) {
+      return fail('LEVEL_SEQUENCE', `Level ${level} cannot follow ${previous}`)
+    }
+    const limits = levelLimits(galaxyService, level)
+    maxScore += limits.score
+    fuelCells += limits.fuelCells
+  }
+  const frames = Math.max(lastFrame, (snapshots.length - 1) * SNAPSHOT_INTERVAL)
+  if ((levelSeeds.length - 1) * MIN_FRAMES_PER_LEVEL > frames) {
+    return fail(
+      'LEVELS_TOO_FAST',
+      `${levelSeeds.length} levels in ${frames} frames`
+    )
+  }
+
+  // Final state: the last level loaded, with no more score than its
+  // planets hold and no more fuel than a fresh ship plus every cell
+  const { finalState } = recording
+  if (finalState) {
+    const lastLevel = levelSeeds[levelSeeds.length - 1]!.level
+    if (finalState.level !== lastLevel) {
+      return fail(
+        'LEVEL_SEQUENCE',
+        `Ended on level ${finalState.level}, last loaded ${lastLevel}`
+      )
+    }
+    if (!isCount(finalState.score) || finalState.score > maxScore) {
+      return fail(
+        'SCORE_OUT_OF_RANGE',
+        `Score ${finalState.score} outside 0 to ${maxScore}`
+      )
+    }
+    const maxFuel = FUELSTART + fuelCells * FUELGAIN
+    if (!isCount(finalState.fuel) || finalState.fuel > maxFuel) {
+      return fail(
+        'FUEL_OUT_OF_RANGE',
+        `Fuel ${finalState.fuel} outside 0 to ${maxFuel}`
+      )
+    }
+  }
+
+  return { plausible: true, errors: [] }
+}
+
+/**
+ * A failed validation report for a recording the pre-filter rejected, so
+ * callers can show it like any other failure
+ */
+const implausibleReport = (report: PlausibilityReport): ValidationReport => ({
+  success: false,
+  framesValidated: 0,
+  snapshotsChecked: 0,
+  divergenceFrame: null,
+  finalStateMatch: false,
+  errors: report.errors.map(error => ({
+    frame: error.frame ?? 0,
+    type: 'IMPLAUSIBLE',
+    message: error.message
+  }))
+})
+
+export {
+  checkPlausibility,
+  implausibleReport,
+  MIN_FRAMES_PER_LEVEL,
+  type PlausibilityError,
+  type PlausibilityErrorType,
+  type PlausibilityReport
+}
@@ -0,0 +1,174 @@
+import { describe, it, expect } from 'vitest'
+import {
+  mkdtempSync,
+  readdirSync,
+  readFileSync,
+  rmSync,
+  writeFileSync
+} from 'fs'
+import { tmpdir } from 'os'
+import { join } from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import { decodeRecordingAuto } from '@core/recording/binaryCodec'
+import type { GameRecording } from '@core/recording'
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import { decompress } from '../../../scripts/gzip.node'
+import { createValidationCacheNode } from './createValidationCacheNode'
+import type { ValidationReport } from './StreamingValidator'
+import {
+  createValidationCacheMemory,
+  validateCached,
+  validationCacheKey,
+  type ValidationCacheStore
+} from './validationCache'
+
+const CORPUS_DIR = join(__dirname, '../../../corpus')
+const PUBLIC_DIR = join(__dirname, '../../game/public')
+
+const releaseGalaxy = createGalaxyServiceNode(
+  join(PUBLIC_DIR, 'release_galaxy.bin')
+)
+const continuumGalaxy = createGalaxyServiceNode(
+  join(PUBLIC_DIR, 'galaxies/continuum_galaxy.bin')
+)
+
+const loadRecording = (): Promise<GameRecording> => {
+  const buffer = readFileSync(join(CORPUS_DIR, 'tour-release.bin'))
+  return decodeRecordingAuto(
+    buffer.buffer.slice(
+      buffer.byteOffset,
+      buffer.byteOffset + buffer.byteLength
+    ),
+    decompress
+  )
+}
+
+const PASSED: ValidationReport = {
+  success: true,
+  framesValidated: 10,
+  snapshotsChecked: 1,
+  divergenceFrame: null,
+  finalStateMatch: true,
+  errors: []
+}
+
+// Counts how often the validation actually runs
+const countingValidator = (): {
+  calls: () => number
+  validate: () => { report: ValidationReport; finalStateHash: string }
+} => {
+  let calls = 0
+  return {
+    calls: (): number => calls,
+    validate: (): { report: ValidationReport; finalStateHash: string } => {
+      calls++
+      return { report: PASSED, finalStateHash: '1a2b3c' }
+    }
+  }
+}
+
+describe('validationCacheKey', () => {
+  it('changes with the recording, galaxy and engine version', async () => {
+    const recording = await loadRecording()
+    const key = await validationCacheKey(recording, releaseGalaxy)
+    expect(key.startsWith(`${GAME_ENGINE_VERSION}-`)).toBe(true)
+    expect(await validationCacheKey(recording, releaseGalaxy)).toBe(key)
+
+    const edited = structuredClone(recording)
+    edited.finalState!.score++
+    const keys = [
+      key,
+      await validationCacheKey(edited, releaseGalaxy),
+      await validationCacheKey(recording, continuumGalaxy),
+      await validationCacheKey(
+        recording,
+        releaseGalaxy,
+        GAME_ENGINE_VERSION + 1
+      )
+    ]
+    expect(new Set(keys).size).toBe(keys.length)
+  })
+})
+
+describe('validateCached', () => {
+  it('validates on a miss and answers from the store after', async () => {
+    const recording = await loadRecording()
+    const store = createValidationCacheMemory()
+    const validator = countingValidator()
+
+    const first = await validateCached(
+      recording,
+      releaseGalaxy,
+      store,
+      validator.validate
+    )
+    const second = await validateCached(
+      recording,
+      releaseGalaxy,
+      store,
+      validator.validate
+    )
+
+    expect(validator.calls()).toBe(1)
+    expect(first.cached).toBe(false)
+    expect(second).toEqual({ ...first, cached: true })
+    expect(second.report).toEqual(PASSED)
+    expect(second.finalStateHash).toBe('1a2b3c')
+  })
+
+  it('validates anyway when the store fails', async () => {
+    const broken: ValidationCacheStore = {
+      get: (): Promise<null> => Promise.reject(new Error('unavailable')),
+      set: (): Promise<void> => Promise.reject(new Error('unavailable'))
+    }
+    const validator = countingValidator()
+    const warn = console.warn
+    console.warn = (): void => {}
+    try {
+      const result = await validateCached(
+        await loadRecording(),
+        releaseGalaxy,
+        broken,
+        validator.validate
+      )
+      expect(result.cached).toBe(false)
+      expect(result.report).toEqual(PASSED)
+    } finally {
+      console.warn = warn
+    }
+    expect(validator.calls()).toBe(1)
+  })
+})
+
+describe('createValidationCacheNode', () => {
+  it('keeps entries across opens and drops other engine versions', async () => {
+    const directory = mkdtempSync(join(tmpdir(), 'validation-cache-'))
+    try {
+      const recording = await loadRecording()
+      const validator = countingValidator()
+      const stale = `${GAME_ENGINE_VERSION - 1}-stale.json`
+      writeFileSync(join(directory, stale), '{}')
+
+      await validateCached(
+        recording,
+        releaseGalaxy,
+        createValidationCacheNode(directory),
+        validator.validate
+      )
+      const reopened = await validateCached(
+        recording,
+        releaseGalaxy,
+        createValidationCacheNode(directory),
+        validator.validate
+      )
+
+      expect(validator.calls()).toBe(1)
+      expect(reopened.cached).toBe(true)
+      expect(readdirSync(directory)).toEqual([
+        `${await validationCacheKey(recording, releaseGalaxy)}.json`
+      ])
+    } finally {
+      rmSync(directory, { recursive: true, force: true })
+    }
+  })
+})
@@ -0,0 +1,161 @@
+/**
+ * @fileoverview Content-addressed cache of validation results
+ *
+ * Whether a recording validates depends only on the recording, the galaxy
+ * it was played on and the engine replaying it. The cache key hashes all
+ * three, so validating the same recording again - after a restart, or as a
+ * duplicate upload - is a lookup instead of a full simulation. Keys start
+ * with the engine version, so a version bump misses every older entry.
+ *
+ * Stores are pluggable: createValidationCacheNode keeps one file per entry
+ * for the scripts, createValidationCacheIndexedDB keeps them in the
+ * browser.
+ */
+
+import type { GalaxyService } from '@core/galaxy'
+import type { GameRecording } from '@core/recording'
+import { encodeRecording } from '@core/recording/binaryCodec'
+import { GAME_ENGINE_VERSION } from '@/game/version'
+import type { ValidationReport } from './StreamingValidator'
+
+type ValidationCacheEntry = {
+  engineVersion: number
+  report: ValidationReport
+  /** hashState of the final state, or null if nothing was simulated */
+  finalStateHash: string | null
+  /** Time the validation took, in ms */
+  durationMs: number
+  /** When the validation ran, from Date.now() */
+  validatedAt: number
+}
+
+type ValidationCacheStore = {
+  get: (key: string) => Promise<ValidationCacheEntry | null>
+  set: (key: string, entry: ValidationCacheEntry) => Promise<void>
+}
+
+type CachedValidation = ValidationCacheEntry & {
+  /** The result came from the cache rather than a simulation */
+  cached: boolean
+}
+
+const toHex = (buffer: ArrayBuffer): string =>
+  Array.from(new Uint8Array(buffer), byte =>
+    byte.toString(16).padStart(2, '0')
+  ).join('')
+
+const sha256 = async (data: BufferSource): Promise<string> =>
+  toHex(await crypto.subtle.digest('SHA-256', data))
+
+// A galaxy service swaps in a new planets buffer when it loads a galaxy
+const galaxyHashes = new WeakMap<ArrayBuffer, Promise<string>>()
+
+/**
+ * Hash of the galaxy a service holds: the planet index and every planet's
+ * bytes
+ */
+const galaxyContentHash = (galaxyService: GalaxyService): Promise<string> => {
+  const planetsBuffer = galaxyService.getPlanetsBuffer()
+  let hash = galaxyHashes.get(planetsBuffer)
+  if (!hash) {
+    const { indexes } = galaxyService.getHeader()
+    const content = new Uint8Array(indexes.length + planetsBuffer.byteLength)
+    content.set(indexes)
+    content.set(new Uint8Array(planetsBuffer), indexes.length)
+    hash = sha256(content)
+    galaxyHashes.set(planetsBuffer, hash)
+  }
+  return hash
+}
+
+/**
+ * Cache key for validating a recording against a galaxy
+ *
+ * The recording is hashed in its uncompressed binary encoding, so the same
+ * game saved as JSON, binary or gzipped binary shares one entry.
+ */
+const validationCacheKey = async (
+  recording: GameRecording,
+  galaxyService: GalaxyService,
+  engineVersion: number = GAME_ENGINE_VERSION
+): Promise<string> => {
+  const [recordingHash, galaxyHash] = await Promise.all([
+    sha256(encodeRecording(recording)),
+    galaxyContentHash(galaxyService)
+  ])
+  const content = new TextEncoder().encode(`${galaxyHash}:${recordingHash}`)
+  return `${engineVersion}-${await sha256(content)}`
+}
+
+/**
+ * Validate a recording unless the cache already holds its result
+ *
+ * @param recording - Recording to validate
+ * @param galaxyService - Service holding the recording's galaxy
+ * @param store - Cache to check first and fill after, or null for none
+ * @param validate - Runs the validation on a miss
+ */
+const validateCached = async (
+  recording: GameRecording,
+  galaxyService: GalaxyService,
+  store: ValidationCacheStore | null,
+  validate: () => Pick<ValidationCacheEntry, 'report' | 'finalStateHash'>
+): Promise<CachedValidation> => {
+  // A broken store only costs the simulation it would have saved
+  let key: string | null = null
+  if (store) {
+    try {
+      key = await validationCacheKey(recording, galaxyService)
+      const hit = await store.get(key)
+      if (hit?.engineVersion === GAME_ENGINE_VERSION) {
+        return { ...hit, cached: true }
+      }
+    } catch (error) {
+      console.warn('Validation cache lookup failed:', error)
+    }
+  }
+
+  const start = performance.now()
+  const { report, finalStateHash } = validate()
+  const entry: ValidationCacheEntry = {
+    engineVersion: GAME_ENGINE_VERSION,
+    report,
+    finalStateHash,
+    durationMs: performance.now() - start,
+    validatedAt: Date.now()
+  }
+
+  if (store && key) {
+    try {
+      await store.set(key, entry)
+    } catch (error) {
+      console.warn('Validation cache write failed:', error)
+    }
+  }
+  return { ...entry, cached: false }
+}
+
+/**
+ * A cache that lasts as long as the process, for long-running validators
+ * and tests
+ */
+const createValidationCacheMemory = (): ValidationCacheStore => {
+  const entries = new Map<string, ValidationCacheEntry>()
+  return {
+    get: async (key): Promise<ValidationCacheEntry | null> =>
+      entries.get(key) ?? null,
+    set: async (key, entry): Promise<void> => {
+      entries.set(key, entry)
+    }
+  }
+}
+
+export {
+  createValidationCacheMemory,
+  galaxyContentHash,
+  validateCached,
+  validationCacheKey,
+  type CachedValidation,
+  type ValidationCacheEntry,
+  type ValidationCacheStore
+}
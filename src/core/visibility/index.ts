@@ -0,0 +1,8 @@
+/**
+ * @fileoverview Visibility module - Incremental visible-set tracking
+ */
+
+export type { VisibleSet, VisibilityState } from './visibleSet'
+export { getVisibleSet } from './visibleSet'
+export type { SlidingWindow } from './slidingWindow'
+export { createSlidingWindow, lowerBound } from './slidingWindow'
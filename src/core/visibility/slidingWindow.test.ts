@@ -0,0 +1,42 @@
+import { describe, it, expect } from 'vitest'
+import {
+  createSlidingWindow,
+  lowerBound,
+  seekLowerBound
+} from './slidingWindow'
+
+describe('lowerBound', () => {
+  it('finds the first key at or after x', () => {
+    const keys = [1, 3, 3, 7]
+    expect(lowerBound(keys, 0)).toBe(0)
+    expect(lowerBound(keys, 3)).toBe(1)
+    expect(lowerBound(keys, 4)).toBe(3)
+    expect(lowerBound(keys, 8)).toBe(4)
+    expect(lowerBound([], 8)).toBe(0)
+  })
+})
+
+describe('seekLowerBound', () => {
+  it('agrees with lowerBound from any starting cursor', () => {
+    const keys = Array.from({ length: 500 }, (_, i) => Math.floor(i / 3) * 5)
+    for (const cursor of [0, 10, 250, 499, 500]) {
+      for (const x of [-10, 0, 7, 400, 420, 830, 2000]) {
+        expect(seekLowerBound(keys, cursor, x)).toBe(lowerBound(keys, x))
+      }
+    }
+  })
+})
+
+describe('createSlidingWindow', () => {
+  it('tracks the keys in range as the view scrolls and jumps', () => {
+    const keys = Array.from({ length: 200 }, (_, i) => i * 10)
+    const window = createSlidingWindow(keys)
+
+    for (const from of [0, 4, 13, 40, 1700, 1690, -50, 600]) {
+      expect(window.move(from, from + 100)).toEqual({
+        lo: lowerBound(keys, from),
+        hi: lowerBound(keys, from + 100)
+      })
+    }
+  })
+})
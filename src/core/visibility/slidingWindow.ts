@@ -0,0 +1,67 @@
+/**
+ * @fileoverview Cursor pair over ascending keys that slides with the view
+ */
+
+// Cursor moves longer than this fall back to a binary search, which covers
+// level starts and jumps across the world-wrap seam
+const MAX_WALK = 32
+
+/**
+ * Index of the first key >= x (keys.length if none)
+ */
+export const lowerBound = (keys: readonly number[], x: number): number => {
+  let lo = 0
+  let hi = keys.length
+  while (lo < hi) {
+    const mid = (lo + hi) >>> 1
+    if (keys[mid]! < x) {
+      lo = mid + 1
+    } else {
+      hi = mid
+    }
+  }
+  return lo
+}
+
+/**
+ * lowerBound(keys, x), starting from a previous answer
+ *
+ * Cost is proportional to the number of keys crossed for small moves.
+ */
+export const seekLowerBound = (
+  keys: readonly number[],
+  cursor: number,
+  x: number
+): number => {
+  let i = cursor
+  for (let steps = 0; steps < MAX_WALK; steps++) {
+    if (i < keys.length && keys[i]! < x) {
+      i++
+    } else if (i > 0 && keys[i - 1]! >= x) {
+      i--
+    } else {
+      return i
+    }
+  }
+  return lowerBound(keys, x)
+}
+
+/**
+ * Keys in [from, to) as the index range [lo, hi)
+ */
+export type SlidingWindow = {
+  move: (from: number, to: number) => { lo: number; hi: number }
+}
+
+export const createSlidingWindow = (keys: readonly number[]): SlidingWindow => {
+  let lo = 0
+  let hi = 0
+
+  return {
+    move: (from, to) => {
+      lo = seekLowerBound(keys, lo, from)
+      hi = Math.max(lo, seekLowerBound(keys, hi, to))
+      return { lo, hi }
+    }
+  }
+}
@@ -0,0 +1,199 @@
+import { describe, it, expect } from 'vitest'
+import { createGameBitmap } from '@lib/bitmap'
+import { SCRWTH, VIEWHT } from '@core/screen'
+import { createRandomService, LINE_KIND } from '@core/shared'
+import { createWall, NEW_TYPE, type NewType } from '@core/walls'
+import { initWalls } from '@core/walls/init'
+import type { Bunker, Crater, Fuel, PlanetState } from '@core/planet'
+import { blackTerrain, whiteTerrain } from '@render/walls'
+import { getVisibleSet, type VisibilityState } from './visibleSet'
+
+const WORLD = 2000
+
+const random = createRandomService()
+random.setSeed(1234)
+const rnumber = random.rnumber
+
+const makeWalls = (count: number): ReturnType<typeof createWall>[] =>
+  Array.from({ length: count }, (_, i) =>
+    createWall(
+      rnumber(WORLD - 100),
+      rnumber(1000),
+      10 + rnumber(80),
+      (1 + rnumber(8)) as NewType,
+      rnumber(3) as 0 | 1 | 2,
+      i
+    )
+  ).sort((a, b) => a.startx - b.startx)
+
+const makePlanet = (
+  points: { bunkers?: Bunker[]; fuels?: Fuel[]; craters?: Crater[] } = {}
+): PlanetState => ({
+  worldwidth: WORLD,
+  worldheight: 1000,
+  worldwrap: true,
+  shootslow: 0,
+  xstart: 0,
+  ystart: 0,
+  planetbonus: 0,
+  gravx: 0,
+  gravy: 0,
+  numcraters: points.craters?.length ?? 0,
+  lines: [],
+  bunkers: points.bunkers ?? [],
+  fuels: points.fuels ?? [],
+  craters: points.craters ?? [],
+  gravityPoints: [],
+  wallsSorted: true
+})
+
+const makeBunkers = (count: number): Bunker[] =>
+  Array.from({ length: count }, () => ({
+    x: rnumber(WORLD),
+    y: rnumber(1000),
+    rot: 0,
+    alive: true,
+    ranges: [],
+    kind: 0
+  }))
+
+// Scroll right across the wrap seam and back, with some vertical drift
+const viewports = (): { screenx: number; screeny: number }[] => {
+  const out = []
+  for (let x = WORLD - SCRWTH - 200; x < WORLD; x += 37) {
+    out.push({ screenx: x, screeny: 300 + (x % 50) })
+  }
+  for (let x = 900; x > 0; x -= 53) {
+    out.push({ screenx: x, screeny: 200 })
+  }
+  return out
+}
+
+describe('getVisibleSet', () => {
+  it('leaves black and white terrain output unchanged', () => {
+    const walls = initWalls(makeWalls(400))
+    const planet = makePlanet()
+
+    for (const screen of viewports()) {
+      const state: VisibilityState = { walls, planet, screen }
+      const visible = getVisibleSet(state)
+      const viewport = {
+        x: screen.screenx,
+        y: screen.screeny,
+        b: screen.screeny + VIEWHT,
+        r: screen.screenx + SCRWTH
+      }
+
+      for (const kind of [LINE_KIND.NORMAL, LINE_KIND.BOUNCE]) {
+        const deps = {
+          thekind: kind,
+          kindPointers: walls.kindPointers,
+          organizedWalls: walls.organizedWalls,
+          viewport,
+          worldwidth: WORLD
+        }
+        expect(visible.kindStarts[kind]).not.toBeUndefined()
+        expect(
+          blackTerrain({ ...deps, startId: visible.kindStarts[kind] })(
+            createGameBitmap()
+          ).data
+        ).toEqual(blackTerrain(deps)(createGameBitmap()).data)
+      }
+
+      const whiteDeps = {
+        whites: walls.whites,
+        junctions: walls.junctions,
+        firstWhite: walls.firstWhite,
+        organizedWalls: walls.organizedWalls,
+        viewport,
+        worldwidth: WORLD
+      }
+      expect(
+        whiteTerrain({ ...whiteDeps, whiteStartId: visible.whiteStart })(
+          createGameBitmap()
+        ).data
+      ).toEqual(whiteTerrain(whiteDeps)(createGameBitmap()).data)
+    }
+  })
+
+  it('contains every bunker the do_bunkers passes would consider', () => {
+    const walls = initWalls(makeWalls(10))
+    const bunkers = makeBunkers(300)
+    const planet = makePlanet({ bunkers })
+
+    for (const screen of viewports()) {
+      const { bunkers: visible } = getVisibleSet({ walls, planet, screen })
+      expect([...visible].sort((a, b) => a - b)).toEqual(visible)
+
+      const onRightSide = screen.screenx > WORLD - SCRWTH
+      bunkers.forEach((bp, i) => {
+        const inPass = (scrnx: number): boolean =>
+          bp.x > scrnx - 48 &&
+          bp.x < scrnx + SCRWTH + 48 &&
+          bp.y - screen.screeny > -48 &&
+          bp.y - screen.screeny < VIEWHT + 48
+        if (
+          inPass(screen.screenx) ||
+          (onRightSide && inPass(screen.screenx - WORLD))
+        ) {
+          expect(visible).toContain(i)
+        }
+      })
+    }
+  })
+
+  it('skips the holes parsePlanet leaves before the fuel end marker', () => {
+    const fuel = (x: number, y: number): Fuel => ({
+      x,
+      y,
+      alive: true,
+      currentfig: 1,
+      figcount: 1
+    })
+    const fuels: Fuel[] = [fuel(150, 150), fuel(200, 160)]
+    fuels[5] = { ...fuel(20000, 0), alive: false }
+
+    const { fuels: visible } = getVisibleSet({
+      walls: initWalls(makeWalls(10)),
+      planet: makePlanet({ fuels }),
+      screen: { screenx: 100, screeny: 100 }
+    })
+    expect(visible).toEqual([0, 1])
+  })
+
+  it('picks up new craters and starts over for a new level', () => {
+    const screen = { screenx: 100, screeny: 100 }
+    const walls = initWalls(makeWalls(10))
+    const planet = makePlanet({ craters: [{ x: 2000 - 1, y: 150 }] })
+    expect(getVisibleSet({ walls, planet, screen }).craters).toEqual([])
+
+    const withCrater = makePlanet({
+      craters: [...planet.craters, { x: 150, y: 150 }]
+    })
+    expect(
+      getVisibleSet({ walls, planet: withCrater, screen }).craters
+    ).toEqual([1])
+
+    const nextLevel = initWalls([
+      createWall(120, 150, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 0)
+    ])
+    expect(
+      getVisibleSet({ walls: nextLevel, planet: makePlanet(), screen })
+        .kindStarts[LINE_KIND.NORMAL]
+    ).toBe('line-0')
+  })
+
+  it('falls back to a full walk for lists not in startx order', () => {
+    const walls = initWalls([
+      createWall(500, 100, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 0),
+      createWall(100, 100, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 1)
+    ])
+    const set = getVisibleSet({
+      walls,
+      planet: makePlanet(),
+      screen: { screenx: 0, screeny: 0 }
+    })
+    expect(set.kindStarts[LINE_KIND.NORMAL]).toBeUndefined()
+    expect(set.kindStarts[LINE_KIND.BOUNCE]).toBeNull()
+  })
+})
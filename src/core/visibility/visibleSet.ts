@@ -0,0 +1,385 @@
+/**
+ * @fileoverview Frame-to-frame tracking of what is near the viewport
+ *
+ * The terrain, bunker, fuel and crater loops each walk their whole list
+ * every frame to find the few entries that are on screen. The view only
+ * moves a few pixels per tick, so instead this keeps sliding-window
+ * cursors into x-sorted indexes of those lists (the walls state's
+ * kindIndex for the wall kinds) and moves them by however many entries
+ * entered or left the view.
+ *
+ * The sets are candidates, not final answers: every consumer still runs
+ * its original visibility test on them, so output is unchanged. They are
+ * supersets of what the original loops would draw, including the
+ * world-wrap pass, and point sets keep original list order.
+ *
+ * A tracker is created per walls state. initWalls replaces that object on
+ * every level load, so a new level always starts from fresh cursors.
+ */
+
+import { SCRWTH, VIEWHT, type ScreenState } from '@core/screen'
+import type { PlanetState } from '@core/planet'
+import { LINE_KIND, type LineKind, type LineRec } from '@core/shared'
+import type { WallsState } from '@core/walls'
+import { createSlidingWindow } from './slidingWindow'
+
+// Wall scans look this far left of the screen (Terrain.c LEFT_MARGIN)
+const WALL_LEFT_MARGIN = 10
+
+// Larger than any bunker, fuel or crater half-size
+const POINT_MARGIN = 64
+
+// Larger than the collision line width
+const LINE_MARGIN = 8
+
+export type VisibleSet = {
+  /**
+   * Per kind, the wall the first black_terrain pass can start walking
+   * from: at or before the first wall it could reach, or null when it can
+   * reach none. Undefined when that kind's list is not in startx order and
+   * must be walked from its head.
+   */
+  kindStarts: Record<LineKind, string | null | undefined>
+
+  /** Same for the NNE white list walked by white_terrain */
+  whiteStart: string | null | undefined
+
+  /** Walls of any kind that touch the view or its wrapped copy */
+  collisionWalls: readonly LineRec[]
+
+  /** Indices into the planet arrays, ascending */
+  bunkers: readonly number[]
+  fuels: readonly number[]
+  craters: readonly number[]
+}
+
+export type VisibilityState = {
+  walls: WallsState
+  planet: PlanetState
+  screen: ScreenState
+}
+
+type View = {
+  screenx: number
+  screeny: number
+  worldwidth: number
+  onRightSide: boolean
+}
+
+/**
+ * Ids of a linked wall list, in list order
+ */
+const walkList = (
+  organizedWalls: Record<string, LineRec>,
+  firstId: string | null,
+  next: (wall: LineRec) => string | null | undefined
+): string[] => {
+  const ids: string[] = []
+  for (let id = firstId; id; ) {
+    const wall: LineRec | undefined = organizedWalls[id]
+    if (!wall) break
+    ids.push(id)
+    id = next(wall) || null
+  }
+  return ids
+}
+
+/**
+ * Window over a wall list that is in startx order, giving the first wall
+ * a scan of the view can reach
+ */
+const createListWindow = (
+  organizedWalls: Record<string, LineRec>,
+  ids: readonly string[],
+  startx: readonly number[]
+): ((view: View) => string | null) => {
+  const maxSpan = ids.reduce((span, id) => {
+    const wall = organizedWalls[id]!
+    return Math.max(span, wall.endx - wall.startx)
+  }, 0)
+
+  const window = createSlidingWindow(startx)
+  return ({ screenx }) => {
+    // Anything starting further left ends before the scan's left edge
+    const { lo } = window.move(
+      screenx - WALL_LEFT_MARGIN - maxSpan,
+      screenx + SCRWTH
+    )
+    return ids[lo] ?? null
+  }
+}
+
+/**
+ * Window over one kind's list, or null if it is not in startx order
+ *
+ * The kind index holds the list's walls in stable startx order, so it is
+ * the list itself exactly when the list is sorted.
+ */
+const createKindWindow = (
+  walls: WallsState,
+  kind: LineKind
+): ((view: View) => string | null) | null => {
+  const { ids, startx } = walls.kindIndex[kind]
+  const list = walkList(
+    walls.organizedWalls,
+    walls.kindPointers[kind],
+    wall => wall.nextId
+  )
+  const inListOrder =
+    list.length === ids.length && list.every((id, i) => id === ids[i])
+  return inListOrder
+    ? createListWindow(walls.organizedWalls, ids, startx)
+    : null
+}
+
+/**
+ * Window over the NNE white list, which spans every kind and so is not
+ * in the kind index, or null if it is not in startx order
+ */
+const createWhiteWindow = (
+  walls: WallsState
+): ((view: View) => string | null) | null => {
+  const ids = walkList(
+    walls.organizedWalls,
+    walls.firstWhite || null,
+    wall => wall.nextwhId
+  )
+  const startx = ids.map(id => walls.organizedWalls[id]!.startx)
+  const inListOrder = startx.every((x, i) => i === 0 || x >= startx[i - 1]!)
+  return inListOrder
+    ? createListWindow(walls.organizedWalls, ids, startx)
+    : null
+}
+
+/**
+ * Window over all walls for the collision map, in both wrap positions
+ *
+ * One pair of cursors per kind, over the kind index. Normal and bounce
+ * walls mark the map with different values, so the order between kinds
+ * changes neither the map nor the owner of any pixel that can collide.
+ */
+const createCollisionWindow = (
+  walls: WallsState
+): ((view: View) => LineRec[]) => {
+  const kinds = Object.values(LINE_KIND).map(kind => {
+    const { ids, startx } = walls.kindIndex[kind]
+    const lines = ids.map(id => walls.organizedWalls[id]!)
+    return {
+      lines,
+      maxSpan: lines.reduce(
+        (span, wall) => Math.max(span, wall.endx - wall.startx),
+        0
+      ),
+      main: createSlidingWindow(startx),
+      wrapped: createSlidingWindow(startx)
+    }
+  })
+
+  const collect = (
+    out: LineRec[],
+    lines: readonly LineRec[],
+    range: { lo: number; hi: number },
+    left: number,
+    top: number
+  ): void => {
+    const bot = top + VIEWHT + 2 * LINE_MARGIN
+    for (let i = range.lo; i < range.hi; i++) {
+      const wall = lines[i]!
+      if (
+        wall.endx >= left &&
+        Math.max(wall.starty, wall.endy) >= top &&
+        Math.min(wall.starty, wall.endy) < bot
+      ) {
+        out.push(wall)
+      }
+    }
+  }
+
+  return ({ screenx, screeny, worldwidth, onRightSide }) => {
+    const out: LineRec[] = []
+    const left = screenx - LINE_MARGIN
+    const right = screenx + SCRWTH + LINE_MARGIN
+    const top = screeny - LINE_MARGIN
+
+    for (const { lines, maxSpan, main, wrapped } of kinds) {
+      collect(out, lines, main.move(left - maxSpan, right), left, top)
+      if (onRightSide) {
+        const range = wrapped.move(
+          left - worldwidth - maxSpan,
+          right - worldwidth
+        )
+        // A wall already found by the main window is in the map either way
+        collect(out, lines, range, left - worldwidth, top)
+      }
+    }
+    return out
+  }
+}
+
+/**
+ * Window over fixed points (bunkers, fuels, craters)
+ *
+ * @param count - Entries before the list's end marker
+ */
+const createPointWindow = (
+  points: readonly ({ x: number; y: number } | undefined)[],
+  count: number
+): ((view: View) => number[]) => {
+  // The fuel list has holes before its end marker, which the drawing
+  // loops skip
+  const order = Array.from({ length: count }, (_, i) => i)
+    .filter(i => points[i])
+    .sort((a, b) => points[a]!.x - points[b]!.x)
+  const xs = order.map(i => points[i]!.x)
+  const main = createSlidingWindow(xs)
+  const wrapped = createSlidingWindow(xs)
+  // Marks the entries found this view, so both passes yield each once
+  // and the result comes out in list order without sorting
+  const found = new Uint8Array(Math.max(0, count))
+
+  return ({ screenx, screeny, worldwidth, onRightSide }) => {
+    const top = screeny - POINT_MARGIN
+    const bot = screeny + VIEWHT + POINT_MARGIN
+    const right = screenx + SCRWTH + POINT_MARGIN
+    let first = found.length
+    let last = -1
+
+    const collect = (range: { lo: number; hi: number }): void => {
+      for (let i = range.lo; i < range.hi; i++) {
+        const index = order[i]!
+        const y = points[index]!.y
+        if (y >= top && y <= bot) {
+          found[index] = 1
+          first = Math.min(first, index)
+          last = Math.max(last, index)
+        }
+      }
+    }
+
+    collect(main.move(screenx - POINT_MARGIN, right))
+    // The wrap passes only bound the right edge (draw_craters has no
+    // left bound at all), so the wrapped window is open to the left
+    if (onRightSide) {
+      collect(wrapped.move(-Infinity, right - worldwidth))
+    }
+
+    const indices: number[] = []
+    for (let index = first; index <= last; index++) {
+      if (found[index]) {
+        indices.push(index)
+        found[index] = 0
+      }
+    }
+    return indices
+  }
+}
+
+/**
+ * Entries before the first element matching an end marker
+ */
+const countBefore = <T>(
+  items: readonly (T | undefined)[],
+  isEnd: (item: T) => boolean
+): number => {
+  const end = items.findIndex(item => item !== undefined && isEnd(item))
+  return end === -1 ? items.length : end
+}
+
+type Tracker = {
+  update: (planet: PlanetState, screen: ScreenState) => VisibleSet
+}
+
+const createTracker = (walls: WallsState, planet: PlanetState): Tracker => {
+  const kindWindows = {} as Record<
+    LineKind,
+    ReturnType<typeof createKindWindow>
+  >
+  for (const kind of Object.values(LINE_KIND)) {
+    kindWindows[kind] = createKindWindow(walls, kind)
+  }
+  const whiteWindow = createWhiteWindow(walls)
+  const collisionWindow = createCollisionWindow(walls)
+
+  // Bunkers and fuels never move within a level
+  const bunkerWindow = createPointWindow(
+    planet.bunkers,
+    countBefore(planet.bunkers, bunker => bunker.rot < 0)
+  )
+  const fuelWindow = createPointWindow(
+    planet.fuels,
+    countBefore(planet.fuels, fuel => fuel.x >= 10000)
+  )
+
+  // Craters are added when bunkers die, so that window is rebuilt then
+  let craters = planet.craters
+  let numcraters = planet.numcraters
+  let craterWindow = createPointWindow(
+    craters,
+    Math.min(numcraters, craters.length)
+  )
+
+  let last: { screenx: number; screeny: number; set: VisibleSet } | null =
+    null
+
+  return {
+    update: (planet, screen) => {
+      const cratersChanged =
+        planet.craters !== craters || planet.numcraters !== numcraters
+      if (cratersChanged) {
+        craters = planet.craters
+        numcraters = planet.numcraters
+        craterWindow = createPointWindow(
+          craters,
+          Math.min(numcraters, craters.length)
+        )
+      }
+
+      const { screenx, screeny } = screen
+      if (
+        last &&
+        !cratersChanged &&
+        last.screenx === screenx &&
+        last.screeny === screeny
+      ) {
+        return last.set
+      }
+
+      const view: View = {
+        screenx,
+        screeny,
+        worldwidth: planet.worldwidth,
+        onRightSide: screenx > planet.worldwidth - SCRWTH
+      }
+
+      const kindStarts = {} as VisibleSet['kindStarts']
+      for (const kind of Object.values(LINE_KIND)) {
+        kindStarts[kind] = kindWindows[kind]?.(view)
+      }
+
+      const set: VisibleSet = {
+        kindStarts,
+        whiteStart: whiteWindow?.(view),
+        collisionWalls: collisionWindow(view),
+        bunkers: bunkerWindow(view),
+        fuels: fuelWindow(view),
+        craters: craterWindow(view)
+      }
+      last = { screenx, screeny, set }
+      return set
+    }
+  }
+}
+
+const trackers = new WeakMap<WallsState, Tracker>()
+
+/**
+ * Candidates near the current view for the state's level
+ */
+export const getVisibleSet = (state: VisibilityState): VisibleSet => {
+  let tracker = trackers.get(state.walls)
+  if (!tracker) {
+    tracker = createTracker(state.walls, state.planet)
+    trackers.set(state.walls, tracker)
+  }
+  return tracker.update(state.planet, state.screen)
+}
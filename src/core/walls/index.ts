@@ -10,3 +10,4 @@ export { wallsSlice, wallsActions } from './wallsSlice'
 
 // Wall functions
 export { createWall } from './unpack'
+export { buildKindIndex } from './kindIndex'
@@ -7,6 +7,7 @@ import type {
 } from '../types'
 import { initWhites } from './initWhites'
 import { LINE_KIND_EXT, NEW_TYPE } from '../constants'
+import { buildKindIndex } from '../kindIndex'
 
 /**
  * Main initialization entry point for the wall system.
@@ -60,7 +61,8 @@ export function initWalls(walls: LineRec[]): WallsState {
     junctions,
     whites,
     updatedWalls,
-    altEndpoints
+    altEndpoints,
+    kindIndex: buildKindIndex(walls)
   }
 }
 
@@ -0,0 +1,37 @@
+import { describe, it, expect } from 'vitest'
+import { LINE_KIND, NEW_TYPE } from './constants'
+import { buildKindIndex } from './kindIndex'
+import { initWalls } from './init'
+import { createWall } from './unpack'
+
+describe('buildKindIndex', () => {
+  it('orders each kind by startx without disturbing equal keys', () => {
+    const walls = [
+      createWall(300, 10, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 0),
+      createWall(100, 10, 20, NEW_TYPE.S, LINE_KIND.BOUNCE, 1),
+      createWall(100, 50, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 2),
+      createWall(100, 90, 20, NEW_TYPE.E, LINE_KIND.NORMAL, 3),
+      createWall(50, 10, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 4)
+    ]
+
+    const index = buildKindIndex(walls)
+    expect(index[LINE_KIND.NORMAL]).toEqual({
+      ids: ['line-4', 'line-2', 'line-3', 'line-0'],
+      startx: [50, 100, 100, 300]
+    })
+    expect(index[LINE_KIND.BOUNCE].ids).toEqual(['line-1'])
+    expect(index[LINE_KIND.GHOST].ids).toEqual([])
+  })
+
+  it('is built by initWalls while the kind lists keep input order', () => {
+    const walls = [
+      createWall(300, 10, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 0),
+      createWall(100, 10, 20, NEW_TYPE.S, LINE_KIND.NORMAL, 1)
+    ]
+
+    const state = initWalls(walls)
+    expect(state.kindPointers[LINE_KIND.NORMAL]).toBe('line-0')
+    expect(state.organizedWalls['line-0']!.nextId).toBe('line-1')
+    expect(state.kindIndex[LINE_KIND.NORMAL].ids).toEqual(['line-1', 'line-0'])
+  })
+})
@@ -0,0 +1,34 @@
+/**
+ * @fileoverview Sorted per-kind wall indexes for binary-searched scans
+ *
+ * The kind linked lists keep the order walls were loaded in, as the
+ * original did. These indexes are always in startx order, even for walls
+ * created programmatically, so a scan can jump straight to the first
+ * candidate instead of walking the list from its head.
+ */
+
+import type { LineKind, LineRec, SortedWallIndex } from './types'
+import { LINE_KIND_EXT } from './constants'
+
+/**
+ * Build a stable startx-ordered index for every wall kind
+ */
+export const buildKindIndex = (
+  walls: LineRec[]
+): Record<LineKind, SortedWallIndex> => {
+  const sorted = [...walls].sort((a, b) => a.startx - b.startx)
+  const index: Partial<Record<LineKind, SortedWallIndex>> = {}
+
+  for (let kind = LINE_KIND_EXT.NORMAL; kind < LINE_KIND_EXT.NUMKINDS; kind++) {
+    index[kind] = { ids: [], startx: [] }
+  }
+  for (const wall of sorted) {
+    const entry = index[wall.kind]
+    if (entry) {
+      entry.ids.push(wall.id)
+      entry.startx.push(wall.startx)
+    }
+  }
+
+  return index as Record<LineKind, SortedWallIndex>
+}
@@ -54,6 +54,17 @@ export type JunctionRec = {
   y: number
 }
 
+/**
+ * Walls of one kind in ascending startx order
+ *
+ * Parallel arrays so visibility scans can binary-search `startx` and then
+ * look up the wall by id.
+ */
+export type SortedWallIndex = {
+  ids: string[]
+  startx: number[]
+}
+
 /**
  * Wall system state
  *
@@ -75,6 +86,8 @@ export type WallsState = {
   updatedWalls: LineRec[]
   /** Update wall endpoints for alternate rendering */
   altEndpoints: Record<string, LineAlt>
+  /** Per-kind walls in stable startx order, independent of the lists */
+  kindIndex: Record<LineKind, SortedWallIndex>
 }
 
 /**
@@ -2,6 +2,9 @@ import { createSlice, type PayloadAction } from '@reduxjs/toolkit'
 import type { WallsState, LineRec } from './types'
 import { LINE_KIND } from '../shared/types/line'
 import { initWalls as initWallsImpl } from './init'
+import { buildKindIndex } from './kindIndex'
+
+const emptyKindIndex = (): WallsState['kindIndex'] => buildKindIndex([])
 
 const initialState: WallsState = {
   organizedWalls: {},
@@ -15,7 +18,8 @@ const initialState: WallsState = {
   junctions: [],
   whites: [],
   updatedWalls: [],
-  altEndpoints: {}
+  altEndpoints: {},
+  kindIndex: emptyKindIndex()
 }
 
 export const wallsSlice = createSlice({
@@ -44,6 +48,7 @@ export const wallsSlice = createSlice({
       state.junctions = []
       state.whites = []
       state.updatedWalls = []
+      state.kindIndex = emptyKindIndex()
     }
   }
 })
@@ -21,6 +21,7 @@ import GameView, {
   type BitmapGameDefinition
 } from './components/GameView'
 import { SoundTest } from './components/SoundTest'
+import { KernelABView } from './components/KernelABView'
 import { testGameLoop } from './demos/testGame'
 import { shipMoveGameLoop } from './demos/shipMove'
 import { bitmapTestRenderer } from './demos/bitmapTest'
@@ -115,6 +116,12 @@ function App({ spriteService, spriteRegistry }: AppProps): React.JSX.Element {
           >
             Sprites
           </div>
+          <div
+            className={`menu-item ${currentView === 'kernels' ? 'active' : ''}`}
+            onClick={() => dispatch(setCurrentView('kernels'))}
+          >
+            Kernels
+          </div>
           <div
             className={`menu-item ${currentView === 'settings' ? 'active' : ''}`}
             onClick={() => dispatch(setCurrentView('settings'))}
@@ -294,6 +301,8 @@ function App({ spriteService, spriteRegistry }: AppProps): React.JSX.Element {
             </div>
           )}
 
+          {currentView === 'kernels' && <KernelABView />}
+
           {currentView === 'settings' && (
             <div className="settings-view">
               <h2>SETTINGS</h2>
@@ -1,3 +1,5 @@
+import { bitmapToImageData } from '@lib/bitmap'
+
 type ScanlineData = {
   lineNumber: number
   prefixBytes: Uint8Array
@@ -184,36 +186,6 @@ export const checkMissingBorders = (
   return updatedScanlines
 }
 
-/**
- * Converts bitmap data to RGBA image data
- */
-const bitmapToImageData = (
-  bitmapData: Uint8Array,
-  width: number,
-  height: number
-): ImageData => {
-  const rowbytes = Math.ceil(width / 8)
-  const imageDataArray = new Uint8ClampedArray(width * height * 4)
-
-  for (let row = 0; row < height; row++) {
-    for (let col = 0; col < width; col++) {
-      const byteIndex = row * rowbytes + Math.floor(col / 8)
-      const bitIndex = 7 - (col % 8)
-      const byte = bitmapData[byteIndex]
-      const bit = byte !== undefined ? (byte >> bitIndex) & 1 : 0
-
-      const pixelIndex = (row * width + col) * 4
-      const value = bit ? 0 : 255 // 1 = black, 0 = white
-      imageDataArray[pixelIndex] = value // R
-      imageDataArray[pixelIndex + 1] = value // G
-      imageDataArray[pixelIndex + 2] = value // B
-      imageDataArray[pixelIndex + 3] = 255 // A
-    }
-  }
-
-  return new ImageData(imageDataArray, width, height)
-}
-
 /**
  * The file Continuum Title Page in the original source is either corrupted or an incredibly
  * unusual format.
@@ -259,7 +231,12 @@ export function continuumTitleToImageData(rawData: ArrayBuffer): {
   const newBitmap = unpackScanlinesToBitmap(repaired, width, height)
 
   // Convert bitmap to RGBA image data
-  const image = bitmapToImageData(newBitmap, width, height)
+  const image = bitmapToImageData({
+    data: newBitmap,
+    width,
+    height,
+    rowBytes: Math.ceil(width / 8)
+  })
 
   checkMissingBorders(packedScanlines, newBitmap, width, 500)
 
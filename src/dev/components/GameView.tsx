@@ -7,7 +7,13 @@ import type {
   FrameInfo,
   KeyInfo
 } from '@lib/bitmap'
-import { createMonochromeBitmap, bitmapToCanvas } from '@lib/bitmap'
+import {
+  createMonochromeBitmap,
+  bitmapToCanvas,
+  blitToPixels,
+  createPixelTable,
+  imageDataPixels
+} from '@lib/bitmap'
 import {
   StatsOverlay,
   type StatsConfig,
@@ -308,22 +314,15 @@ const GameView: React.FC<GameViewProps> = ({
                   renderedBitmap.height
                 )
                 const pixels = imageData.data
+                blitToPixels(
+                  renderedBitmap,
+                  imageDataPixels(imageData),
+                  createPixelTable(game.bitmapOptions)
+                )
 
                 for (let y = 0; y < renderedBitmap.height; y++) {
                   for (let x = 0; x < renderedBitmap.width; x++) {
-                    const byteIndex =
-                      y * renderedBitmap.rowBytes + Math.floor(x / 8)
-                    const bitMask = 0x80 >> (x % 8)
-                    const isSet =
-                      (renderedBitmap.data[byteIndex]! & bitMask) !== 0
-
                     const pixelIndex = (y * renderedBitmap.width + x) * 4
-                    const value = isSet ? 0 : 255
-
-                    pixels[pixelIndex] = value
-                    pixels[pixelIndex + 1] = value
-                    pixels[pixelIndex + 2] = value
-                    pixels[pixelIndex + 3] = 255
 
                     // Check collision map (offset by status bar height)
                     const worldX = x + viewportX
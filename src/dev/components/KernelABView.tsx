@@ -0,0 +1,179 @@
+import React, { useEffect, useMemo, useRef, useState } from 'react'
+import { bitmapToImageData, type MonochromeBitmap } from '@lib/bitmap'
+import { KERNEL_COMPARISONS } from '../kernels/comparisons'
+import {
+  findMismatchSeed,
+  fuzzInput,
+  runKernelComparison
+} from '../kernels/runKernelComparison'
+
+// Seeds tried per click of "Find Mismatch"
+const SEARCH_SEEDS = 1000
+
+type KernelCanvasProps = {
+  title: string
+  imageData: ImageData
+}
+
+const KernelCanvas: React.FC<KernelCanvasProps> = ({ title, imageData }) => {
+  const canvasRef = useRef<HTMLCanvasElement>(null)
+
+  useEffect(() => {
+    const ctx = canvasRef.current?.getContext('2d')
+    ctx?.putImageData(imageData, 0, 0)
+  }, [imageData])
+
+  return (
+    <div className="kernel-panel">
+      <h3>{title}</h3>
+      <canvas
+        ref={canvasRef}
+        width={imageData.width}
+        height={imageData.height}
+        className="graphics-canvas"
+      />
+    </div>
+  )
+}
+
+/**
+ * Output A dimmed to light gray with differing pixels in red
+ */
+const xorOverlay = (a: MonochromeBitmap, xor: MonochromeBitmap): ImageData => {
+  const imageData = bitmapToImageData(a, {
+    foregroundColor: '#A0A0A0',
+    backgroundColor: 'white'
+  })
+  const pixels = imageData.data
+  for (let y = 0; y < xor.height; y++) {
+    for (let x = 0; x < xor.width; x++) {
+      if (xor.data[y * xor.rowBytes + (x >> 3)]! & (0x80 >> (x & 7))) {
+        const i = (y * xor.width + x) * 4
+        pixels[i] = 255
+        pixels[i + 1] = 0
+        pixels[i + 2] = 0
+      }
+    }
+  }
+  return imageData
+}
+
+const formatMs = (ms: number | null): string =>
+  ms === null ? '-' : `${(ms * 1000).toFixed(1)} µs`
+
+export const KernelABView: React.FC = () => {
+  const [comparisonIndex, setComparisonIndex] = useState(0)
+  const [seed, setSeed] = useState<number | null>(null)
+  const [iterations, setIterations] = useState(1000)
+  const [searchMessage, setSearchMessage] = useState('')
+
+  const comparison = KERNEL_COMPARISONS[comparisonIndex]!
+  const input = useMemo(
+    () =>
+      seed === null ? comparison.defaultInput : fuzzInput(comparison, seed),
+    [comparison, seed]
+  )
+  const result = useMemo(
+    () => runKernelComparison(comparison, input, iterations),
+    [comparison, input, iterations]
+  )
+  const images = useMemo(
+    () => ({
+      a: bitmapToImageData(result.a),
+      b: bitmapToImageData(result.b),
+      xor: xorOverlay(result.a, result.xor)
+    }),
+    [result]
+  )
+
+  const selectComparison = (index: number): void => {
+    setComparisonIndex(index)
+    setSeed(null)
+    setSearchMessage('')
+  }
+
+  const findMismatch = (): void => {
+    const first = (seed ?? -1) + 1
+    const found = findMismatchSeed(comparison, first, SEARCH_SEEDS)
+    if (found === null) {
+      setSearchMessage(`Seeds ${first}-${first + SEARCH_SEEDS - 1} all match`)
+      setSeed(first + SEARCH_SEEDS - 1)
+    } else {
+      setSearchMessage(`Mismatch at seed ${found}`)
+      setSeed(found)
+    }
+  }
+
+  const { diff, aMs, bMs } = result
+  const speedup = aMs !== null && bMs !== null && bMs > 0 ? aMs / bMs : null
+
+  return (
+    <div className="kernel-view">
+      <div className="kernel-controls">
+        <select
+          value={comparisonIndex}
+          onChange={e => selectComparison(Number(e.target.value))}
+        >
+          {KERNEL_COMPARISONS.map((c, i) => (
+            <option key={c.name} value={i}>
+              {c.name}
+            </option>
+          ))}
+        </select>
+        <label>
+          Seed:
+          <input
+            type="number"
+            value={seed ?? ''}
+            placeholder="default"
+            onChange={e =>
+              setSeed(e.target.value === '' ? null : Number(e.target.value))
+            }
+          />
+        </label>
+        <label>
+          Iterations:
+          <input
+            type="number"
+            min={0}
+            value={iterations}
+            onChange={e => setIterations(Math.max(0, Number(e.target.value)))}
+          />
+        </label>
+        <button
+          className="mac-button"
+          onClick={() => setSeed(Math.floor(Math.random() * 0x7fffffff))}
+        >
+          Fuzz
+        </button>
+        <button className="mac-button" onClick={findMismatch}>
+          Find Mismatch
+        </button>
+      </div>
+
+      <div className="kernel-summary mac-info-line">
+        <div>Input: {comparison.describeInput(input)}</div>
+        <div>
+          {diff.bounds
+            ? `${diff.changedPixels} pixels differ in ` +
+              `x ${diff.bounds.x}-${diff.bounds.x + diff.bounds.width - 1}, ` +
+              `y ${diff.bounds.y}-${diff.bounds.y + diff.bounds.height - 1} ` +
+              `(${diff.rows.length} row spans)`
+            : 'Outputs are identical'}
+        </div>
+        <div>
+          {comparison.a.name}: {formatMs(aMs)} / {comparison.b.name}:{' '}
+          {formatMs(bMs)}
+          {speedup !== null && ` (${speedup.toFixed(2)}x)`}
+        </div>
+        {searchMessage && <div>{searchMessage}</div>}
+      </div>
+
+      <div className="kernel-panels">
+        <KernelCanvas title={`A: ${comparison.a.name}`} imageData={images.a} />
+        <KernelCanvas title={`B: ${comparison.b.name}`} imageData={images.b} />
+        <KernelCanvas title="A XOR B" imageData={images.xor} />
+      </div>
+    </div>
+  )
+}
@@ -22,7 +22,7 @@ import { BunkerKind } from '@core/figs'
 import type { Bunker, PlanetState } from '@core/planet'
 import { drawDotSafe } from '@render/shots'
 import { drawStrafe } from '@render/shots'
-import { rint, createRandomService } from '@core/shared'
+import { createRandomService } from '@core/shared'
 import { SBARHT, SCRWTH, VIEWHT } from '@core/screen'
 import { isOnRightSide } from '@core/shared/viewport'
 import { viewClear } from '@render/screen'
@@ -244,7 +244,7 @@ const initializeGame = (): void => {
     // Initialize planet state with bunkers
     console.log('Initializing planet state...')
     store.dispatch(loadPlanet(createInitialPlanetState()))
-    store.dispatch(initializeBunkers())
+    store.dispatch(initializeBunkers({ seed: randomService.getSeed() }))
     console.log('Planet state initialized')
 
     initializationComplete = true
@@ -336,7 +336,7 @@ export const createBunkerDrawBitmapRenderer =
     // Check if bunkers should shoot this frame (probabilistic based on shootslow)
     // if (rint(100) < shootslow) bunk_shoot(); (Bunkers.c:30-31)
     // TESTING: Increased shot rate for easier testing (multiply by 5)
-    if (rint(100) < planetState.shootslow * 5) {
+    if (randomService.rnumber(100) < planetState.shootslow * 5) {
       // Calculate screen boundaries for shot eligibility
       const screenb = viewportState.y + bitmap.height
       const screenr = viewportState.x + bitmap.width
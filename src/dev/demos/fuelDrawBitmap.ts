@@ -14,6 +14,7 @@ import { configureStore } from '@reduxjs/toolkit'
 import { planetSlice, loadPlanet, updateFuelAnimations } from '@core/planet'
 import type { Fuel, PlanetState } from '@core/planet'
 import { isOnRightSide } from '@core/shared/viewport'
+import { RandomStream, streamSeed } from '@core/shared'
 import { FUELFRAMES } from '@core/figs'
 import type { SpriteService } from '@core/sprites'
 import { viewClear } from '@render/screen'
@@ -134,7 +135,7 @@ initializeGame()
  */
 export const createFuelDrawBitmapRenderer =
   (spriteService: SpriteService): BitmapRenderer =>
-  (_frame: FrameInfo, keys: KeyInfo) => {
+  (frame: FrameInfo, keys: KeyInfo) => {
     const bitmap = createGameBitmap()
     // Check initialization status
     if (initializationError) {
@@ -197,7 +198,11 @@ export const createFuelDrawBitmapRenderer =
     })(bitmap)
 
     // Update fuel animation state using the reducer
-    store.dispatch(updateFuelAnimations())
+    store.dispatch(
+      updateFuelAnimations({
+        seed: streamSeed(RandomStream.RENDER, 0, frame.frameCount)
+      })
+    )
 
     // Draw all fuel cells using drawFuels
     const fuelSprites = {
@@ -18,6 +18,7 @@ import { VIEWHT } from '@core/screen'
 import { isOnRightSide } from '@core/shared/viewport'
 import { doBunks } from '@render/planet'
 import { configureStore } from '@reduxjs/toolkit'
+import { RandomStream, streamSeed } from '@core/shared'
 import {
   planetSlice,
   loadPlanet,
@@ -51,7 +52,7 @@ export const createPlanetRenderer: PlanetRendererFactory = (
   bunkerStore.dispatch(loadPlanet(planet))
 
   // Initialize fuels with random animation states
-  bunkerStore.dispatch(initializeFuels())
+  bunkerStore.dispatch(initializeFuels({ seed: 0 }))
 
   // Initialize viewport to planet's starting position
   // Note: bitmap dimensions are 512x342, but viewable area is 512x318 (VIEWHT)
@@ -77,7 +78,7 @@ export const createPlanetRenderer: PlanetRendererFactory = (
   store.dispatch(gameViewActions.setInitialized())
 
   // Return the renderer function
-  const renderer: BitmapRenderer = (_frame: FrameInfo, keys: KeyInfo) => {
+  const renderer: BitmapRenderer = (frame: FrameInfo, keys: KeyInfo) => {
     const bitmap = createGameBitmap()
     const state = store.getState()
     const { walls, gameView, screen } = state
@@ -264,7 +265,11 @@ export const createPlanetRenderer: PlanetRendererFactory = (
       // Continue with fuel rendering
 
       // Update fuel cell animations
-      bunkerStore.dispatch(updateFuelAnimations())
+      bunkerStore.dispatch(
+        updateFuelAnimations({
+          seed: streamSeed(RandomStream.RENDER, 0, frame.frameCount)
+        })
+      )
 
       // Get updated planet state with animated fuels
       const updatedPlanetState = bunkerStore.getState().planet
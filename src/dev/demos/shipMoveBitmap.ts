@@ -54,7 +54,11 @@ import { checkForBounce } from '@core/ship'
 import { doBunks } from '@render/planet'
 import { drawCraters } from '@render/planet'
 import { drawFuels } from '@render/planet'
-import { rint, createRandomService } from '@core/shared'
+import {
+  createRandomService,
+  RandomStream,
+  streamSeed
+} from '@core/shared'
 import {
   startShipDeathWithRandom,
   startExplosionWithRandom,
@@ -136,10 +140,10 @@ const initializeGame = async (): Promise<void> => {
     store.dispatch(wallsSlice.actions.initWalls({ walls: planet1.lines }))
 
     // Initialize bunkers for animated bunker support
-    store.dispatch(initializeBunkers())
+    store.dispatch(initializeBunkers({ seed: randomService.getSeed() }))
 
     // Initialize fuel cells
-    store.dispatch(initializeFuels())
+    store.dispatch(initializeFuels({ seed: randomService.getSeed() }))
 
     // Initialize status state
     store.dispatch(statusSlice.actions.initStatus())
@@ -221,7 +225,7 @@ const resetGame = (): void => {
  */
 export const createShipMoveBitmapRenderer =
   (spriteService: SpriteService): BitmapRenderer =>
-  (_frame: FrameInfo, keys: KeyInfo) => {
+  (frameInfo: FrameInfo, keys: KeyInfo) => {
     const bitmap = createGameBitmap()
     // Check initialization status
     if (initializationError) {
@@ -365,12 +369,20 @@ export const createShipMoveBitmapRenderer =
     store.dispatch(updateBunkerRotations({ globalx, globaly }))
 
     // Update fuel cell animations
-    store.dispatch(updateFuelAnimations())
+    store.dispatch(
+      updateFuelAnimations({
+        seed: streamSeed(
+          RandomStream.RENDER,
+          randomService.getSeed(),
+          frameInfo.frameCount
+        )
+      })
+    )
 
     // Check if bunkers should shoot this frame (probabilistic based on shootslow)
     // From Bunkers.c:30-31: if (rint(100) < shootslow) bunk_shoot();
     // TESTING: Increased shot rate for easier testing (multiply by 20)
-    const shootRoll = rint(100)
+    const shootRoll = randomService.rnumber(100)
     if (shootRoll < state.planet.shootslow * 20) {
       // Calculate screen boundaries for shot eligibility
       const screenr = state.screen.screenx + SCRWTH
@@ -733,7 +745,8 @@ export const createShipMoveBitmapRenderer =
         shipDef: shipMaskBitmap,
         wallData: {
           kindPointers: finalState.walls.kindPointers,
-          organizedWalls: finalState.walls.organizedWalls
+          organizedWalls: finalState.walls.organizedWalls,
+          kindIndex: finalState.walls.kindIndex
         },
         viewport: viewport,
         worldwidth: finalState.planet.worldwidth
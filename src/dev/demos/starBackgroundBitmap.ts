@@ -24,6 +24,11 @@ import type { SpriteService } from '@core/sprites'
 import { SCENTER } from '@core/figs'
 import { cloneBitmap } from '@lib/bitmap'
 import { starBackground } from '@render/transition'
+import {
+  createRandomStream,
+  RandomStream,
+  streamSeed
+} from '@core/shared'
 
 // State for tracking the transition - persists across render calls
 type TransitionState = {
@@ -54,7 +59,7 @@ const FIZZ_DURATION = 26 // based on measurements of fizz time on a Mac Plus
  */
 export const createStarBackgroundBitmapRenderer =
   (spriteService: SpriteService): BitmapRenderer =>
-  (_frame: FrameInfo, keys: KeyInfo) => {
+  (frame: FrameInfo, keys: KeyInfo) => {
     const bitmap = createGameBitmap()
     // Handle spacebar press to trigger transition
     if (keys.keysDown.has('Space') && state.mode === 'normal') {
@@ -75,6 +80,9 @@ export const createStarBackgroundBitmapRenderer =
       // Create the "to" bitmap (star background with ship)
       const starBg = starBackground({
         starCount: 150,
+        random: createRandomStream(
+          streamSeed(RandomStream.RENDER, 0, frame.frameCount)
+        ),
         additionalRender: screen =>
           fullFigure({
             x: SHIP_X - SCENTER,
@@ -0,0 +1,53 @@
+/**
+ * @fileoverview In-place variant of drawHash for A/B comparison
+ *
+ * Same output as render/walls/drawHash but ORs straight into the screen it
+ * is given instead of cloning the whole 22K framebuffer for six rows.
+ */
+
+import type { MonochromeBitmap } from '@lib/bitmap'
+import { VIEWHT, SBARHT, SCRWTH } from '@core/screen'
+import { HASH_FIGURE } from '@core/walls/whiteBitmaps'
+import { LEFT_CLIP, RIGHT_CLIP, CENTER_CLIP } from '@render/walls/constants'
+import { findWAddress } from '@lib/asm/assemblyMacros'
+
+export const drawHashInPlace = (
+  deps: { x: number; y: number },
+  screen: MonochromeBitmap
+): MonochromeBitmap => {
+  const { x } = deps
+  let y = deps.y
+  let height = 6
+  let dataOffset = 0
+
+  if (y < 0) {
+    height += y
+    dataOffset = -y
+    y = 0
+  } else if (y >= VIEWHT - 6) {
+    height = VIEWHT - y
+  }
+  if (height <= 0) {
+    return screen
+  }
+
+  const clip = x < 0 ? LEFT_CLIP : x >= SCRWTH - 9 ? RIGHT_CLIP : CENTER_CLIP
+  const rotateAmount = 16 - (x & 15)
+  const data = screen.data
+  const length = data.length
+  let address = findWAddress(0, x, y + SBARHT)
+
+  for (let i = 0; i < height; i++, address += screen.rowBytes) {
+    const pattern = HASH_FIGURE[dataOffset + i]!
+    const rotated =
+      ((pattern << rotateAmount) | (pattern >>> (32 - rotateAmount))) & clip
+    if (rotated === 0) continue
+
+    if (address < length) data[address]! |= rotated >>> 24
+    if (address + 1 < length) data[address + 1]! |= (rotated >>> 16) & 0xff
+    if (address + 2 < length) data[address + 2]! |= (rotated >>> 8) & 0xff
+    if (address + 3 < length) data[address + 3]! |= rotated & 0xff
+  }
+
+  return screen
+}
@@ -0,0 +1,50 @@
+/**
+ * @fileoverview Kernel pairs available in the A/B viewer
+ *
+ * To compare a new optimized kernel against its port, add an entry here
+ * with both implementations and an input fuzzer.
+ */
+
+import { SCRWTH, VIEWHT } from '@core/screen'
+import { drawHash } from '@render/walls/drawHash'
+import { viewClear, viewClearOptimized } from '@render/screen'
+import { drawHashInPlace } from './candidates/drawHashInPlace'
+import type { AnyKernelComparison, KernelComparison } from './types'
+
+type Point = { x: number; y: number }
+
+type ScreenPosition = { screenX: number; screenY: number }
+
+const grayBackground = viewClear({ screenX: 0, screenY: 0 })
+
+const drawHashComparison: KernelComparison<Point> = {
+  name: 'drawHash',
+  a: { name: 'port', run: (input, screen) => drawHash(input)(screen) },
+  b: { name: 'in place', run: drawHashInPlace },
+  defaultInput: { x: 100, y: 100 },
+  // Include positions that clip on every edge
+  fuzz: rnumber => ({
+    x: rnumber(SCRWTH + 32) - 16,
+    y: rnumber(VIEWHT + 16) - 8
+  }),
+  describeInput: ({ x, y }) => `x=${x} y=${y}`,
+  background: grayBackground
+}
+
+const viewClearComparison: KernelComparison<ScreenPosition> = {
+  name: 'viewClear',
+  a: { name: 'port', run: (input, screen) => viewClear(input)(screen) },
+  b: {
+    name: 'optimized',
+    run: (input, screen) => viewClearOptimized(input)(screen)
+  },
+  defaultInput: { screenX: 0, screenY: 0 },
+  fuzz: rnumber => ({ screenX: rnumber(4096), screenY: rnumber(4096) }),
+  describeInput: ({ screenX, screenY }) =>
+    `screenX=${screenX} screenY=${screenY}`
+}
+
+export const KERNEL_COMPARISONS: AnyKernelComparison[] = [
+  drawHashComparison,
+  viewClearComparison
+]
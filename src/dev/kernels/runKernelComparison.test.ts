@@ -0,0 +1,56 @@
+import { describe, it, expect } from 'vitest'
+import { setPixel } from '@lib/bitmap'
+import { KERNEL_COMPARISONS } from './comparisons'
+import {
+  findMismatchSeed,
+  fuzzInput,
+  runKernelComparison
+} from './runKernelComparison'
+import type { KernelComparison } from './types'
+
+const broken: KernelComparison<{ x: number }> = {
+  name: 'broken',
+  a: { name: 'good', run: (_input, screen) => screen },
+  b: {
+    name: 'bad',
+    run: ({ x }, screen) => {
+      // Only wrong for odd x
+      if (x & 1) setPixel(screen, x, 10)
+      return screen
+    }
+  },
+  defaultInput: { x: 0 },
+  fuzz: rnumber => ({ x: rnumber(100) }),
+  describeInput: ({ x }) => `x=${x}`
+}
+
+describe('runKernelComparison', () => {
+  it('reports the XOR of the two outputs', () => {
+    const result = runKernelComparison(broken, { x: 3 })
+
+    expect(result.diff.changedPixels).toBe(1)
+    expect(result.diff.bounds).toEqual({ x: 3, y: 10, width: 1, height: 1 })
+    expect(result.xor.data[10 * result.xor.rowBytes]).toBe(0x10)
+    expect(result.aMs).toBeNull()
+  })
+
+  it('times both implementations when asked', () => {
+    const result = runKernelComparison(broken, { x: 2 }, 5)
+    expect(result.aMs).toBeGreaterThanOrEqual(0)
+    expect(result.bMs).toBeGreaterThanOrEqual(0)
+  })
+
+  it('fuzzes reproducibly and finds mismatching seeds', () => {
+    expect(fuzzInput(broken, 42)).toEqual(fuzzInput(broken, 42))
+
+    const seed = findMismatchSeed(broken, 0, 50)
+    expect(seed).not.toBeNull()
+    expect(fuzzInput<{ x: number }>(broken, seed!).x & 1).toBe(1)
+  })
+
+  it('registered candidates match their ports', () => {
+    for (const comparison of KERNEL_COMPARISONS) {
+      expect(findMismatchSeed(comparison, 0, 200), comparison.name).toBeNull()
+    }
+  })
+})
@@ -0,0 +1,131 @@
+/**
+ * @fileoverview Runs two render kernel implementations side by side
+ *
+ * Both implementations draw the same input onto identical copies of the
+ * starting screen. The outputs are compared with diffBitmaps and XORed
+ * into a third bitmap for the viewer. Timing repeats each implementation
+ * many times and includes the same screen reset in both loops, so the
+ * per-iteration numbers are directly comparable.
+ */
+
+import {
+  createGameBitmap,
+  diffBitmaps,
+  type BitmapDiff,
+  type MonochromeBitmap
+} from '@lib/bitmap'
+import { createRandomService } from '@core/shared'
+import type { AnyKernelComparison, KernelImpl } from './types'
+
+export type KernelComparisonResult = {
+  a: MonochromeBitmap
+  b: MonochromeBitmap
+
+  /** Pixels set where the two outputs differ */
+  xor: MonochromeBitmap
+
+  diff: BitmapDiff
+
+  /** Milliseconds per iteration, or null when timing was skipped */
+  aMs: number | null
+  bMs: number | null
+}
+
+/**
+ * Build the shared starting screen for a comparison
+ */
+export const createBaseScreen = (
+  comparison: AnyKernelComparison
+): MonochromeBitmap => {
+  const screen = createGameBitmap()
+  return comparison.background ? comparison.background(screen) : screen
+}
+
+const runOnCopy = <Input>(
+  impl: KernelImpl<Input>,
+  input: Input,
+  base: MonochromeBitmap
+): MonochromeBitmap => impl.run(input, { ...base, data: base.data.slice() })
+
+const timeImpl = <Input>(
+  impl: KernelImpl<Input>,
+  input: Input,
+  base: MonochromeBitmap,
+  iterations: number
+): number => {
+  const scratch: MonochromeBitmap = { ...base, data: base.data.slice() }
+  const start = performance.now()
+  for (let i = 0; i < iterations; i++) {
+    scratch.data.set(base.data)
+    impl.run(input, scratch)
+  }
+  return (performance.now() - start) / iterations
+}
+
+/**
+ * Run both implementations on one input
+ *
+ * @param iterations - Timing repetitions per implementation (0 skips timing)
+ */
+export const runKernelComparison = <Input>(
+  comparison: AnyKernelComparison,
+  input: Input,
+  iterations = 0,
+  base: MonochromeBitmap = createBaseScreen(comparison)
+): KernelComparisonResult => {
+  const a = runOnCopy(comparison.a, input, base)
+  const b = runOnCopy(comparison.b, input, base)
+
+  const xor: MonochromeBitmap = { ...a, data: new Uint8Array(a.data.length) }
+  for (let i = 0; i < xor.data.length; i++) {
+    xor.data[i] = a.data[i]! ^ b.data[i]!
+  }
+
+  const time = (impl: KernelImpl<Input>): number | null =>
+    iterations > 0 ? timeImpl(impl, input, base, iterations) : null
+
+  return {
+    a,
+    b,
+    xor,
+    diff: diffBitmaps(a, b),
+    aMs: time(comparison.a),
+    bMs: time(comparison.b)
+  }
+}
+
+/**
+ * Generate the fuzzed input for a seed
+ */
+export const fuzzInput = <Input>(
+  comparison: AnyKernelComparison,
+  seed: number
+): Input => {
+  const random = createRandomService()
+  random.setSeed(seed)
+  return comparison.fuzz(random.rnumber)
+}
+
+/**
+ * Try consecutive seeds until the two implementations disagree
+ *
+ * @returns The first mismatching seed, or null if all `count` seeds match
+ */
+export const findMismatchSeed = (
+  comparison: AnyKernelComparison,
+  firstSeed: number,
+  count: number
+): number | null => {
+  const base = createBaseScreen(comparison)
+  for (let seed = firstSeed; seed < firstSeed + count; seed++) {
+    const input = fuzzInput(comparison, seed)
+    const a = runOnCopy(comparison.a, input, base)
+    const b = runOnCopy(comparison.b, input, base)
+    for (let i = 0; i < a.data.length; i++) {
+      if (a.data[i] !== b.data[i]) {
+        return seed
+      }
+    }
+  }
+  return null
+}
@@ -0,0 +1,51 @@
+/**
+ * @fileoverview Types for the render kernel A/B harness
+ */
+
+import type { MonochromeBitmap } from '@lib/bitmap'
+
+/**
+ * One implementation of a render kernel
+ *
+ * Kernels may either return a new bitmap (like the ported routines) or
+ * draw into `screen` and return it (like in-place candidates). The
+ * harness hands each run its own copy of the starting screen.
+ */
+export type KernelImpl<Input> = {
+  name: string
+  run: (input: Input, screen: MonochromeBitmap) => MonochromeBitmap
+}
+
+/**
+ * Two implementations of the same kernel plus a way to generate inputs
+ */
+export type KernelComparison<Input> = {
+  name: string
+
+  /** Usually the current port */
+  a: KernelImpl<Input>
+
+  /** Usually the optimized candidate */
+  b: KernelImpl<Input>
+
+  /** Input shown before any fuzzing */
+  defaultInput: Input
+
+  /**
+   * Build a random input
+   * @param rnumber - Seeded generator returning integers in [0, n)
+   */
+  fuzz: (rnumber: (n: number) => number) => Input
+
+  /** Short human-readable summary of an input */
+  describeInput: (input: Input) => string
+
+  /** Renderer for the starting screen (white if omitted) */
+  background?: (screen: MonochromeBitmap) => MonochromeBitmap
+}
+
+/**
+ * Erased comparison type for registries and UI
+ */
+// eslint-disable-next-line @typescript-eslint/no-explicit-any
+export type AnyKernelComparison = KernelComparison<any>
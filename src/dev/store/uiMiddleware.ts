@@ -21,6 +21,7 @@ export type PersistedUISettings = {
     | 'graphics'
     | 'sound'
     | 'sprites'
+    | 'kernels'
   showDebugInfo: boolean
   showGameStats: boolean
   selectedGameIndex: number
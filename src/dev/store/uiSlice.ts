@@ -11,6 +11,7 @@ type UIState = {
     | 'graphics'
     | 'sound'
     | 'sprites'
+    | 'kernels'
   isGamePaused: boolean
   showDebugInfo: boolean
   showGameStats: boolean
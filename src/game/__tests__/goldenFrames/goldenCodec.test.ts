@@ -0,0 +1,51 @@
+import { describe, it, expect } from 'vitest'
+import { cloneBitmap, createMonochromeBitmap, setPixel } from '@lib/bitmap'
+import {
+  decodeRle,
+  diffFrames,
+  encodeRle,
+  fromGoldenEntry,
+  toGoldenEntry
+} from './goldenCodec'
+
+describe('goldenCodec', () => {
+  it('round-trips frames through RLE', () => {
+    const frame = createMonochromeBitmap(64, 75)
+    frame.data.fill(0xaa, 0, 300)
+    frame.data[301] = 0xff
+    frame.data.fill(0x55, 400)
+
+    const rle = encodeRle(frame.data)
+    expect(rle.length).toBeLessThan(20)
+    expect(decodeRle(rle, frame.data.length)).toEqual(frame.data)
+
+    const entry = toGoldenEntry(frame)
+    expect(fromGoldenEntry(entry, frame).data).toEqual(frame.data)
+  })
+
+  it('rejects RLE that does not match the frame size', () => {
+    const rle = encodeRle(new Uint8Array(10))
+    expect(() => decodeRle(rle, 11)).toThrow()
+  })
+
+  it('hashes differ when a single pixel changes', () => {
+    const a = createMonochromeBitmap(64, 8)
+    const b = cloneBitmap(a)
+    setPixel(b, 63, 7)
+    expect(toGoldenEntry(a).hash).not.toBe(toGoldenEntry(b).hash)
+    expect(toGoldenEntry(a).hash).toMatch(/^[0-9a-f]{8}$/)
+  })
+
+  it('describes changed pixels, bounds and rows', () => {
+    const expected = createMonochromeBitmap(32, 3)
+    const actual = cloneBitmap(expected)
+    setPixel(actual, 8, 1)
+    setPixel(actual, 15, 1)
+    setPixel(actual, 23, 1)
+
+    expect(diffFrames(expected, actual)).toBe(
+      '3 pixels differ in x 8-23, y 1-1 (rows 1-1)'
+    )
+    expect(diffFrames(expected, expected)).toBe('frames are identical')
+  })
+})
@@ -0,0 +1,139 @@
+/**
+ * @fileoverview Compact storage and diffing for golden render frames
+ *
+ * Golden frames are 1-bit framebuffers. Each is stored as a hash plus a
+ * byte-level run-length encoding: (run length 1-255, byte value) pairs.
+ * Background rows are a single repeated pattern byte, so most of a frame
+ * collapses to a handful of pairs, and the whole golden file is gzipped on
+ * top of that.
+ */
+
+import { gzipSync, gunzipSync } from 'zlib'
+import { existsSync, mkdirSync, readFileSync, writeFileSync } from 'fs'
+import { dirname } from 'path'
+import { diffBitmaps, hashBitmap, type MonochromeBitmap } from '@lib/bitmap'
+
+/**
+ * One stored frame
+ */
+export type GoldenEntry = {
+  /** hashBitmap of the framebuffer, as 8 hex digits */
+  hash: string
+
+  /** Base64 run-length encoded framebuffer */
+  rle: string
+}
+
+/**
+ * All golden frames for one galaxy, keyed by frame id
+ */
+export type GoldenFile = Record<string, GoldenEntry>
+
+/**
+ * Frame hash as stored in golden files
+ */
+export const hashFrame = (bitmap: MonochromeBitmap): string =>
+  hashBitmap(bitmap).toString(16).padStart(8, '0')
+
+/**
+ * Run-length encode bytes as (count, value) pairs
+ */
+export const encodeRle = (data: Uint8Array): Uint8Array => {
+  const out: number[] = []
+  let i = 0
+  while (i < data.length) {
+    const value = data[i]!
+    let run = 1
+    while (run < 255 && i + run < data.length && data[i + run] === value) {
+      run++
+    }
+    out.push(run, value)
+    i += run
+  }
+  return Uint8Array.from(out)
+}
+
+/**
+ * Expand (count, value) pairs back to `length` bytes
+ */
+export const decodeRle = (rle: Uint8Array, length: number): Uint8Array => {
+  const out = new Uint8Array(length)
+  let pos = 0
+  for (let i = 0; i + 1 < rle.length; i += 2) {
+    out.fill(rle[i + 1]!, pos, pos + rle[i]!)
+    pos += rle[i]!
+  }
+  if (pos !== length) {
+    throw new Error(`RLE frame decodes to ${pos} bytes, expected ${length}`)
+  }
+  return out
+}
+
+export const toGoldenEntry = (bitmap: MonochromeBitmap): GoldenEntry => ({
+  hash: hashFrame(bitmap),
+  rle: Buffer.from(encodeRle(bitmap.data)).toString('base64')
+})
+
+/**
+ * Rebuild a stored frame with the same shape as `like`
+ */
+export const fromGoldenEntry = (
+  entry: GoldenEntry,
+  like: MonochromeBitmap
+): MonochromeBitmap => ({
+  ...like,
+  data: decodeRle(Buffer.from(entry.rle, 'base64'), like.data.length)
+})
+
+/**
+ * Describe where two frames differ, e.g.
+ * "37 pixels differ in x 64-95, y 120-131 (rows 120-123, 128-131)"
+ *
+ * @param maxSpans - Stop listing row spans after this many
+ */
+export const diffFrames = (
+  expected: MonochromeBitmap,
+  actual: MonochromeBitmap,
+  maxSpans = 12
+): string => {
+  const { rows, bounds, changedPixels } = diffBitmaps(expected, actual)
+  if (!bounds) {
+    return 'frames are identical'
+  }
+
+  const spans = rows
+    .slice(0, maxSpans)
+    .map(({ start, end }) => `${start}-${end - 1}`)
+  if (rows.length > maxSpans) {
+    spans.push(`... ${rows.length - maxSpans} more`)
+  }
+
+  return (
+    `${changedPixels} pixels differ in ` +
+    `x ${bounds.x}-${bounds.x + bounds.width - 1}, ` +
+    `y ${bounds.y}-${bounds.y + bounds.height - 1} ` +
+    `(rows ${spans.join(', ')})`
+  )
+}
+
+/**
+ * Read a gzipped golden file, or null if it does not exist yet
+ */
+export const readGoldenFile = (path: string): GoldenFile | null => {
+  if (!existsSync(path)) {
+    return null
+  }
+  return JSON.parse(gunzipSync(readFileSync(path)).toString('utf8'))
+}
+
+/**
+ * Write a golden file with keys in a stable order
+ */
+export const writeGoldenFile = (path: string, golden: GoldenFile): void => {
+  const sorted: GoldenFile = {}
+  for (const key of Object.keys(golden).sort()) {
+    sorted[key] = golden[key]!
+  }
+  mkdirSync(dirname(path), { recursive: true })
+  writeFileSync(path, gzipSync(JSON.stringify(sorted, null, 1)))
+}
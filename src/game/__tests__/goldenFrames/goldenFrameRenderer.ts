@@ -0,0 +1,303 @@
+/**
+ * @fileoverview Deterministic headless frames for golden render tests
+ *
+ * Loads a planet into a fresh headless store with a fixed seed, moves the
+ * screen to a chosen scroll position and draws one frame through either
+ * game renderer. Nothing is simulated, so a frame depends only on the
+ * planet data, the sprites and the rendering code.
+ *
+ * Golden sequences instead fly a corpus pilot through the headless engine
+ * and draw every frame several ways, so renderers that keep state between
+ * frames can be checked against one that draws each frame from scratch.
+ */
+
+import { readFileSync } from 'fs'
+import { join } from 'path'
+import { createGameBitmap, type MonochromeBitmap } from '@lib/bitmap'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import type { GalaxyService } from '@core/galaxy'
+import { createSpriteServiceFromResources } from '@core/sprites'
+import type { SpriteService } from '@core/sprites'
+import {
+  createRandomService,
+  createRandomStream,
+  RandomStream,
+  setAlignmentMode,
+  streamSeed
+} from '@/core/shared'
+import { createRecordingService } from '@core/recording'
+import { createCollisionService } from '@core/collision'
+import { createHeadlessGameEngine, createHeadlessStore } from '@core/validation'
+import { CORPUS_PILOTS, type CorpusPilotName } from '@core/validation/corpus'
+import { loadLevel } from '@core/game'
+import { screenSlice, SCRWTH, VIEWHT } from '@core/screen'
+import { createFizzTransitionService } from '@core/transition'
+import { renderGame, type RenderContext } from '../../rendering'
+import { GALAXIES } from '../../galaxyConfig'
+import { renderGameOriginal } from '../../renderingOriginal'
+import type { RootState } from '../../store'
+import type { SimStore } from '../../simStore'
+
+const PUBLIC_DIR = join(__dirname, '../../public')
+
+/** Fixed level seed so animated bunkers and fuels start the same way */
+const GOLDEN_SEED = 1
+
+export type GoldenRendererName = 'renderGame' | 'renderGameOriginal'
+
+export const GOLDEN_RENDERERS: readonly GoldenRendererName[] = [
+  'renderGame',
+  'renderGameOriginal'
+]
+
+/**
+ * Scroll positions drawn for every planet
+ *
+ * - start: where the ship spawns
+ * - origin: top-left corner of the world
+ * - seam: straddling the wrap seam on wrapping planets, otherwise the
+ *   bottom-right corner
+ */
+export type GoldenScroll = 'start' | 'origin' | 'seam'
+
+export const GOLDEN_SCROLLS: readonly GoldenScroll[] = [
+  'start',
+  'origin',
+  'seam'
+]
+
+export type GoldenFrameRenderer = {
+  /** Number of planets in the galaxy */
+  planets: number
+
+  /** Draw one frame */
+  render(
+    planet: number,
+    scroll: GoldenScroll,
+    renderer: GoldenRendererName
+  ): MonochromeBitmap
+}
+
+let sharedSpriteService: SpriteService | null = null
+
+const readArrayBuffer = (path: string): ArrayBuffer => {
+  const buffer = readFileSync(path)
+  return buffer.buffer.slice(
+    buffer.byteOffset,
+    buffer.byteOffset + buffer.byteLength
+  )
+}
+
+const getSpriteService = (): SpriteService => {
+  if (!sharedSpriteService) {
+    sharedSpriteService = createSpriteServiceFromResources({
+      spriteResource: readArrayBuffer(join(PUBLIC_DIR, 'rsrc_260.bin')),
+      statusBarResource: readArrayBuffer(join(PUBLIC_DIR, 'rsrc_259.bin'))
+    })
+  }
+  return sharedSpriteService
+}
+
+const scrollPosition = (
+  state: RootState,
+  scroll: GoldenScroll
+): { x: number; y: number } => {
+  const { worldwidth, worldheight, worldwrap } = state.planet
+  switch (scroll) {
+    case 'start':
+      return { x: state.screen.screenx, y: state.screen.screeny }
+    case 'origin':
+      return { x: 0, y: 0 }
+    case 'seam':
+      return worldwrap
+        ? { x: worldwidth - SCRWTH / 2, y: state.screen.screeny }
+        : {
+            x: Math.max(0, worldwidth - SCRWTH),
+            y: Math.max(0, worldheight - VIEWHT)
+          }
+  }
+}
+
+/**
+ * Create a renderer for one galaxy
+ *
+ * @param galaxyPath - Web path from galaxyConfig, e.g. '/galaxies/x.bin'
+ */
+export const createGoldenFrameRenderer = (
+  galaxyPath: string
+): GoldenFrameRenderer => {
+  const galaxyService: GalaxyService = createGalaxyServiceNode(
+    join(PUBLIC_DIR, galaxyPath)
+  )
+  const spriteService = getSpriteService()
+
+  // Background alignment is global state - pin it
+  setAlignmentMode('world-fixed')
+
+  const render = (
+    planet: number,
+    scroll: GoldenScroll,
+    renderer: GoldenRendererName
+  ): MonochromeBitmap => {
+    // A fresh store per frame: the original renderer may dispatch a ship
+    // death, which must not leak into the next frame
+    const randomService = createRandomService()
+    const collisionService = createCollisionService()
+    collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+    const store = createHeadlessStore(
+      {
+        galaxyService,
+        randomService,
+        recordingService: createRecordingService(),
+        collisionService,
+        spriteService
+      },
+      planet
+    )
+
+    store.dispatch(loadLevel(planet, GOLDEN_SEED))
+    store.dispatch(
+      screenSlice.actions.setPosition(
+        scrollPosition(store.getState() as RootState, scroll)
+      )
+    )
+
+    // Renderers only read the game slices the headless store provides
+    const state = store.getState() as RootState
+    const fizzTransitionService = createFizzTransitionService()
+    const renderRandom = createRandomStream(
+      streamSeed(RandomStream.RENDER, GOLDEN_SEED, 0)
+    )
+
+    return renderer === 'renderGame'
+      ? renderGame({
+          bitmap: createGameBitmap(),
+          state,
+          spriteService,
+          fizzTransitionService,
+          renderRandom
+        })
+      : renderGameOriginal({
+          bitmap: createGameBitmap(),
+          state,
+          spriteService,
+          store: store as unknown as SimStore,
+          fizzTransitionService,
+          randomService,
+          renderRandom
+        })
+  }
+
+  return {
+    planets: galaxyService.getHeader().planets,
+    render
+  }
+}
+
+/**
+ * A stretch of play drawn frame by frame
+ */
+export type GoldenSequence = {
+  name: string
+  galaxyId: string
+  planet: number
+  pilot: CorpusPilotName
+  frames: number
+}
+
+export const GOLDEN_SEQUENCES: readonly GoldenSequence[] = [
+  {
+    // Scrolls by a few pixels a frame in both directions, skips to the
+    // next planet at frame 300 and fizzes into it
+    name: 'tour-release-1',
+    galaxyId: 'release',
+    planet: 1,
+    pilot: 'tour',
+    frames: 360
+  },
+  {
+    // Crosses the wrap seam again and again
+    name: 'wrap-zephyrs_short-11',
+    galaxyId: 'zephyrs_short',
+    planet: 11,
+    pilot: 'wrap',
+    frames: 300
+  }
+]
+
+/** State renderGame may keep between the frames of one variant */
+export type GoldenVariant = Pick<RenderContext, 'terrainCache' | 'frameLayers'>
+
+/**
+ * Play a sequence, drawing each frame through renderGame once per variant
+ *
+ * Every variant draws into a fresh bitmap with the same render stream,
+ * so any difference between them comes from the state they keep.
+ *
+ * @param variants - Named variants; create their caches once, up front
+ * @param onFrame - Receives the frame number and one bitmap per variant
+ */
+export const playGoldenSequence = <Name extends string>(
+  sequence: GoldenSequence,
+  variants: Record<Name, GoldenVariant>,
+  onFrame: (frame: number, frames: Record<Name, MonochromeBitmap>) => void
+): void => {
+  const galaxy = GALAXIES.find(entry => entry.id === sequence.galaxyId)
+  if (!galaxy) {
+    throw new Error(`Unknown galaxy ${sequence.galaxyId}`)
+  }
+  const galaxyService = createGalaxyServiceNode(join(PUBLIC_DIR, galaxy.path))
+  const spriteService = getSpriteService()
+  setAlignmentMode('world-fixed')
+
+  const randomService = createRandomService()
+  const collisionService = createCollisionService()
+  collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+  const store = createHeadlessStore(
+    {
+      galaxyService,
+      randomService,
+      recordingService: createRecordingService(),
+      collisionService,
+      spriteService,
+      // Levels the engine loads get the same seed as the first
+      levelSeedSource: () => GOLDEN_SEED
+    },
+    sequence.planet
+  )
+
+  // Each variant has its own fizz, reset when the engine ends a
+  // transition as the game loop resets the real one
+  const names = Object.keys(variants) as Name[]
+  const fizz = new Map(names.map(name => [name, createFizzTransitionService()]))
+  const engine = createHeadlessGameEngine(
+    store,
+    galaxyService,
+    randomService,
+    sequence.galaxyId,
+    () => fizz.forEach(service => service.reset())
+  )
+  const pilot = CORPUS_PILOTS[sequence.pilot]
+
+  store.dispatch(loadLevel(sequence.planet, GOLDEN_SEED))
+
+  for (let frame = 0; frame < sequence.frames; frame++) {
+    engine.step(frame, pilot(frame, store.getState()))
+
+    const state = store.getState() as RootState
+    const frames = {} as Record<Name, MonochromeBitmap>
+    for (const name of names) {
+      frames[name] = renderGame({
+        ...variants[name],
+        bitmap: createGameBitmap(),
+        state,
+        spriteService,
+        fizzTransitionService: fizz.get(name)!,
+        renderRandom: createRandomStream(
+          streamSeed(RandomStream.RENDER, GOLDEN_SEED, frame)
+        )
+      })
+    }
+    onFrame(frame, frames)
+  }
+}
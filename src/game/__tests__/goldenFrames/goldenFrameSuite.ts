@@ -0,0 +1,107 @@
+/**
+ * @fileoverview Golden-frame render regression suite
+ *
+ * Draws every planet of every shipped galaxy at each golden scroll
+ * position through both renderers and compares the framebuffers to the
+ * stored golden files in __golden__/. The galaxies are split across a few
+ * shard test files so vitest can render them in parallel workers.
+ *
+ * A missing golden file fails the galaxy. To add one, or to accept an
+ * intended rendering change, re-run with UPDATE_GOLDEN=1 and commit the
+ * new files.
+ */
+
+import { describe, it, expect } from 'vitest'
+import { join } from 'path'
+import { GALAXIES } from '../../galaxyConfig'
+import {
+  createGoldenFrameRenderer,
+  GOLDEN_RENDERERS,
+  GOLDEN_SCROLLS
+} from './goldenFrameRenderer'
+import {
+  diffFrames,
+  fromGoldenEntry,
+  readGoldenFile,
+  toGoldenEntry,
+  writeGoldenFile,
+  type GoldenFile
+} from './goldenCodec'
+
+export const GOLDEN_SHARD_COUNT = 4
+
+const GOLDEN_DIR = join(__dirname, '__golden__')
+
+// Rendering a whole galaxy takes a while on slow CI machines
+const GALAXY_TIMEOUT_MS = 120_000
+
+/**
+ * Frame id used as the golden file key, e.g. "p03/seam/renderGame"
+ */
+const frameKey = (planet: number, scroll: string, renderer: string): string =>
+  `p${String(planet).padStart(2, '0')}/${scroll}/${renderer}`
+
+/**
+ * Register the galaxies that belong to one shard
+ */
+export const defineGoldenFrameSuite = (shard: number): void => {
+  const galaxies = GALAXIES.filter((_, i) => i % GOLDEN_SHARD_COUNT === shard)
+  const update = process.env['UPDATE_GOLDEN'] === '1'
+
+  for (const galaxy of galaxies) {
+    describe(`golden frames: ${galaxy.name}`, () => {
+      it(
+        'matches every planet, scroll position and renderer',
+        () => {
+          const goldenPath = join(GOLDEN_DIR, `${galaxy.id}.golden.gz`)
+          const golden = update ? null : readGoldenFile(goldenPath)
+          if (!update && !golden) {
+            throw new Error(
+              `No golden frames for ${galaxy.id}; ` +
+                'run with UPDATE_GOLDEN=1 to write them'
+            )
+          }
+          const frames = createGoldenFrameRenderer(galaxy.path)
+
+          const actual: GoldenFile = {}
+          const failures: string[] = []
+
+          for (let planet = 1; planet <= frames.planets; planet++) {
+            for (const scroll of GOLDEN_SCROLLS) {
+              for (const renderer of GOLDEN_RENDERERS) {
+                const key = frameKey(planet, scroll, renderer)
+                const bitmap = frames.render(planet, scroll, renderer)
+                const entry = toGoldenEntry(bitmap)
+                actual[key] = entry
+
+                if (!golden) continue
+
+                const expected = golden[key]
+                if (!expected) {
+                  failures.push(`${key}: no golden frame`)
+                } else if (expected.hash !== entry.hash) {
+                  const expectedFrame = fromGoldenEntry(expected, bitmap)
+                  failures.push(`${key}: ${diffFrames(expectedFrame, bitmap)}`)
+                }
+              }
+            }
+          }
+
+          if (!golden) {
+            writeGoldenFile(goldenPath, actual)
+            console.warn(`Wrote golden frames for ${galaxy.id}`)
+            return
+          }
+
+          const stale = Object.keys(golden).filter(key => !(key in actual))
+          for (const key of stale) {
+            failures.push(`${key}: golden frame no longer rendered`)
+          }
+
+          expect(failures, failures.join('\n')).toEqual([])
+        },
+        GALAXY_TIMEOUT_MS
+      )
+    })
+  }
+}
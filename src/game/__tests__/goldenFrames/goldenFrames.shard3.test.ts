@@ -0,0 +1,3 @@
+import { defineGoldenFrameSuite } from './goldenFrameSuite'
+
+defineGoldenFrameSuite(3)
@@ -0,0 +1,41 @@
+import { describe, it, expect } from 'vitest'
+import { createTerrainCache } from '@render/walls'
+import { createFrameLayers } from '../../frameLayers'
+import { diffFrames } from './goldenCodec'
+import { GOLDEN_SEQUENCES, playGoldenSequence } from './goldenFrameRenderer'
+
+// A few hundred frames drawn several ways
+const SEQUENCE_TIMEOUT_MS = 120_000
+
+describe('golden sequences', () => {
+  for (const sequence of GOLDEN_SEQUENCES) {
+    it(
+      `${sequence.name}: kept layers match direct draws`,
+      () => {
+        const failures: string[] = []
+        playGoldenSequence(
+          sequence,
+          {
+            direct: {},
+            frameLayers: { frameLayers: createFrameLayers() },
+            cached: {
+              terrainCache: createTerrainCache(),
+              frameLayers: createFrameLayers()
+            }
+          },
+          (frame, { direct, ...kept }) => {
+            for (const [name, bitmap] of Object.entries(kept)) {
+              if (!bitmap.data.every((byte, i) => byte === direct.data[i])) {
+                failures.push(
+                  `frame ${frame} ${name}: ${diffFrames(direct, bitmap)}`
+                )
+              }
+            }
+          }
+        )
+        expect(failures, failures.join('\n')).toEqual([])
+      },
+      SEQUENCE_TIMEOUT_MS
+    )
+  }
+})
@@ -19,6 +19,8 @@ import {
   setRenderMode,
   toggleRenderMode,
   toggleSolidBackground,
+  toggleScrollTerrain,
+  toggleAutoQuality,
   type CollisionMode,
   type SoundMode,
   type ScaleMode,
@@ -40,6 +42,8 @@ export type PersistedAppSettings = {
   touchControlsOverride: boolean | null
   renderMode: RenderMode
   solidBackground: boolean
+  scrollTerrain: boolean
+  autoQuality: boolean
 }
 
 /**
@@ -66,7 +70,9 @@ export const appMiddleware: Middleware<{}, RootState> =
       setTouchControlsOverride.match(action) ||
       setRenderMode.match(action) ||
       toggleRenderMode.match(action) ||
-      toggleSolidBackground.match(action)
+      toggleSolidBackground.match(action) ||
+      toggleScrollTerrain.match(action) ||
+      toggleAutoQuality.match(action)
     ) {
       const state = store.getState()
       try {
@@ -80,7 +86,9 @@ export const appMiddleware: Middleware<{}, RootState> =
           soundOn: state.app.soundOn,
           touchControlsOverride: state.app.touchControlsOverride,
           renderMode: state.app.renderMode,
-          solidBackground: state.app.solidBackground
+          solidBackground: state.app.solidBackground,
+          scrollTerrain: state.app.scrollTerrain,
+          autoQuality: state.app.autoQuality
         }
         localStorage.setItem(
           APP_SETTINGS_STORAGE_KEY,
@@ -113,7 +121,9 @@ export const loadAppSettings = (): Partial<PersistedAppSettings> => {
         soundOn: parsed.soundOn,
         touchControlsOverride: parsed.touchControlsOverride,
         renderMode: parsed.renderMode,
-        solidBackground: parsed.solidBackground
+        solidBackground: parsed.solidBackground,
+        scrollTerrain: parsed.scrollTerrain,
+        autoQuality: parsed.autoQuality
       }
     }
   } catch (error) {
@@ -36,12 +36,17 @@ export type AppState = {
   // Rendering methodology
   renderMode: RenderMode
   solidBackground: boolean
+  scrollTerrain: boolean // Reuse terrain between frames (bitmap renderer)
 
   // Display settings
   alignmentMode: AlignmentMode
   showInGameControls: boolean
   scaleMode: ScaleMode
 
+  // Adaptive presentation quality
+  autoQuality: boolean
+  qualityLevel: number // 0 = best, set by the quality governor
+
   // Sound settings
   soundMode: SoundMode
   volume: number
@@ -69,9 +74,12 @@ const initialState: AppState = {
   collisionMode: 'modern',
   renderMode: 'modern', // Default to stable original renderer
   solidBackground: true, // Default to checkered pattern
+  scrollTerrain: false, // Opt in: presentation only, never for collisions
   alignmentMode: 'screen-fixed', // Default to screen-fixed (not original)
   showInGameControls: true,
   scaleMode: 'auto', // Default to responsive auto-scaling
+  autoQuality: true, // Let slow devices shed presentation work by default
+  qualityLevel: 0,
   soundMode: 'modern',
   volume: 50,
   soundOn: true,
@@ -117,6 +125,9 @@ export const appSlice = createSlice({
     toggleSolidBackground: state => {
       state.solidBackground = !state.solidBackground
     },
+    toggleScrollTerrain: state => {
+      state.scrollTerrain = !state.scrollTerrain
+    },
 
     // Sound settings
     setSoundMode: (state, action: PayloadAction<SoundMode>) => {
@@ -144,6 +155,18 @@ export const appSlice = createSlice({
       state.scaleMode = action.payload
     },
 
+    // Quality settings
+    toggleAutoQuality: state => {
+      state.autoQuality = !state.autoQuality
+      // User override - manual settings apply exactly as chosen
+      if (!state.autoQuality) {
+        state.qualityLevel = 0
+      }
+    },
+    setQualityLevel: (state, action: PayloadAction<number>) => {
+      state.qualityLevel = action.payload
+    },
+
     // Volume settings
     setVolume: (state, action: PayloadAction<number>) => {
       state.volume = action.payload
@@ -222,12 +245,15 @@ export const {
   setRenderMode,
   toggleRenderMode,
   toggleSolidBackground,
+  toggleScrollTerrain,
   setSoundMode,
   toggleSoundMode,
   setAlignmentMode,
   toggleAlignmentMode,
   toggleInGameControls,
   setScaleMode,
+  toggleAutoQuality,
+  setQualityLevel,
   setVolume,
   enableSound,
   disableSound,
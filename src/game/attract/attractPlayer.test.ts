@@ -0,0 +1,86 @@
+import { describe, it, expect } from 'vitest'
+import { readFileSync } from 'fs'
+import { join } from 'path'
+import { createGalaxyServiceNode } from '@/core/galaxy/createGalaxyServiceNode'
+import { createSpriteServiceFromResources } from '@core/sprites'
+import { decodeRecordingAuto } from '@core/recording/binaryCodec'
+import type { GameRecording } from '@core/recording'
+import type { MonochromeBitmap } from '@lib/bitmap'
+import { decompress } from '../../../scripts/gzip.node'
+import { createAttractPlayer, type AttractPlayer } from './attractPlayer'
+
+const CORPUS_DIR = join(__dirname, '../../../corpus')
+const PUBLIC_DIR = join(__dirname, '../public')
+
+const readArrayBuffer = (path: string): ArrayBuffer => {
+  const buffer = readFileSync(path)
+  return buffer.buffer.slice(
+    buffer.byteOffset,
+    buffer.byteOffset + buffer.byteLength
+  )
+}
+
+const galaxyService = createGalaxyServiceNode(
+  join(PUBLIC_DIR, 'release_galaxy.bin')
+)
+const spriteService = createSpriteServiceFromResources({
+  spriteResource: readArrayBuffer(join(PUBLIC_DIR, 'rsrc_260.bin')),
+  statusBarResource: readArrayBuffer(join(PUBLIC_DIR, 'rsrc_259.bin'))
+})
+
+const loadDemo = (): Promise<GameRecording> =>
+  decodeRecordingAuto(
+    readArrayBuffer(join(CORPUS_DIR, 'tour-release.bin')),
+    decompress
+  )
+
+const createPlayer = (recording: GameRecording): AttractPlayer =>
+  createAttractPlayer(recording, { galaxyService, spriteService })
+
+// Step to a frame, rendering the ones listed on the way
+const playTo = (
+  player: AttractPlayer,
+  frames: number,
+  renderAt: readonly number[]
+): MonochromeBitmap[] => {
+  const rendered: MonochromeBitmap[] = []
+  for (let frame = 0; frame < frames; frame++) {
+    expect(player.step()).toBe(true)
+    if (renderAt.includes(frame)) rendered.push(player.render())
+  }
+  return rendered
+}
+
+describe('createAttractPlayer', () => {
+  it('plays a demo up to its last input and then stops', async () => {
+    const recording = await loadDemo()
+    const lastFrame = recording.inputs[recording.inputs.length - 1]!.frame
+    const player = createPlayer(recording)
+
+    playTo(player, lastFrame, [])
+    expect(player.step()).toBe(false)
+  })
+
+  it('draws the same frames every time the demo plays', async () => {
+    const recording = await loadDemo()
+    // Flying, then the fizz and the second planet after the skip at 299
+    const renderAt = [20, 150, 305, 320, 420]
+    const first = playTo(createPlayer(recording), 421, renderAt)
+    const second = playTo(createPlayer(recording), 421, renderAt)
+
+    expect(first.map(bitmap => [...bitmap.data])).toEqual(
+      second.map(bitmap => [...bitmap.data])
+    )
+    expect(first[0]!.width).toBe(512)
+    expect(first[0]!.height).toBe(342)
+    expect([...first[0]!.data]).not.toEqual([...first[4]!.data])
+  })
+
+  it('stops stepping once released', async () => {
+    const player = createPlayer(await loadDemo())
+    playTo(player, 10, [])
+    player.release()
+    expect(player.step()).toBe(false)
+    expect(() => player.render()).toThrow()
+  })
+})
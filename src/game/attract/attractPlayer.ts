@@ -0,0 +1,130 @@
+/**
+ * @fileoverview Demo playback for attract mode
+ *
+ * Replays a recording through the headless engine on a store of its own
+ * and draws frames with renderGame only when asked, so the caller can
+ * simulate every due tick and present just the last one. The player never
+ * touches the game's store, recording service or sound, and everything it
+ * allocates is reachable only from the returned object.
+ */
+
+import { createGameBitmap, type MonochromeBitmap } from '@lib/bitmap'
+import { createCollisionService } from '@core/collision'
+import type { GalaxyService } from '@core/galaxy'
+import { loadLevel } from '@core/game'
+import { createRecordingService, type GameRecording } from '@core/recording'
+import { SCRWTH, VIEWHT } from '@core/screen'
+import {
+  createRandomService,
+  createRandomStream,
+  RandomStream,
+  streamSeed
+} from '@/core/shared'
+import type { SpriteService } from '@core/sprites'
+import { createFizzTransitionService } from '@core/transition'
+import { createHeadlessGameEngine, createHeadlessStore } from '@core/validation'
+import { createFrameLayers } from '../frameLayers'
+import { renderGame } from '../rendering'
+import type { RootState } from '../store'
+
+export type AttractPlayerServices = {
+  galaxyService: GalaxyService
+  spriteService: SpriteService
+}
+
+export type AttractPlayer = {
+  /** Simulate the next recorded frame; false once the demo is over */
+  step(): boolean
+
+  /** Draw the last simulated frame */
+  render(): MonochromeBitmap
+
+  /** Stop the replay and clear the render caches; the player is done */
+  release(): void
+}
+
+/**
+ * Create a player for one demo
+ *
+ * The galaxy service must already hold the recording's galaxy. The demo
+ * ends one frame before its last input, as in ReplayRenderer, so a
+ * recording that quits never reaches its game over.
+ */
+export const createAttractPlayer = (
+  recording: GameRecording,
+  { galaxyService, spriteService }: AttractPlayerServices
+): AttractPlayer => {
+  const firstLevel = recording.levelSeeds[0]
+  if (!firstLevel) {
+    throw new Error('Demo recording has no level seeds')
+  }
+
+  const randomService = createRandomService()
+  const recordingService = createRecordingService()
+  const collisionService = createCollisionService()
+  collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+
+  const store = createHeadlessStore(
+    {
+      galaxyService,
+      randomService,
+      recordingService,
+      collisionService,
+      spriteService
+    },
+    recording.startLevel
+  )
+  const fizzTransitionService = createFizzTransitionService()
+  const engine = createHeadlessGameEngine(
+    store,
+    galaxyService,
+    randomService,
+    recording.galaxyId,
+    () => fizzTransitionService.reset()
+  )
+  const frameLayers = createFrameLayers()
+
+  recordingService.startReplay(recording)
+  // eslint-disable-next-line @typescript-eslint/no-explicit-any
+  void store.dispatch(loadLevel(firstLevel.level, firstLevel.seed) as any)
+
+  const lastFrame = recording.inputs[recording.inputs.length - 1]?.frame ?? 0
+  let frame = 0
+  let released = false
+
+  return {
+    step: (): boolean => {
+      if (released || frame >= lastFrame) return false
+      const controls = recordingService.getReplayControls(frame)
+      if (!controls) return false
+      engine.step(frame, controls)
+      frame++
+      return true
+    },
+
+    render: (): MonochromeBitmap => {
+      if (released) {
+        throw new Error('Attract player has been released')
+      }
+      // Renderers only read the game slices the headless store provides
+      const state = store.getState() as unknown as RootState
+      return renderGame({
+        bitmap: createGameBitmap(),
+        state,
+        spriteService,
+        fizzTransitionService,
+        frameLayers,
+        renderRandom: createRandomStream(
+          streamSeed(RandomStream.RENDER, randomService.getSeed(), frame - 1)
+        )
+      })
+    },
+
+    release: (): void => {
+      recordingService.stopReplay()
+      fizzTransitionService.reset()
+      frameLayers.reset()
+      released = true
+    }
+  }
+}
@@ -0,0 +1,45 @@
+/**
+ * @fileoverview Demo recordings bundled for attract mode
+ *
+ * The demos are the benchmark corpus recordings: scripted games that
+ * already replay exactly under the current engine (corpus.test.ts checks
+ * every one). Vite emits each file as an asset; only the demos for the
+ * galaxy on show are fetched, one at a time as they come up.
+ */
+
+import { getCodecClient } from '@core/codec'
+import type { GameRecording } from '@core/recording'
+import { CORPUS_ENTRIES } from '@core/validation/corpus'
+
+const DEMO_URLS = import.meta.glob<string>('../../../corpus/*.bin', {
+  query: '?url',
+  import: 'default',
+  eager: true
+})
+
+export type Demo = {
+  name: string
+  url: string
+}
+
+/**
+ * Demos recorded on a galaxy, in corpus order
+ */
+export const getDemos = (galaxyId: string): Demo[] =>
+  CORPUS_ENTRIES.filter(entry => entry.galaxyId === galaxyId).flatMap(
+    (entry): Demo[] => {
+      const url = DEMO_URLS[`../../../corpus/${entry.name}.bin`]
+      return url ? [{ name: entry.name, url }] : []
+    }
+  )
+
+/**
+ * Fetch a demo and decode it off the main thread
+ */
+export const loadDemo = async (demo: Demo): Promise<GameRecording> => {
+  const response = await fetch(demo.url)
+  if (!response.ok) {
+    throw new Error(`Failed to load demo ${demo.name}: ${response.status}`)
+  }
+  return getCodecClient().decodeRecording(await response.arrayBuffer())
+}
@@ -0,0 +1,146 @@
+import React, { useEffect, useRef, useState } from 'react'
+import { useDispatch } from 'react-redux'
+import type { ThunkDispatch } from '@reduxjs/toolkit'
+import type { AnyAction } from 'redux'
+import { blitToPixels, imageDataPixels } from '@lib/bitmap'
+import type { GameRecording } from '@core/recording'
+import type { RootState, GameServices } from '../store'
+import {
+  createAttractPlayer,
+  type AttractPlayer
+} from '../attract/attractPlayer'
+import { getDemos, loadDemo } from '../attract/demos'
+import { createFrameScheduler } from '../quality/frameScheduler'
+
+const SCREEN_WIDTH = 512
+const SCREEN_HEIGHT = 342
+
+type AttractModeProps = {
+  scale: number
+  galaxyId: string
+}
+
+// Thunk so the player runs on the game's galaxy and sprite services
+const createPlayer =
+  (recording: GameRecording) =>
+  (
+    _dispatch: ThunkDispatch<RootState, GameServices, AnyAction>,
+    _getState: () => RootState,
+    services: GameServices
+  ): AttractPlayer =>
+    createAttractPlayer(recording, services)
+
+/**
+ * Attract mode component - plays demos over the title screen
+ *
+ * Cycles through the demos recorded on the current galaxy at the fixed
+ * 20 FPS. Each browser frame runs every tick that is due and presents only
+ * the last one, so a slow device drops frames rather than slowing the demo
+ * down. The demos play silently. A demo that fails to load is skipped, and
+ * a full cycle of failures stops the show. The canvas only covers the
+ * title page while a demo frame is on it. Unmounting stops the loop and
+ * releases the player, so nothing outlives the title screen.
+ */
+const AttractMode: React.FC<AttractModeProps> = ({ scale, galaxyId }) => {
+  const dispatch =
+    useDispatch<ThunkDispatch<RootState, GameServices, AnyAction>>()
+  const canvasRef = useRef<HTMLCanvasElement>(null)
+  const [showing, setShowing] = useState(false)
+  const hasDemos = getDemos(galaxyId).length > 0
+
+  useEffect(() => {
+    const ctx = canvasRef.current?.getContext('2d')
+    const demos = getDemos(galaxyId)
+    if (!ctx || demos.length === 0) return
+
+    // One frame buffer for the whole session
+    const imageData = ctx.createImageData(SCREEN_WIDTH, SCREEN_HEIGHT)
+    const pixels = imageDataPixels(imageData)
+
+    let player: AttractPlayer | null = null
+    let animation = 0
+    let nextDemo = 0
+    let failures = 0
+    let cancelled = false
+
+    const playNext = async (): Promise<void> => {
+      const demo = demos[nextDemo++ % demos.length]!
+      let recording: GameRecording
+      try {
+        recording = await loadDemo(demo)
+      } catch (error) {
+        console.error('Failed to load demo:', error)
+        if (cancelled) return
+        // Every demo has failed in a row; give the title page back
+        if (++failures >= demos.length) {
+          setShowing(false)
+          return
+        }
+        void playNext()
+        return
+      }
+      if (cancelled) return
+      failures = 0
+
+      const current = dispatch(createPlayer(recording))
+      const scheduler = createFrameScheduler({}, performance.now())
+      player = current
+
+      const loop = (now: number): void => {
+        const { ticks } = scheduler.advance(now)
+
+        let playing = true
+        for (let tick = 0; tick < ticks && playing; tick++) {
+          playing = current.step()
+        }
+
+        if (!playing) {
+          current.release()
+          player = null
+          void playNext()
+          return
+        }
+
+        if (ticks > 0) {
+          blitToPixels(current.render(), pixels)
+          ctx.putImageData(imageData, 0, 0)
+          setShowing(true)
+        }
+        animation = requestAnimationFrame(loop)
+      }
+      animation = requestAnimationFrame(loop)
+    }
+
+    void playNext()
+
+    return (): void => {
+      cancelled = true
+      cancelAnimationFrame(animation)
+      player?.release()
+      player = null
+      setShowing(false)
+    }
+  }, [dispatch, galaxyId])
+
+  if (!hasDemos) return null
+
+  return (
+    <canvas
+      ref={canvasRef}
+      width={SCREEN_WIDTH}
+      height={SCREEN_HEIGHT}
+      style={{
+        position: 'absolute',
+        top: 0,
+        left: 0,
+        width: `${SCREEN_WIDTH * scale}px`,
+        height: `${SCREEN_HEIGHT * scale}px`,
+        imageRendering: 'pixelated',
+        backgroundColor: 'black',
+        visibility: showing ? 'visible' : 'hidden'
+      }}
+    />
+  )
+}
+
+export default AttractMode
@@ -1,5 +1,10 @@
 import React, { useEffect, useRef, useState } from 'react'
-import type { FrameInfo, KeyInfo, MonochromeBitmap } from '@lib/bitmap'
+import {
+  blitToPixels,
+  imageDataPixels,
+  type FrameInfo,
+  type KeyInfo
+} from '@lib/bitmap'
 import {
   useAppDispatch,
   useAppSelector,
@@ -20,13 +25,28 @@ import { getDebug } from '../debug'
 import type { SpriteService } from '@/core/sprites'
 import { useStore } from 'react-redux'
 import { TouchControlsOverlay } from '../mobile/TouchControlsOverlay'
-import type { Frame, SpriteRegistry } from '@/lib/frame/types'
+import type { SpriteRegistry } from '@/lib/frame/types'
 import { drawFrameToCanvas } from '@/lib/frame/drawFrameToCanvas'
 import { applyCollisionMapOverlay } from '../utils/collisionMapOverlay'
+import type { GameRenderLoop, NewGameRenderLoop } from '../types'
+import { setQualityLevel } from '../appSlice'
+import { frameProfiler } from '../quality/frameProfiler'
+import {
+  createFrameScheduler,
+  type FrameScheduler
+} from '../quality/frameScheduler'
+import {
+  createQualityGovernor,
+  getPresentationQuality,
+  type QualityGovernor
+} from '../quality/qualityGovernor'
+
+// Re-evaluate presentation quality once a second at 20 FPS
+const QUALITY_EVALUATION_FRAMES = 20
 
 type GameRendererProps = {
-  renderer: (frame: FrameInfo, controls: ControlMatrix) => MonochromeBitmap
-  rendererNew: (frame: FrameInfo, controls: ControlMatrix) => Frame
+  renderer: GameRenderLoop
+  rendererNew: NewGameRenderLoop
   collisionService: CollisionService
   spriteService: SpriteService
   spriteRegistry: SpriteRegistry<ImageData>
@@ -55,7 +75,9 @@ const GameRenderer: React.FC<GameRendererProps> = ({
 }) => {
   const canvasRef = useRef<HTMLCanvasElement>(null)
   const animationRef = useRef<number>(0)
-  const lastFrameTimeRef = useRef<number>(0)
+  // Survives effect re-runs so partial ticks are never lost
+  const schedulerRef = useRef<FrameScheduler | null>(null)
+  const presentedFrameCountRef = useRef<number>(0)
   const frameIntervalMs = 1000 / fps
   const keysDownRef = useRef<Set<string>>(new Set())
   const previousKeysDownRef = useRef<Set<string>>(new Set())
@@ -69,9 +91,34 @@ const GameRenderer: React.FC<GameRendererProps> = ({
     state => state.app.touchControlsEnabled
   )
   const collisionMode = useAppSelector(state => state.app.collisionMode)
+  const autoQuality = useAppSelector(state => state.app.autoQuality)
+  const qualityLevel = useAppSelector(state => state.app.qualityLevel)
   const store = useStore<RootState>()
   const dispatch = useAppDispatch()
 
+  // Adaptive quality - only presentation changes, never the simulation
+  const governorRef = useRef<QualityGovernor | null>(null)
+  if (!governorRef.current) {
+    governorRef.current = createQualityGovernor({}, qualityLevel)
+  }
+  const lastUnderrunCountRef = useRef<number>(0)
+  const quality = getPresentationQuality(autoQuality ? qualityLevel : 0)
+  // Bitmap fallback keeps the user's collision mode, so recordings are unaffected
+  const effectiveRenderMode = quality.bitmapRenderer ? 'original' : renderMode
+  const backingScale = quality.nativeResolution ? 1 : scale
+
+  // The loop reads presentation through a ref, so a governor step changes
+  // what the next frame draws without restarting the loop and its listeners
+  const presentation = {
+    autoQuality,
+    qualityLevel,
+    effectiveRenderMode,
+    backingScale,
+    collisionOverlay: quality.collisionOverlay
+  }
+  const presentationRef = useRef(presentation)
+  presentationRef.current = presentation
+
   // Track touch controls state
   const [touchControls, setTouchControls] = useState<ControlMatrix>({
     thrust: false,
@@ -87,6 +134,43 @@ const GameRenderer: React.FC<GameRendererProps> = ({
     map: false
   })
 
+  // Limit mixer channels while the game is running
+  useEffect(() => {
+    const soundService = getStoreServices().soundService
+    soundService.setChannelLimit?.(quality.soundChannels)
+  }, [quality.soundChannels])
+
+  useEffect(() => {
+    const soundService = getStoreServices().soundService
+    return (): void => {
+      soundService.setChannelLimit?.(8)
+    }
+  }, [])
+
+  // Turning auto quality off drops back to full quality (see appSlice)
+  useEffect(() => {
+    if (!autoQuality) {
+      governorRef.current!.reset()
+    }
+  }, [autoQuality])
+
+  // Start the profiler fresh whenever presentation changes, including
+  // every quality step, so samples from the old level never count
+  // against the new one
+  const presentationLevel = autoQuality ? qualityLevel : 0
+  useEffect(() => {
+    frameProfiler.reset()
+    lastUnderrunCountRef.current =
+      getStoreServices().soundService.getUnderrunCount?.() ?? 0
+  }, [presentationLevel, effectiveRenderMode, backingScale])
+
+  // Time spent paused is not owed to the simulation
+  useEffect(() => {
+    if (!paused) {
+      schedulerRef.current?.reset(performance.now())
+    }
+  }, [paused])
+
   useEffect(() => {
     const canvas = canvasRef.current
     if (!canvas) return
@@ -116,15 +200,44 @@ const GameRenderer: React.FC<GameRendererProps> = ({
     // Initialize start time
     startTimeRef.current = performance.now()
 
+    if (!schedulerRef.current) {
+      schedulerRef.current = createFrameScheduler(
+        { tickMs: frameIntervalMs },
+        performance.now()
+      )
+    }
+    const scheduler = schedulerRef.current
+
+    // A hidden tab gets no frames; start timing over when it comes back
+    // rather than running a backlog of catch-up ticks
+    const handleVisibilityChange = (): void => {
+      if (document.visibilityState === 'visible') {
+        scheduler.reset(performance.now())
+      }
+    }
+    document.addEventListener('visibilitychange', handleVisibilityChange)
+
     // Game loop
     const gameLoop = (currentTime: number): void => {
-      const deltaTime = currentTime - lastFrameTimeRef.current
+      // Run every tick that is due so game speed stays at 20 Hz of
+      // wall-clock time, but only present the last one
+      const { ticks } = scheduler.advance(currentTime)
+      let skippedFrames = 0
+      const {
+        autoQuality,
+        qualityLevel,
+        effectiveRenderMode,
+        backingScale,
+        collisionOverlay
+      } = presentationRef.current
+
+      for (let tick = 0; tick < ticks; tick++) {
+        const present = tick === ticks - 1
 
-      if (deltaTime >= frameIntervalMs) {
         // Prepare frame and key info
         const frameInfo: FrameInfo = {
           frameCount: frameCountRef.current,
-          deltaTime: deltaTime,
+          deltaTime: frameIntervalMs,
           totalTime: currentTime - startTimeRef.current,
           targetDelta: frameIntervalMs
         }
@@ -164,6 +277,10 @@ const GameRenderer: React.FC<GameRendererProps> = ({
             })
           : mergedControls
 
+        // Pause and map changes take effect when this effect re-runs, so
+        // stop catching up until then
+        const modeChanged = controls.map || (controls.pause && !showMapState)
+
         if (controls.map) {
           if (showMapState) {
             dispatch(hideMap())
@@ -198,9 +315,18 @@ const GameRenderer: React.FC<GameRendererProps> = ({
             )
           }
 
-          if (renderMode === 'original') {
+          if (!present) {
+            // Catch-up tick - advance the simulation without presenting it
+            if (effectiveRenderMode === 'original') {
+              renderer(frameInfo, controls, { skipRender: true })
+            } else {
+              rendererNew(frameInfo, controls, { skipRender: true })
+            }
+            skippedFrames++
+          } else if (effectiveRenderMode === 'original') {
             // Original bitmap renderer
             const renderedBitmap = renderer(frameInfo, controls)
+            const blitStart = performance.now()
             const collisionMap = collisionService.getMap()
 
             // Create offscreen canvas for pixel-perfect scaling
@@ -216,26 +342,10 @@ const GameRenderer: React.FC<GameRendererProps> = ({
             )
             const pixels = imageData.data
 
-            // Convert monochrome bitmap to RGBA
-            for (let y = 0; y < renderedBitmap.height; y++) {
-              for (let x = 0; x < renderedBitmap.width; x++) {
-                const byteIndex =
-                  y * renderedBitmap.rowBytes + Math.floor(x / 8)
-                const bitMask = 0x80 >> (x % 8)
-                const isSet = (renderedBitmap.data[byteIndex]! & bitMask) !== 0
-
-                const pixelIndex = (y * renderedBitmap.width + x) * 4
-                const value = isSet ? 0 : 255 // Black on white
-
-                // Set base pixel color
-                pixels[pixelIndex] = value // R
-                pixels[pixelIndex + 1] = value // G
-                pixels[pixelIndex + 2] = value // B
-                pixels[pixelIndex + 3] = 255 // A
-              }
-            }
+            // Convert monochrome bitmap to RGBA, black on white
+            blitToPixels(renderedBitmap, imageDataPixels(imageData))
 
-            if (getDebug()?.SHOW_COLLISION_MAP) {
+            if (getDebug()?.SHOW_COLLISION_MAP && collisionOverlay) {
               const ship = (store.getState() as RootState).ship
               applyCollisionMapOverlay(
                 pixels,
@@ -243,7 +353,8 @@ const GameRenderer: React.FC<GameRendererProps> = ({
                 ship,
                 spriteService,
                 renderedBitmap.width,
-                renderedBitmap.height
+                renderedBitmap.height,
+                collisionService
               )
             }
 
@@ -256,17 +367,28 @@ const GameRenderer: React.FC<GameRendererProps> = ({
               offscreen,
               0,
               0,
-              renderedBitmap.width * scale,
-              renderedBitmap.height * scale
+              renderedBitmap.width * backingScale,
+              renderedBitmap.height * backingScale
             )
+            frameProfiler.record('blit', performance.now() - blitStart)
           } else {
             // Modern frame-based renderer
             const renderedFrame = rendererNew(frameInfo, controls)
+            const blitStart = performance.now()
+
+            // Resizing the canvas for a new backing scale resets this
+            ctx.imageSmoothingEnabled = false
 
             // Draw frame to canvas (background clearing is handled by viewClear in renderingNew.ts)
-            drawFrameToCanvas(renderedFrame, ctx, scale, spriteRegistry, false)
+            drawFrameToCanvas(
+              renderedFrame,
+              ctx,
+              backingScale,
+              spriteRegistry,
+              false
+            )
 
-            if (getDebug()?.SHOW_COLLISION_MAP) {
+            if (getDebug()?.SHOW_COLLISION_MAP && collisionOverlay) {
               const collisionMap = collisionService.getMap()
               const ship = (store.getState() as RootState).ship
 
@@ -294,7 +416,8 @@ const GameRenderer: React.FC<GameRendererProps> = ({
                 ship,
                 spriteService,
                 width,
-                height
+                height,
+                collisionService
               )
 
               // Put back to temp canvas
@@ -302,16 +425,51 @@ const GameRenderer: React.FC<GameRendererProps> = ({
 
               // Scale back up to main canvas
               ctx.imageSmoothingEnabled = false
-              ctx.drawImage(tempCanvas, 0, 0, width * scale, height * scale)
+              ctx.drawImage(
+                tempCanvas,
+                0,
+                0,
+                width * backingScale,
+                height * backingScale
+              )
+            }
+            frameProfiler.record('blit', performance.now() - blitStart)
+          }
+
+          if (present) {
+            // Close the profiled frame, folding in underruns and catch-up
+            const underrunCount =
+              getStoreServices().soundService.getUnderrunCount?.() ?? 0
+            frameProfiler.recordUnderruns(
+              underrunCount - lastUnderrunCountRef.current
+            )
+            lastUnderrunCountRef.current = underrunCount
+            frameProfiler.recordSkippedFrames(skippedFrames)
+            frameProfiler.endFrame()
+
+            presentedFrameCountRef.current++
+            if (
+              autoQuality &&
+              presentedFrameCountRef.current % QUALITY_EVALUATION_FRAMES === 0
+            ) {
+              const level = governorRef.current!.evaluate(
+                frameProfiler.getStats()
+              )
+              if (level !== qualityLevel) {
+                dispatch(setQualityLevel(level))
+              }
             }
           }
 
-          lastFrameTimeRef.current = currentTime
           frameCountRef.current++
         }
 
         // Update previous keys for next frame
         previousKeysDownRef.current = new Set(keysDownRef.current)
+
+        if (modeChanged) {
+          break
+        }
       }
 
       animationRef.current = requestAnimationFrame(gameLoop)
@@ -326,14 +484,13 @@ const GameRenderer: React.FC<GameRendererProps> = ({
       }
       window.removeEventListener('keydown', handleKeyDown)
       window.removeEventListener('keyup', handleKeyUp)
+      document.removeEventListener('visibilitychange', handleVisibilityChange)
     }
   }, [
     renderer,
     rendererNew,
-    renderMode,
     width,
     height,
-    scale,
     fps,
     frameIntervalMs,
     bindings,
@@ -353,9 +510,12 @@ const GameRenderer: React.FC<GameRendererProps> = ({
       <div style={{ position: 'relative', display: 'inline-block' }}>
         <canvas
           ref={canvasRef}
-          width={width * scale}
-          height={height * scale}
+          width={width * backingScale}
+          height={height * backingScale}
           style={{
+            // CSS size stays at the display scale even at native resolution
+            width: width * scale,
+            height: height * scale,
             imageRendering: 'pixelated',
             // @ts-ignore - vendor prefixes
             WebkitImageRendering: 'pixelated',
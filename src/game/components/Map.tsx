@@ -4,11 +4,71 @@ import { useAppSelector } from '../store'
 import { LINE_KIND } from '@core/shared/types/line'
 import type { LineRec } from '@core/shared/types/line'
 import type { Fuel, Bunker } from '@core/planet/types'
+import {
+  blitToPixels,
+  createMonochromeBitmap,
+  imageDataPixels,
+  setPixel,
+  type MonochromeBitmap
+} from '@lib/bitmap'
 
 type MinimapProps = {
   scale: number
 }
 
+/**
+ * Build a 1-bit icon from a pattern, setting the pixels `isSet` picks
+ */
+const patternBitmap = (
+  pattern: number[][],
+  isSet: (value: number) => boolean
+): MonochromeBitmap => {
+  const bitmap = createMonochromeBitmap(pattern[0]!.length, pattern.length)
+  pattern.forEach((row, y) =>
+    row.forEach((value, x) => {
+      if (isSet(value)) setPixel(bitmap, x, y)
+    })
+  )
+  return bitmap
+}
+
+// Bunker dot: a 4x4 circle with no anti-aliasing
+const BUNKER_DOT = patternBitmap(
+  [
+    [0, 1, 1, 0],
+    [1, 1, 1, 1],
+    [1, 1, 1, 1],
+    [0, 1, 1, 0]
+  ],
+  value => value === 1
+)
+
+// Ship target: 0 = background, 1 = outer (12px), 2 = middle (8px),
+// 3 = inner (4px)
+const SHIP_TARGET_PATTERN = [
+  [0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0],
+  [0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0],
+  [0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0],
+  [0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0],
+  [1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1],
+  [1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1],
+  [1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1],
+  [1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1],
+  [0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0],
+  [0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0],
+  [0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0],
+  [0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0]
+]
+const SHIP_TARGET = patternBitmap(
+  SHIP_TARGET_PATTERN,
+  value => value === 1 || value === 3
+)
+// Inverted, only the middle ring is black; the background stays white
+const SHIP_TARGET_INVERTED = patternBitmap(
+  SHIP_TARGET_PATTERN,
+  value => value === 2
+)
+
 /**
  * Draw planet lines on the map canvas with appropriate scaling
  * Normal lines are solid black, bounce lines are dotted, ghost and explode lines are skipped
@@ -158,35 +218,8 @@ const drawBunkers = (
       offscreen.height = 4
       const offCtx = offscreen.getContext('2d')!
 
-      // Get image data to draw pixels directly
       const imageData = offCtx.createImageData(4, 4)
-      const data = imageData.data
-
-      // Manually draw a 4x4 circle pattern (no anti-aliasing)
-      // Pattern for a small filled circle:
-      //  .XX.
-      //  XXXX
-      //  XXXX
-      //  .XX.
-      const circlePattern = [
-        [0, 1, 1, 0],
-        [1, 1, 1, 1],
-        [1, 1, 1, 1],
-        [0, 1, 1, 0]
-      ]
-
-      // Set pixels based on pattern
-      for (let y = 0; y < 4; y++) {
-        for (let x = 0; x < 4; x++) {
-          const idx = (y * 4 + x) * 4
-          const isBlack = circlePattern[y]![x] === 1
-          const color = isBlack ? 0 : 255
-          data[idx] = color // R
-          data[idx + 1] = color // G
-          data[idx + 2] = color // B
-          data[idx + 3] = 255 // A
-        }
-      }
+      blitToPixels(BUNKER_DOT, imageDataPixels(imageData))
 
       offCtx.putImageData(imageData, 0, 0)
 
@@ -258,64 +291,12 @@ const drawShipPosition = (
     offscreen.height = 12
     const offCtx = offscreen.getContext('2d')!
 
-    // Get image data to draw pixels directly
+    // Outer and inner rings black, or only the middle one when inverted
     const imageData = offCtx.createImageData(12, 12)
-    const data = imageData.data
-
-    // Manually draw concentric circles pattern (no anti-aliasing)
-    // 0 = transparent, 1 = outer (12px), 2 = middle (8px), 3 = inner (4px)
-    const pattern = [
-      [0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0],
-      [0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0],
-      [0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0],
-      [0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0],
-      [1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1],
-      [1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1],
-      [1, 1, 2, 2, 3, 3, 3, 3, 2, 2, 1, 1],
-      [1, 1, 2, 2, 2, 3, 3, 2, 2, 2, 1, 1],
-      [0, 1, 1, 2, 2, 2, 2, 2, 2, 1, 1, 0],
-      [0, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 0],
-      [0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0],
-      [0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0]
-    ]
-
-    // Set pixels based on pattern
-    for (let y = 0; y < 12; y++) {
-      for (let x = 0; x < 12; x++) {
-        const idx = (y * 12 + x) * 4
-        const patternValue = pattern[y]![x]
-
-        let color: number
-        if (patternValue === 0) {
-          // Transparent/white background
-          data[idx] = 255
-          data[idx + 1] = 255
-          data[idx + 2] = 255
-          data[idx + 3] = 255
-        } else if (patternValue === 1) {
-          // Outer circle
-          color = outerColor === 'black' ? 0 : 255
-          data[idx] = color
-          data[idx + 1] = color
-          data[idx + 2] = color
-          data[idx + 3] = 255
-        } else if (patternValue === 2) {
-          // Middle circle
-          color = middleColor === 'black' ? 0 : 255
-          data[idx] = color
-          data[idx + 1] = color
-          data[idx + 2] = color
-          data[idx + 3] = 255
-        } else {
-          // Inner circle
-          color = innerColor === 'black' ? 0 : 255
-          data[idx] = color
-          data[idx + 1] = color
-          data[idx + 2] = color
-          data[idx + 3] = 255
-        }
-      }
-    }
+    blitToPixels(
+      inverted ? SHIP_TARGET_INVERTED : SHIP_TARGET,
+      imageDataPixels(imageData)
+    )
 
     offCtx.putImageData(imageData, 0, 0)
 
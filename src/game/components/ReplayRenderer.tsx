@@ -1,5 +1,10 @@
 import React, { useEffect, useRef } from 'react'
-import type { FrameInfo, MonochromeBitmap } from '@lib/bitmap'
+import {
+  blitToPixels,
+  imageDataPixels,
+  type FrameInfo,
+  type MonochromeBitmap
+} from '@lib/bitmap'
 import {
   useAppDispatch,
   useAppSelector,
@@ -140,24 +145,8 @@ const ReplayRenderer: React.FC<ReplayRendererProps> = ({
             )
             const pixels = imageData.data
 
-            // Convert monochrome bitmap to RGBA
-            for (let y = 0; y < renderedBitmap.height; y++) {
-              for (let x = 0; x < renderedBitmap.width; x++) {
-                const byteIndex =
-                  y * renderedBitmap.rowBytes + Math.floor(x / 8)
-                const bitMask = 0x80 >> (x % 8)
-                const isSet = (renderedBitmap.data[byteIndex]! & bitMask) !== 0
-
-                const pixelIndex = (y * renderedBitmap.width + x) * 4
-                const value = isSet ? 0 : 255 // Black on white
-
-                // Set base pixel color
-                pixels[pixelIndex] = value // R
-                pixels[pixelIndex + 1] = value // G
-                pixels[pixelIndex + 2] = value // B
-                pixels[pixelIndex + 3] = 255 // A
-              }
-            }
+            // Convert monochrome bitmap to RGBA, black on white
+            blitToPixels(renderedBitmap, imageDataPixels(imageData))
 
             if (getDebug()?.SHOW_COLLISION_MAP) {
               const ship = (store.getState() as RootState).ship
@@ -167,7 +156,8 @@ const ReplayRenderer: React.FC<ReplayRendererProps> = ({
                 ship,
                 spriteService,
                 renderedBitmap.width,
-                renderedBitmap.height
+                renderedBitmap.height,
+                collisionService
               )
             }
 
@@ -218,7 +208,8 @@ const ReplayRenderer: React.FC<ReplayRendererProps> = ({
                 ship,
                 spriteService,
                 width,
-                height
+                height,
+                collisionService
               )
 
               // Put back to temp canvas
@@ -178,10 +178,10 @@ const ReplaySelectionScreen: React.FC<ReplaySelectionScreenProps> = ({
     setValidationStates(prev => ({ ...prev, [id]: 'validating' }))
 
     // Run validation in next tick to allow UI to update
-    setTimeout(() => {
+    setTimeout(async () => {
       try {
         const services = getStoreServices()
-        const report = validateRecording(recording, services)
+        const report = await validateRecording(recording, services)
         setValidationStates(prev => ({ ...prev, [id]: report }))
 
         // Log to console
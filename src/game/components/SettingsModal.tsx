@@ -5,6 +5,8 @@ import {
   toggleSoundMode,
   toggleRenderMode,
   toggleSolidBackground,
+  toggleScrollTerrain,
+  toggleAutoQuality,
   toggleAlignmentMode,
   toggleInGameControls,
   setScaleMode,
@@ -165,6 +167,9 @@ const SettingsModal: React.FC<SettingsModalProps> = ({
   const soundMode = useAppSelector(state => state.app.soundMode)
   const renderMode = useAppSelector(state => state.app.renderMode)
   const solidBackground = useAppSelector(state => state.app.solidBackground)
+  const scrollTerrain = useAppSelector(state => state.app.scrollTerrain)
+  const autoQuality = useAppSelector(state => state.app.autoQuality)
+  const qualityLevel = useAppSelector(state => state.app.qualityLevel)
   const alignmentMode = useAppSelector(state => state.app.alignmentMode)
   const scaleMode = useAppSelector(state => state.app.scaleMode)
   const showInGameControls = useAppSelector(
@@ -678,6 +683,86 @@ const SettingsModal: React.FC<SettingsModalProps> = ({
               </div>
             )}
 
+            {/* Scroll Terrain Section - only visible in original render mode */}
+            {renderMode === 'original' && (
+              <div style={sectionStyle}>
+                <div
+                  style={{
+                    display: 'flex',
+                    alignItems: 'center',
+                    gap: `${5 * scale}px`
+                  }}
+                >
+                  <span>SCROLL TERRAIN:</span>
+                  <button
+                    onClick={() => dispatch(toggleScrollTerrain())}
+                    style={toggleButtonStyle}
+                    onMouseEnter={e => {
+                      e.currentTarget.style.background = '#333'
+                    }}
+                    onMouseLeave={e => {
+                      e.currentTarget.style.background = '#000'
+                    }}
+                  >
+                    {scrollTerrain ? 'ON' : 'OFF'}
+                  </button>
+                  <span
+                    style={{
+                      color: '#666',
+                      fontSize: `${5 * scale}px`,
+                      marginLeft: `${5 * scale}px`
+                    }}
+                  >
+                    (
+                    {scrollTerrain
+                      ? 'Reuse terrain between frames, modern collisions only'
+                      : 'Draw all terrain every frame'}
+                    )
+                  </span>
+                </div>
+              </div>
+            )}
+
+            {/* Auto Quality Section */}
+            <div style={sectionStyle}>
+              <div
+                style={{
+                  display: 'flex',
+                  alignItems: 'center',
+                  gap: `${5 * scale}px`
+                }}
+              >
+                <span>AUTO QUALITY:</span>
+                <button
+                  onClick={() => dispatch(toggleAutoQuality())}
+                  style={toggleButtonStyle}
+                  onMouseEnter={e => {
+                    e.currentTarget.style.background = '#333'
+                  }}
+                  onMouseLeave={e => {
+                    e.currentTarget.style.background = '#000'
+                  }}
+                >
+                  {autoQuality ? 'ON' : 'OFF'}
+                </button>
+                <span
+                  style={{
+                    color: '#666',
+                    fontSize: `${5 * scale}px`,
+                    marginLeft: `${5 * scale}px`
+                  }}
+                >
+                  (
+                  {!autoQuality
+                    ? 'Settings apply exactly as chosen'
+                    : qualityLevel === 0
+                      ? 'Full quality'
+                      : `Reduced to keep 20 FPS - level ${qualityLevel}`}
+                  )
+                </span>
+              </div>
+            </div>
+
             {/* Alignment Mode Section */}
             <div style={sectionStyle}>
               <div
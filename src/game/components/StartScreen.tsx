@@ -11,7 +11,16 @@ import type { MonochromeBitmap } from '@lib/bitmap/types'
 import type { SpriteService } from '@core/sprites'
 import type { ThunkDispatch } from '@reduxjs/toolkit'
 import type { AnyAction } from 'redux'
+import { presentStaticScreen } from '../staticScreens'
 import { CustomDropdown } from './CustomDropdown'
+import AttractMode from './AttractMode'
+import {
+  ANY_INPUT_ACTIVITY_EVENTS,
+  useInactivityDetection
+} from '../hooks/useInactivityDetection'
+
+// Idle time on the title screen before the demos start
+const ATTRACT_IDLE_MS = 30_000
 
 type StartScreenProps = {
   scale: number
@@ -31,10 +40,16 @@ const StartScreen: React.FC<StartScreenProps> = ({ scale, onStartGame }) => {
   const mostRecentScore = useSelector(
     (state: RootState) => state.app.mostRecentScore
   )
+  const showSettings = useSelector((state: RootState) => state.app.showSettings)
   const [selectedLevel, setSelectedLevel] = useState(1)
   const [selectedGalaxyId, setSelectedGalaxyId] = useState(currentGalaxyId)
   const canvasRef = useRef<HTMLCanvasElement>(null)
   const [titlePage, setTitlePage] = useState<MonochromeBitmap | null>(null)
+  // Any input ends the demos and restarts the idle timer
+  const isActive = useInactivityDetection(
+    ATTRACT_IDLE_MS,
+    ANY_INPUT_ACTIVITY_EVENTS
+  )
 
   // Load title page from sprite service
   useEffect(() => {
@@ -66,7 +81,7 @@ const StartScreen: React.FC<StartScreenProps> = ({ scale, onStartGame }) => {
   const TITLE_PAGE_CONTENT_WIDTH = 501
   const TITLE_PAGE_CONTENT_HEIGHT = 311
 
-  // Render title page to canvas
+  // Present the title page, converted once per scale and then cached
   useEffect(() => {
     if (!titlePage || !canvasRef.current) return
 
@@ -79,54 +94,15 @@ const StartScreen: React.FC<StartScreenProps> = ({ scale, onStartGame }) => {
     canvas.width = TITLE_PAGE_CONTENT_WIDTH * scale
     canvas.height = TITLE_PAGE_CONTENT_HEIGHT * scale
 
-    // Create ImageData at original cropped size
-    const imageData = ctx.createImageData(
-      TITLE_PAGE_CONTENT_WIDTH,
-      TITLE_PAGE_CONTENT_HEIGHT
-    )
-    const data = imageData.data
-
-    // Convert monochrome bitmap to RGBA (only the content area)
-    for (let y = 0; y < TITLE_PAGE_CONTENT_HEIGHT; y++) {
-      for (let x = 0; x < TITLE_PAGE_CONTENT_WIDTH; x++) {
-        const byteIndex = y * 64 + Math.floor(x / 8)
-        const bitIndex = 7 - (x % 8)
-        const byte = titlePage.data[byteIndex]
-        const bit = byte !== undefined ? (byte >> bitIndex) & 1 : 0
-
-        const pixelIndex = (y * TITLE_PAGE_CONTENT_WIDTH + x) * 4
-        const color = bit ? 0 : 255 // Black for 1, white for 0
-        data[pixelIndex] = color // R
-        data[pixelIndex + 1] = color // G
-        data[pixelIndex + 2] = color // B
-        data[pixelIndex + 3] = 255 // A
-      }
-    }
-
-    // Enable image smoothing off for crisp pixels
-    ctx.imageSmoothingEnabled = false
-
-    // First put the image data on a temporary canvas at original size
-    const tempCanvas = document.createElement('canvas')
-    tempCanvas.width = TITLE_PAGE_CONTENT_WIDTH
-    tempCanvas.height = TITLE_PAGE_CONTENT_HEIGHT
-    const tempCtx = tempCanvas.getContext('2d')
-    if (!tempCtx) return
-
-    tempCtx.putImageData(imageData, 0, 0)
-
-    // Now draw it scaled to the main canvas
-    ctx.imageSmoothingEnabled = false
-    ctx.drawImage(
-      tempCanvas,
-      0,
-      0,
-      TITLE_PAGE_CONTENT_WIDTH,
-      TITLE_PAGE_CONTENT_HEIGHT,
-      0,
-      0,
-      TITLE_PAGE_CONTENT_WIDTH * scale,
-      TITLE_PAGE_CONTENT_HEIGHT * scale
+    return presentStaticScreen(
+      ctx,
+      'title',
+      {
+        bitmap: titlePage,
+        width: TITLE_PAGE_CONTENT_WIDTH,
+        height: TITLE_PAGE_CONTENT_HEIGHT
+      },
+      scale
     )
   }, [titlePage, scale])
 
@@ -485,6 +461,11 @@ const StartScreen: React.FC<StartScreenProps> = ({ scale, onStartGame }) => {
           <rect x="7" y="7" width="3" height="3" fill="black" />
         </svg>
       </button>
+
+      {/* Demos after a while with no input; unmounting ends them */}
+      {!isActive && !showSettings && (
+        <AttractMode scale={scale} galaxyId={currentGalaxyId} />
+      )}
     </div>
   )
 }
@@ -1,9 +1,5 @@
 import type { GameRecording } from '@core/recording'
-import {
-  encodeRecordingGzip,
-  decodeRecordingAuto
-} from '@core/recording/binaryCodec'
-import { compress, decompress } from '@core/recording/gzip.browser'
+import { getCodecClient } from '@core/codec'
 
 /**
  * Export a recording to a downloadable JSON file
@@ -32,7 +28,7 @@ export const exportRecordingBinary = async (
   recording: GameRecording,
   filename: string
 ): Promise<void> => {
-  const binaryData = await encodeRecordingGzip(recording, compress)
+  const binaryData = await getCodecClient().encodeRecording(recording)
   const blob = new Blob([binaryData], { type: 'application/octet-stream' })
   const url = URL.createObjectURL(blob)
   const a = document.createElement('a')
@@ -45,8 +41,8 @@ export const exportRecordingBinary = async (
 /**
  * Import a recording from a file
  * Automatically detects format (gzipped binary, binary, or JSON) and decodes appropriately
+ * Decoding runs in the codec worker where available
  */
 export const importRecording = async (file: File): Promise<GameRecording> => {
-  const arrayBuffer = await file.arrayBuffer()
-  return await decodeRecordingAuto(arrayBuffer, decompress)
+  return await getCodecClient().decodeRecording(await file.arrayBuffer())
 }
@@ -0,0 +1,82 @@
+import { describe, it, expect } from 'vitest'
+import {
+  createGameBitmap,
+  setPixel,
+  type MonochromeBitmap
+} from '@lib/bitmap'
+import { createFrameLayers } from './frameLayers'
+
+// A bit-independent pass: clear one byte, set one bit, invert another
+const makePass = (
+  offset: number
+): {
+  pass: (screen: MonochromeBitmap) => MonochromeBitmap
+  calls: () => number
+} => {
+  let calls = 0
+  return {
+    pass: screen => {
+      calls++
+      const out = { ...screen, data: new Uint8Array(screen.data) }
+      out.data[offset] = 0
+      setPixel(out, 100 + offset, 50)
+      out.data[offset + 200]! ^= 0x0f
+      return out
+    },
+    calls: () => calls
+  }
+}
+
+const noise = (seed: number): MonochromeBitmap => {
+  const screen = createGameBitmap()
+  for (let i = 0; i < screen.data.length; i++) {
+    screen.data[i] = (i * 31 + seed * 17) & 0xff
+  }
+  return screen
+}
+
+describe('createFrameLayers', () => {
+  it('draws, then captures, then reuses a layer with unchanged inputs', () => {
+    const layers = createFrameLayers()
+    const { pass, calls } = makePass(10)
+
+    for (let frame = 0; frame < 4; frame++) {
+      layers.beginFrame()
+      const screen = noise(frame)
+      const out = layers.layer('test', [1, 'a'], pass)(screen)
+      expect(out.data).toEqual(makePass(10).pass(screen).data)
+      expect(layers.redrawn()).toEqual(frame < 2 ? ['test'] : [])
+    }
+
+    // Once directly, twice to capture, never again
+    expect(calls()).toBe(3)
+  })
+
+  it('draws again when any input changes', () => {
+    const layers = createFrameLayers()
+    const first = makePass(10)
+    const second = makePass(20)
+    const inputs = { walls: {} }
+
+    layers.layer('test', [inputs.walls], first.pass)(noise(0))
+    layers.layer('test', [inputs.walls], first.pass)(noise(1))
+
+    layers.beginFrame()
+    const screen = noise(2)
+    const out = layers.layer('test', [{}], second.pass)(screen)
+    expect(out.data).toEqual(makePass(20).pass(screen).data)
+    expect(layers.redrawn()).toEqual(['test'])
+  })
+
+  it('forgets everything on reset', () => {
+    const layers = createFrameLayers()
+    const { pass, calls } = makePass(10)
+
+    layers.layer('test', [1], pass)(noise(0))
+    layers.layer('test', [1], pass)(noise(1))
+    layers.reset()
+    layers.layer('test', [1], pass)(noise(2))
+
+    expect(calls()).toBe(4)
+  })
+})
@@ -0,0 +1,87 @@
+/**
+ * @fileoverview Persistent frame layers for the bitmap renderer
+ *
+ * renderGame draws every pass destructively into one screen, so nothing
+ * carries over between frames. Given a FrameLayers cache it keeps the
+ * passes that don't depend on the view (the status bar) as captured
+ * layers instead, each tagged with the inputs it was drawn from. A layer
+ * whose inputs are unchanged is applied word-wise without drawing
+ * anything. Passes drawn relative to screenx and screeny would change on
+ * every scrolling frame, so they are drawn directly; terrain is scrolled
+ * on by the terrain cache instead (see scrollTerrain).
+ *
+ * Capturing a layer costs two draws, so a pass is drawn directly the
+ * first frame its inputs change and only captured once they have held
+ * still for a frame.
+ */
+
+import {
+  applyLayer,
+  captureLayer,
+  type BitmapLayer,
+  type MonochromeBitmap
+} from '@lib/bitmap'
+
+type Pass = (screen: MonochromeBitmap) => MonochromeBitmap
+
+export type FrameLayers = {
+  /** Start a new frame */
+  beginFrame: () => void
+
+  /**
+   * The pass, or its captured effect when `inputs` match the previous
+   * frame's, element by element
+   *
+   * @param name - Identifies the layer between frames
+   * @param inputs - Everything the pass reads besides the screen
+   * @param pass - Must change each bit independently (see captureLayer)
+   */
+  layer: (name: string, inputs: readonly unknown[], pass: Pass) => Pass
+
+  /** Names of the layers drawn or captured so far this frame */
+  redrawn: () => readonly string[]
+
+  /** Forget every layer */
+  reset: () => void
+}
+
+type Entry = {
+  inputs: readonly unknown[]
+  layer: BitmapLayer | null
+}
+
+const sameInputs = (a: readonly unknown[], b: readonly unknown[]): boolean =>
+  a.length === b.length && a.every((value, i) => Object.is(value, b[i]))
+
+export const createFrameLayers = (): FrameLayers => {
+  const entries = new Map<string, Entry>()
+  let redrawn: string[] = []
+
+  return {
+    beginFrame: () => {
+      redrawn = []
+    },
+
+    layer: (name, inputs, pass) => screen => {
+      const entry = entries.get(name)
+      if (!entry || !sameInputs(entry.inputs, inputs)) {
+        entries.set(name, { inputs, layer: null })
+        redrawn.push(name)
+        return pass(screen)
+      }
+
+      if (!entry.layer) {
+        entry.layer = captureLayer(pass, screen)
+        redrawn.push(name)
+      }
+      return applyLayer(entry.layer)(screen)
+    },
+
+    redrawn: () => redrawn,
+
+    reset: () => {
+      entries.clear()
+      redrawn = []
+    }
+  }
+}
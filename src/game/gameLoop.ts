@@ -12,8 +12,14 @@ import type {
   FizzTransitionService,
   FizzTransitionServiceFrame
 } from '@core/transition'
-import type { GameStore } from './store'
-import type { RandomService } from '@/core/shared'
+import type { GameStore, RootState } from './store'
+import type { GameSync, SimStore } from './simStore'
+import {
+  createRandomService,
+  RandomStream,
+  streamSeed,
+  type RandomService
+} from '@/core/shared'
 import { TOTAL_INITIAL_LIVES } from '@/core/ship'
 
 import { updateGameState, type GameRootState } from '@core/game'
@@ -25,9 +31,30 @@ import { renderGameNew } from './renderingNew'
 import { setMode, setMostRecentScore, setLastRecordingId } from './appSlice'
 import { getStoreServices } from './store'
 import { createRecordingStorage } from '@core/recording'
+import { frameProfiler } from './quality/frameProfiler'
+import { createTerrainCache } from '@render/walls'
+import { createFrameLayers } from './frameLayers'
+
+/**
+ * Whether a tick can be simulated without drawing it
+ *
+ * Original collision mode detects collisions while drawing, and the fizz
+ * transition advances one step per drawn frame while the simulation waits
+ * on it, so both must always render to keep game timing at 20 Hz.
+ */
+const canSkipRender = (
+  state: RootState,
+  fizzInitialized: boolean
+): boolean =>
+  state.app.collisionMode === 'modern' &&
+  state.transition.status !== 'fizz' &&
+  state.transition.status !== 'starmap' &&
+  !fizzInitialized
 
 export const createGameRenderer = (
   store: GameStore,
+  simStore: SimStore,
+  gameSync: GameSync,
   spriteService: SpriteService,
   galaxyService: GalaxyService,
   fizzTransitionService: FizzTransitionService,
@@ -40,6 +67,16 @@ export const createGameRenderer = (
     reset: (): void => fizzTransitionService.reset()
   }
 
+  // Terrain kept between frames when the scrollTerrain setting is on
+  const terrainCache = createTerrainCache()
+
+  // Slow-changing passes kept between frames; output is unchanged
+  const frameLayers = createFrameLayers()
+
+  // Cosmetic randomness, reseeded every frame so the simulation's
+  // sequence is never touched by drawing
+  const renderRandom = createRandomService()
+
   // Create state update callbacks
   const stateUpdateCallbacks = {
     onGameOver: async (finalState: GameRootState): Promise<void> => {
@@ -103,46 +140,73 @@ export const createGameRenderer = (
       store.getState().app.collisionMode
   }
 
-  return (frame, controls) => {
+  return (frame, controls, options) => {
     // Create a fresh bitmap for this frame
     let bitmap = createGameBitmap()
 
     // This handles all game logic, physics, and state changes
-    updateGameState({
-      store,
-      frame,
-      controls,
-      galaxyService,
-      transitionCallbacks,
-      randomService,
-      stateUpdateCallbacks
+    // The simulation runs on its own store; the app store mirrors it
+    frameProfiler.measure('simulation', () => {
+      gameSync.pull()
+      getStoreServices().soundService.seedFrame(
+        randomService.getSeed(),
+        frame.frameCount
+      )
+      updateGameState({
+        store: simStore,
+        frame,
+        controls,
+        galaxyService,
+        transitionCallbacks,
+        randomService,
+        stateUpdateCallbacks
+      })
+      gameSync.push()
     })
 
     // Get current state after updates
     const state = store.getState()
 
+    if (
+      options?.skipRender &&
+      canSkipRender(state, fizzTransitionService.isInitialized)
+    ) {
+      return bitmap
+    }
+
+    renderRandom.setSeed(
+      streamSeed(RandomStream.RENDER, randomService.getSeed(), frame.frameCount)
+    )
+
     // This draws all visual elements based on the updated state
     // The new implementation only handles rendering. Collisions are
     // handled via a collision map service in state. The original game
     // handled collisions via the render system and that is preserved
     // here for authenticity
-    if (state.app.collisionMode === 'original') {
-      bitmap = renderGameOriginal({
-        bitmap,
-        state,
-        spriteService,
-        store,
-        fizzTransitionService,
-        randomService
-      })
-    } else {
-      bitmap = renderGame({
-        bitmap,
-        state,
-        spriteService,
-        fizzTransitionService
-      })
-    }
+    bitmap = frameProfiler.measure('render', () =>
+      state.app.collisionMode === 'original'
+        ? renderGameOriginal({
+            bitmap,
+            state,
+            spriteService,
+            store: simStore,
+            fizzTransitionService,
+            randomService,
+            renderRandom
+          })
+        : renderGame({
+            bitmap,
+            state,
+            spriteService,
+            fizzTransitionService,
+            terrainCache: state.app.scrollTerrain ? terrainCache : undefined,
+            frameLayers,
+            renderRandom
+          })
+    )
+
+    // Original collision mode bounces and kills the ship while drawing
+    gameSync.push()
 
     // Return the final rendered bitmap
     return bitmap
@@ -151,6 +215,8 @@ export const createGameRenderer = (
 
 export const createGameRendererNew = (
   store: GameStore,
+  simStore: SimStore,
+  gameSync: GameSync,
   spriteService: SpriteService,
   galaxyService: GalaxyService,
   fizzTransitionServiceFrame: FizzTransitionServiceFrame,
@@ -163,6 +229,9 @@ export const createGameRendererNew = (
     reset: (): void => fizzTransitionServiceFrame.reset()
   }
 
+  // Cosmetic randomness, reseeded every frame (see createGameRenderer)
+  const renderRandom = createRandomService()
+
   // Create state update callbacks
   const stateUpdateCallbacks = {
     onGameOver: async (finalState: GameRootState): Promise<void> => {
@@ -226,16 +295,25 @@ export const createGameRendererNew = (
       store.getState().app.collisionMode
   }
 
-  return (frame, controls) => {
+  return (frame, controls, options) => {
     // This handles all game logic, physics, and state changes
-    updateGameState({
-      store,
-      frame,
-      controls,
-      galaxyService,
-      transitionCallbacks,
-      randomService,
-      stateUpdateCallbacks
+    // The simulation runs on its own store; the app store mirrors it
+    frameProfiler.measure('simulation', () => {
+      gameSync.pull()
+      getStoreServices().soundService.seedFrame(
+        randomService.getSeed(),
+        frame.frameCount
+      )
+      updateGameState({
+        store: simStore,
+        frame,
+        controls,
+        galaxyService,
+        transitionCallbacks,
+        randomService,
+        stateUpdateCallbacks
+      })
+      gameSync.push()
     })
 
     // Create a fresh frame
@@ -248,12 +326,26 @@ export const createGameRendererNew = (
     // Get current state after updates
     const state = store.getState()
 
-    const newFrame = renderGameNew({
-      frame: startFrame,
-      state,
-      spriteService,
-      fizzTransitionServiceFrame
-    })
+    if (
+      options?.skipRender &&
+      canSkipRender(state, fizzTransitionServiceFrame.isInitialized)
+    ) {
+      return startFrame
+    }
+
+    renderRandom.setSeed(
+      streamSeed(RandomStream.RENDER, randomService.getSeed(), frame.frameCount)
+    )
+
+    const newFrame = frameProfiler.measure('render', () =>
+      renderGameNew({
+        frame: startFrame,
+        state,
+        spriteService,
+        fizzTransitionServiceFrame,
+        renderRandom
+      })
+    )
 
     return newFrame
   }
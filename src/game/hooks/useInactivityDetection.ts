@@ -1,13 +1,32 @@
 import { useState, useEffect } from 'react'
 
+/** Pointer events that count as activity by default */
+export const POINTER_ACTIVITY_EVENTS: readonly string[] = [
+  'mousemove',
+  'touchstart',
+  'touchmove'
+]
+
+/** Pointer events plus keys and clicks, for screens any input should wake */
+export const ANY_INPUT_ACTIVITY_EVENTS: readonly string[] = [
+  ...POINTER_ACTIVITY_EVENTS,
+  'mousedown',
+  'keydown'
+]
+
 /**
  * Hook to detect user inactivity (no mouse or touch events)
  * Returns true if the user has been active recently, false otherwise
  *
  * @param timeout - Milliseconds of inactivity before considering user inactive (default: 3000)
+ * @param events - Window events that count as activity; pass a constant
+ * array, as a new one re-subscribes every render
  * @returns boolean - true if user is active, false if inactive
  */
-export const useInactivityDetection = (timeout: number = 3000): boolean => {
+export const useInactivityDetection = (
+  timeout: number = 3000,
+  events: readonly string[] = POINTER_ACTIVITY_EVENTS
+): boolean => {
   const [isActive, setIsActive] = useState(true)
 
   useEffect(() => {
@@ -23,10 +42,10 @@ export const useInactivityDetection = (timeout: number = 3000): boolean => {
       }, timeout)
     }
 
-    // Listen for mouse and touch events globally
-    window.addEventListener('mousemove', handleActivity)
-    window.addEventListener('touchstart', handleActivity)
-    window.addEventListener('touchmove', handleActivity)
+    // Listen for activity events globally
+    for (const event of events) {
+      window.addEventListener(event, handleActivity)
+    }
 
     // Start the initial timeout (controls visible on mount)
     handleActivity()
@@ -35,11 +54,11 @@ export const useInactivityDetection = (timeout: number = 3000): boolean => {
       if (timeoutId !== undefined) {
         window.clearTimeout(timeoutId)
       }
-      window.removeEventListener('mousemove', handleActivity)
-      window.removeEventListener('touchstart', handleActivity)
-      window.removeEventListener('touchmove', handleActivity)
+      for (const event of events) {
+        window.removeEventListener(event, handleActivity)
+      }
     }
-  }, [timeout])
+  }, [timeout, events])
 
   return isActive
 }
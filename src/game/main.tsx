@@ -19,6 +19,7 @@ import { createGameRenderer, createGameRendererNew } from './gameLoop'
 import { loadAppSettings } from './appMiddleware'
 import { setAlignmentMode, createRandomService } from '@/core/shared'
 import { createGameStore } from './store'
+import { createGameSync, createSimStore } from './simStore'
 import {
   setCurrentGalaxy,
   setTotalLevels,
@@ -84,7 +85,12 @@ try {
   console.log(`Sound service created (${soundMode} mode)`)
 
   const collisionService = createCollisionService()
-  collisionService.initialize({ width: SCRWTH, height: VIEWHT })
+  // The identity plane feeds the collision overlay's hit highlight
+  collisionService.initialize({
+    width: SCRWTH,
+    height: VIEWHT,
+    identity: !import.meta.env.PROD
+  })
   console.log('Collision service created')
 
   const randomService = createRandomService()
@@ -93,25 +99,28 @@ try {
   const recordingService = createRecordingService()
   console.log('Recording service created')
 
+  const services = {
+    galaxyService,
+    spriteService,
+    fizzTransitionService,
+    soundService,
+    collisionService,
+    randomService,
+    recordingService
+  }
+
   // Create store with services and initial settings
-  const store = createGameStore(
-    {
-      galaxyService,
-      spriteService,
-      fizzTransitionService,
-      soundService,
-      collisionService,
-      randomService,
-      recordingService
-    },
-    {
-      soundVolume: DEFAULT_SOUND_VOLUME,
-      soundEnabled: !DEFAULT_SOUND_MUTED,
-      initialLives: TOTAL_INITIAL_LIVES
-    }
-  )
+  const store = createGameStore(services, {
+    soundVolume: DEFAULT_SOUND_VOLUME,
+    soundEnabled: !DEFAULT_SOUND_MUTED,
+    initialLives: TOTAL_INITIAL_LIVES
+  })
   console.log('Game store created with services')
 
+  // The live game simulates on its own store, mirrored into the app store
+  const simStore = createSimStore(services)
+  const gameSync = createGameSync(store, simStore)
+
   // Set initial galaxy state
   const totalLevels = galaxyService.getHeader().planets
   store.dispatch(setCurrentGalaxy(defaultGalaxy.id))
@@ -130,6 +139,8 @@ try {
 
   const renderer = createGameRenderer(
     store,
+    simStore,
+    gameSync,
     spriteService,
     galaxyService,
     fizzTransitionService,
@@ -137,6 +148,8 @@ try {
   )
   const rendererNew = createGameRendererNew(
     store,
+    simStore,
+    gameSync,
     spriteService,
     galaxyService,
     fizzTransitionServiceFrame,
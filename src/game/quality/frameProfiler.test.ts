@@ -0,0 +1,63 @@
+import { describe, it, expect } from 'vitest'
+import { createFrameProfiler } from './frameProfiler'
+
+describe('createFrameProfiler', () => {
+  it('sums phases recorded within one frame', () => {
+    const profiler = createFrameProfiler(4)
+
+    profiler.record('simulation', 3)
+    profiler.record('simulation', 2)
+    profiler.record('render', 10)
+    profiler.record('blit', 1)
+    profiler.endFrame()
+
+    const stats = profiler.getStats()
+    expect(stats.frames).toBe(1)
+    expect(stats.simulation.mean).toBe(5)
+    expect(stats.total.mean).toBe(16)
+  })
+
+  it('keeps only the last windowSize frames', () => {
+    const profiler = createFrameProfiler(2)
+
+    for (const ms of [100, 10, 20]) {
+      profiler.record('render', ms)
+      profiler.endFrame()
+    }
+
+    const stats = profiler.getStats()
+    expect(stats.frames).toBe(2)
+    expect(stats.render.mean).toBe(15)
+    expect(stats.render.max).toBe(20)
+  })
+
+  it('counts underruns across the window', () => {
+    const profiler = createFrameProfiler(4)
+
+    profiler.recordUnderruns(2)
+    profiler.endFrame()
+    profiler.recordUnderruns(1)
+    profiler.endFrame()
+
+    expect(profiler.getStats().underruns).toBe(3)
+
+    profiler.reset()
+    expect(profiler.getStats()).toMatchObject({ frames: 0, underruns: 0 })
+  })
+
+  it('counts skipped frames across the window', () => {
+    const profiler = createFrameProfiler(4)
+
+    profiler.recordSkippedFrames(1)
+    profiler.recordSkippedFrames(2)
+    profiler.endFrame()
+    profiler.endFrame()
+
+    expect(profiler.getStats()).toMatchObject({ frames: 2, skippedFrames: 3 })
+  })
+
+  it('measure returns the wrapped value', () => {
+    const profiler = createFrameProfiler(4)
+    expect(profiler.measure('simulation', () => 42)).toBe(42)
+  })
+})
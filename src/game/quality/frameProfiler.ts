@@ -0,0 +1,195 @@
+/**
+ * @fileoverview Rolling frame-cost profiler for the live game
+ *
+ * Records how long each phase of a presented frame takes (simulation,
+ * render, blit) over a sliding window, along with audio underruns and
+ * simulation ticks that were run without being presented. The
+ * quality governor reads these numbers to decide when presentation quality
+ * should change. Nothing here feeds back into the simulation.
+ */
+
+export type FramePhase = 'simulation' | 'render' | 'blit'
+
+const FRAME_PHASES: readonly FramePhase[] = ['simulation', 'render', 'blit']
+
+export type PhaseStats = {
+  /** Mean milliseconds per frame over the window */
+  mean: number
+
+  /** Worst frame in the window */
+  max: number
+}
+
+export type FrameStats = {
+  /** Number of frames the stats cover (up to the window size) */
+  frames: number
+
+  simulation: PhaseStats
+  render: PhaseStats
+  blit: PhaseStats
+
+  /** Sum of all phases per frame */
+  total: PhaseStats
+
+  /** Audio underruns reported during the window */
+  underruns: number
+
+  /** Simulation ticks run but not presented during the window */
+  skippedFrames: number
+}
+
+export type FrameProfiler = {
+  /** Time a phase of the current frame */
+  measure<T>(phase: FramePhase, fn: () => T): T
+
+  /** Add an externally measured duration to a phase of the current frame */
+  record(phase: FramePhase, ms: number): void
+
+  /** Add audio underruns to the current frame */
+  recordUnderruns(count: number): void
+
+  /** Add catch-up ticks that were simulated without being presented */
+  recordSkippedFrames(count: number): void
+
+  /** Close the current frame and push it into the window */
+  endFrame(): void
+
+  /** Summarize the window */
+  getStats(): FrameStats
+
+  /** Drop all history (e.g. after a quality change) */
+  reset(): void
+}
+
+/**
+ * Default window: three seconds at the original 20 FPS
+ */
+export const FRAME_PROFILER_WINDOW = 60
+
+/**
+ * Create a frame profiler with a fixed-size window
+ *
+ * @param windowSize - Number of frames to keep
+ */
+export const createFrameProfiler = (
+  windowSize: number = FRAME_PROFILER_WINDOW
+): FrameProfiler => {
+  // One ring per phase, plus one each for underruns and skipped frames
+  const rings: Record<FramePhase, Float64Array> = {
+    simulation: new Float64Array(windowSize),
+    render: new Float64Array(windowSize),
+    blit: new Float64Array(windowSize)
+  }
+  const underrunRing = new Uint32Array(windowSize)
+  const skippedRing = new Uint32Array(windowSize)
+
+  // Accumulators for the frame in progress
+  const current: Record<FramePhase, number> = {
+    simulation: 0,
+    render: 0,
+    blit: 0
+  }
+  let currentUnderruns = 0
+  let currentSkipped = 0
+
+  let head = 0
+  let count = 0
+
+  const record = (phase: FramePhase, ms: number): void => {
+    current[phase] += ms
+  }
+
+  const measure = <T>(phase: FramePhase, fn: () => T): T => {
+    const start = performance.now()
+    try {
+      return fn()
+    } finally {
+      record(phase, performance.now() - start)
+    }
+  }
+
+  const recordUnderruns = (underruns: number): void => {
+    currentUnderruns += underruns
+  }
+
+  const recordSkippedFrames = (skipped: number): void => {
+    currentSkipped += skipped
+  }
+
+  const endFrame = (): void => {
+    for (const phase of FRAME_PHASES) {
+      rings[phase][head] = current[phase]
+      current[phase] = 0
+    }
+    underrunRing[head] = currentUnderruns
+    currentUnderruns = 0
+    skippedRing[head] = currentSkipped
+    currentSkipped = 0
+
+    head = (head + 1) % windowSize
+    count = Math.min(count + 1, windowSize)
+  }
+
+  const summarize = (values: ArrayLike<number>): PhaseStats => {
+    let sum = 0
+    let max = 0
+    for (let i = 0; i < count; i++) {
+      const v = values[i]!
+      sum += v
+      if (v > max) max = v
+    }
+    return { mean: count > 0 ? sum / count : 0, max }
+  }
+
+  const getStats = (): FrameStats => {
+    const totals = new Float64Array(count)
+    let underruns = 0
+    let skippedFrames = 0
+    for (let i = 0; i < count; i++) {
+      totals[i] = rings.simulation[i]! + rings.render[i]! + rings.blit[i]!
+      underruns += underrunRing[i]!
+      skippedFrames += skippedRing[i]!
+    }
+
+    return {
+      frames: count,
+      simulation: summarize(rings.simulation),
+      render: summarize(rings.render),
+      blit: summarize(rings.blit),
+      total: summarize(totals),
+      underruns,
+      skippedFrames
+    }
+  }
+
+  const reset = (): void => {
+    for (const phase of FRAME_PHASES) {
+      rings[phase].fill(0)
+      current[phase] = 0
+    }
+    underrunRing.fill(0)
+    currentUnderruns = 0
+    skippedRing.fill(0)
+    currentSkipped = 0
+    head = 0
+    count = 0
+  }
+
+  return {
+    measure,
+    record,
+    recordUnderruns,
+    recordSkippedFrames,
+    endFrame,
+    getStats,
+    reset
+  }
+}
+
+/**
+ * Shared profiler for the live game
+ *
+ * The game loop closures in gameLoop.ts time simulation and rendering,
+ * GameRenderer times the blit and closes each frame.
+ */
+export const frameProfiler = createFrameProfiler()
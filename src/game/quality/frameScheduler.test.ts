@@ -0,0 +1,50 @@
+import { describe, it, expect } from 'vitest'
+import { createFrameScheduler } from './frameScheduler'
+
+describe('createFrameScheduler', () => {
+  it('runs one tick per interval on a 60Hz display', () => {
+    const scheduler = createFrameScheduler({ tickMs: 50 }, 0)
+
+    let ticks = 0
+    for (let frame = 1; frame <= 60; frame++) {
+      ticks += scheduler.advance((frame * 1000) / 60).ticks
+    }
+
+    // One second of wall-clock time is 20 ticks
+    expect(ticks).toBe(20)
+  })
+
+  it('catches up when frames arrive late', () => {
+    const scheduler = createFrameScheduler({ tickMs: 50 }, 0)
+
+    // A device that can only present every 70ms
+    let ticks = 0
+    for (let time = 70; time <= 700; time += 70) {
+      ticks += scheduler.advance(time).ticks
+    }
+
+    expect(ticks).toBe(14)
+  })
+
+  it('caps ticks per frame and drops the backlog', () => {
+    const scheduler = createFrameScheduler(
+      { tickMs: 50, maxTicksPerFrame: 4 },
+      0
+    )
+
+    expect(scheduler.advance(1000)).toEqual({ ticks: 4, droppedMs: 800 })
+
+    // Backlog is gone, so the next frame is back to normal pacing
+    expect(scheduler.advance(1050).ticks).toBe(1)
+  })
+
+  it('reset forgets accumulated time', () => {
+    const scheduler = createFrameScheduler({ tickMs: 50 }, 0)
+
+    scheduler.advance(40)
+    scheduler.reset(500)
+
+    expect(scheduler.advance(540).ticks).toBe(0)
+    expect(scheduler.advance(550).ticks).toBe(1)
+  })
+})
@@ -0,0 +1,85 @@
+/**
+ * @fileoverview Fixed-step catch-up scheduler for the live game
+ *
+ * The simulation must advance at exactly 20 ticks per second of wall-clock
+ * time no matter how often the browser gives us a frame. The scheduler
+ * accumulates elapsed time and reports how many ticks are due; the caller
+ * runs them back-to-back and only presents the last one.
+ *
+ * If a device falls so far behind that more than `maxTicksPerFrame` ticks
+ * are due (a long GC pause, a backgrounded tab), the excess time is
+ * dropped rather than carried forward. Without that cap each catch-up
+ * frame would cost more than the one before it and the game would never
+ * recover (the "spiral of death").
+ */
+
+export type FrameSchedulerConfig = {
+  /** Milliseconds per simulation tick (50ms at 20 FPS) */
+  tickMs: number
+
+  /** Most ticks run for a single browser frame */
+  maxTicksPerFrame: number
+}
+
+export const DEFAULT_SCHEDULER_CONFIG: FrameSchedulerConfig = {
+  tickMs: 1000 / 20,
+  maxTicksPerFrame: 4
+}
+
+export type FrameSchedule = {
+  /** Ticks to run this browser frame (0 if none are due yet) */
+  ticks: number
+
+  /** Wall-clock time dropped by the spiral-of-death cap, in ms */
+  droppedMs: number
+}
+
+export type FrameScheduler = {
+  /** Account for time up to `now` and report how many ticks are due */
+  advance(now: number): FrameSchedule
+
+  /** Restart timing from `now`, forgetting any backlog (unpause, tab shown) */
+  reset(now: number): void
+}
+
+/**
+ * Create a frame scheduler
+ *
+ * @param config - Overrides for the default tick length and cap
+ * @param now - Time the first tick interval starts from
+ */
+export const createFrameScheduler = (
+  config: Partial<FrameSchedulerConfig> = {},
+  now: number = 0
+): FrameScheduler => {
+  const { tickMs, maxTicksPerFrame } = {
+    ...DEFAULT_SCHEDULER_CONFIG,
+    ...config
+  }
+
+  let lastTime = now
+  let accumulated = 0
+
+  const advance = (time: number): FrameSchedule => {
+    // Clock going backwards would otherwise eat future ticks
+    accumulated += Math.max(0, time - lastTime)
+    lastTime = time
+
+    const due = Math.floor(accumulated / tickMs)
+    if (due > maxTicksPerFrame) {
+      const droppedMs = accumulated - maxTicksPerFrame * tickMs
+      accumulated = 0
+      return { ticks: maxTicksPerFrame, droppedMs }
+    }
+
+    accumulated -= due * tickMs
+    return { ticks: due, droppedMs: 0 }
+  }
+
+  const reset = (time: number): void => {
+    lastTime = time
+    accumulated = 0
+  }
+
+  return { advance, reset }
+}
@@ -0,0 +1,105 @@
+import { describe, it, expect } from 'vitest'
+import {
+  createQualityGovernor,
+  getPresentationQuality,
+  LOWEST_QUALITY_LEVEL,
+  QUALITY_LEVELS
+} from './qualityGovernor'
+import type { FrameStats } from './frameProfiler'
+
+const statsWithCost = (totalMs: number, underruns = 0): FrameStats => ({
+  frames: 60,
+  simulation: { mean: totalMs / 2, max: totalMs / 2 },
+  render: { mean: totalMs / 4, max: totalMs / 4 },
+  blit: { mean: totalMs / 4, max: totalMs / 4 },
+  total: { mean: totalMs, max: totalMs },
+  underruns,
+  skippedFrames: 0
+})
+
+describe('createQualityGovernor', () => {
+  it('starts at best quality', () => {
+    const governor = createQualityGovernor()
+    expect(governor.getLevel()).toBe(0)
+  })
+
+  it('steps down only after consecutive slow evaluations', () => {
+    const governor = createQualityGovernor({ downshiftAfter: 2 })
+
+    expect(governor.evaluate(statsWithCost(45))).toBe(0)
+    expect(governor.evaluate(statsWithCost(45))).toBe(1)
+  })
+
+  it('a fast evaluation interrupts a slow run', () => {
+    const governor = createQualityGovernor({ downshiftAfter: 2 })
+
+    governor.evaluate(statsWithCost(45))
+    governor.evaluate(statsWithCost(10))
+    expect(governor.evaluate(statsWithCost(45))).toBe(0)
+  })
+
+  it('treats audio underruns as over budget', () => {
+    const governor = createQualityGovernor({ downshiftAfter: 1 })
+    expect(governor.evaluate(statsWithCost(5, 1))).toBe(1)
+  })
+
+  it('needs a long comfortable run to step back up', () => {
+    const governor = createQualityGovernor(
+      { downshiftAfter: 1, upshiftAfter: 3 },
+      2
+    )
+
+    governor.evaluate(statsWithCost(10))
+    governor.evaluate(statsWithCost(10))
+    expect(governor.getLevel()).toBe(2)
+    expect(governor.evaluate(statsWithCost(10))).toBe(1)
+  })
+
+  it('holds steady in the dead band between thresholds', () => {
+    const governor = createQualityGovernor(
+      { downshiftAfter: 1, upshiftAfter: 1 },
+      1
+    )
+
+    // 30ms is 60% of the 50ms budget - neither slow nor comfortable
+    for (let i = 0; i < 10; i++) {
+      expect(governor.evaluate(statsWithCost(30))).toBe(1)
+    }
+  })
+
+  it('ignores windows with too few frames', () => {
+    const governor = createQualityGovernor({ downshiftAfter: 1 })
+    expect(governor.evaluate({ ...statsWithCost(100), frames: 5 })).toBe(0)
+  })
+
+  it('never goes past the ends of the ladder', () => {
+    const governor = createQualityGovernor({ downshiftAfter: 1 })
+    for (let i = 0; i < 20; i++) {
+      governor.evaluate(statsWithCost(100))
+    }
+    expect(governor.getLevel()).toBe(LOWEST_QUALITY_LEVEL)
+
+    governor.reset()
+    expect(governor.getLevel()).toBe(0)
+  })
+})
+
+describe('getPresentationQuality', () => {
+  it('clamps out-of-range levels', () => {
+    expect(getPresentationQuality(-1)).toBe(QUALITY_LEVELS[0])
+    expect(getPresentationQuality(99)).toBe(
+      QUALITY_LEVELS[LOWEST_QUALITY_LEVEL]
+    )
+  })
+
+  it('only ever reduces quality going down the ladder', () => {
+    for (let i = 1; i < QUALITY_LEVELS.length; i++) {
+      const prev = QUALITY_LEVELS[i - 1]!
+      const next = QUALITY_LEVELS[i]!
+      expect(next.soundChannels).toBeLessThanOrEqual(prev.soundChannels)
+      expect(prev.bitmapRenderer && !next.bitmapRenderer).toBe(false)
+      expect(prev.nativeResolution && !next.nativeResolution).toBe(false)
+      expect(!prev.collisionOverlay && next.collisionOverlay).toBe(false)
+    }
+  })
+})
@@ -0,0 +1,188 @@
+/**
+ * @fileoverview Adaptive presentation quality governor
+ *
+ * Steps presentation quality down when measured frame cost threatens the
+ * 20 FPS budget, and back up once there is comfortable headroom. Every
+ * knob here is presentation-only: the simulation, collision mode and
+ * recordings are identical at every level.
+ *
+ * Hysteresis comes from requiring several consecutive evaluations in the
+ * same direction, with a much longer run required to step up than down so
+ * the governor does not oscillate around a threshold.
+ */
+
+import type { FrameStats } from './frameProfiler'
+
+/**
+ * What a quality level allows the presentation layer to do
+ */
+export type PresentationQuality = {
+  /** Debug collision-map overlay may be drawn */
+  collisionOverlay: boolean
+
+  /** Mixer channels available to new sounds (modern sound only) */
+  soundChannels: number
+
+  /** Use the bitmap renderer even if the modern renderer is selected */
+  bitmapRenderer: boolean
+
+  /** Keep the canvas backing store at 1x and let CSS do the upscale */
+  nativeResolution: boolean
+}
+
+/**
+ * Quality ladder, best first
+ */
+export const QUALITY_LEVELS: readonly PresentationQuality[] = [
+  {
+    collisionOverlay: true,
+    soundChannels: 8,
+    bitmapRenderer: false,
+    nativeResolution: false
+  },
+  {
+    collisionOverlay: false,
+    soundChannels: 8,
+    bitmapRenderer: false,
+    nativeResolution: false
+  },
+  {
+    collisionOverlay: false,
+    soundChannels: 4,
+    bitmapRenderer: false,
+    nativeResolution: false
+  },
+  {
+    collisionOverlay: false,
+    soundChannels: 4,
+    bitmapRenderer: true,
+    nativeResolution: false
+  },
+  {
+    collisionOverlay: false,
+    soundChannels: 4,
+    bitmapRenderer: true,
+    nativeResolution: true
+  }
+]
+
+export const BEST_QUALITY_LEVEL = 0
+export const LOWEST_QUALITY_LEVEL = QUALITY_LEVELS.length - 1
+
+/**
+ * Look up a level, clamping out-of-range values
+ */
+export const getPresentationQuality = (level: number): PresentationQuality =>
+  QUALITY_LEVELS[
+    Math.max(BEST_QUALITY_LEVEL, Math.min(LOWEST_QUALITY_LEVEL, level))
+  ]!
+
+export type QualityGovernorConfig = {
+  /** Frame budget in milliseconds (50ms at 20 FPS) */
+  budgetMs: number
+
+  /** Mean frame cost above this fraction of the budget is too slow */
+  downshiftLoad: number
+
+  /** Mean frame cost below this fraction of the budget has headroom */
+  upshiftLoad: number
+
+  /** Consecutive slow evaluations before stepping down */
+  downshiftAfter: number
+
+  /** Consecutive comfortable evaluations before stepping up */
+  upshiftAfter: number
+
+  /** Minimum frames an evaluation must cover */
+  minFrames: number
+}
+
+export const DEFAULT_GOVERNOR_CONFIG: QualityGovernorConfig = {
+  budgetMs: 50,
+  downshiftLoad: 0.8,
+  upshiftLoad: 0.4,
+  downshiftAfter: 2,
+  upshiftAfter: 10,
+  minFrames: 20
+}
+
+export type QualityGovernor = {
+  /**
+   * Feed the latest frame stats and get the (possibly new) level
+   */
+  evaluate(stats: FrameStats): number
+
+  /** Current level */
+  getLevel(): number
+
+  /** Jump to a level and forget accumulated history */
+  reset(level?: number): void
+}
+
+/**
+ * Create a quality governor
+ *
+ * @param config - Overrides for the default thresholds
+ * @param initialLevel - Starting level (best quality by default)
+ */
+export const createQualityGovernor = (
+  config: Partial<QualityGovernorConfig> = {},
+  initialLevel: number = BEST_QUALITY_LEVEL
+): QualityGovernor => {
+  const {
+    budgetMs,
+    downshiftLoad,
+    upshiftLoad,
+    downshiftAfter,
+    upshiftAfter,
+    minFrames
+  } = { ...DEFAULT_GOVERNOR_CONFIG, ...config }
+
+  let level = initialLevel
+  let slowRuns = 0
+  let fastRuns = 0
+
+  const evaluate = (stats: FrameStats): number => {
+    if (stats.frames < minFrames) {
+      return level
+    }
+
+    const load = stats.total.mean / budgetMs
+    const slow = load > downshiftLoad || stats.underruns > 0
+    const comfortable = load < upshiftLoad && stats.underruns === 0
+
+    if (slow) {
+      fastRuns = 0
+      slowRuns++
+      if (slowRuns >= downshiftAfter && level < LOWEST_QUALITY_LEVEL) {
+        level++
+        slowRuns = 0
+      }
+    } else if (comfortable) {
+      slowRuns = 0
+      fastRuns++
+      if (fastRuns >= upshiftAfter && level > BEST_QUALITY_LEVEL) {
+        level--
+        fastRuns = 0
+      }
+    } else {
+      // In the dead band - hold steady
+      slowRuns = 0
+      fastRuns = 0
+    }
+
+    return level
+  }
+
+  const reset = (newLevel: number = BEST_QUALITY_LEVEL): void => {
+    level = newLevel
+    slowRuns = 0
+    fastRuns = 0
+  }
+
+  return {
+    evaluate,
+    getLevel: () => level,
+    reset
+  }
+}
@@ -5,7 +5,7 @@
  * terrain, sprites, effects, and UI elements
  */
 
-import type { MonochromeBitmap } from '@lib/bitmap'
+import { applyLayer, type MonochromeBitmap } from '@lib/bitmap'
 import type { SpriteService } from '@core/sprites'
 import type { RootState } from './store'
 import type { BunkerKind, ShardSprite, ShardSpriteSet } from '@core/figs'
@@ -25,24 +25,51 @@ import { drawExplosions } from '@render/explosions'
 import { updateSbar, sbarClear } from '@render/status'
 import { SCRWTH, VIEWHT } from '@core/screen'
 import { viewClear, viewWhite } from '@render/screen'
-import { whiteTerrain, blackTerrain } from '@render/walls'
+import {
+  whiteTerrain,
+  blackTerrain,
+  updateTerrainCache,
+  type TerrainCache
+} from '@render/walls'
 import { LINE_KIND } from '@core/walls'
-import { getAlignment, getBackgroundPattern } from '@core/shared'
+import { getVisibleSet } from '@core/visibility'
+import {
+  getAlignment,
+  getBackgroundPattern,
+  type RandomService
+} from '@core/shared'
 import { FIZZ_DURATION } from '@core/transition'
 import { starBackground } from '@render/transition'
+import type { FrameLayers } from './frameLayers'
+
+type Pass = (screen: MonochromeBitmap) => MonochromeBitmap
 
 export type RenderContext = {
   bitmap: MonochromeBitmap
   state: RootState
   spriteService: SpriteService
   fizzTransitionService: FizzTransitionService
+  /** Reuse terrain between frames instead of drawing it all (see scrollTerrain) */
+  terrainCache?: TerrainCache
+  /** Keep view-independent passes as layers between frames (see frameLayers) */
+  frameLayers?: FrameLayers
+  /** Render random stream, seeded for this frame (see randomStreams) */
+  renderRandom: RandomService
 }
 
 /**
  * Main rendering function - matches exact order from main branch gameLoop.ts
  */
 export const renderGame = (context: RenderContext): MonochromeBitmap => {
-  let { bitmap, state, spriteService, fizzTransitionService } = context
+  let {
+    bitmap,
+    state,
+    spriteService,
+    fizzTransitionService,
+    terrainCache,
+    frameLayers,
+    renderRandom
+  } = context
 
   // Helper to add status bar to bitmap - used for fizz/starmap phases
   const addStatusBar = (bmp: MonochromeBitmap): MonochromeBitmap => {
@@ -104,6 +131,9 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
 
   const on_right_side = state.screen.screenx > state.planet.worldwidth - SCRWTH
 
+  // Candidates near the view, tracked incrementally across frames
+  const visible = getVisibleSet(state)
+
   // Get ship sprites
   const shipSprite = spriteService.getShipSprite(state.ship.shiprot, {
     variant: 'def'
@@ -117,6 +147,14 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
   const SHADOW_OFFSET_X = 8
   const SHADOW_OFFSET_Y = 5
 
+  // Passes that don't depend on the view are reused from earlier frames
+  // when the caller keeps layers. Everything drawn relative to screenx and
+  // screeny changes on each scrolling frame, so it is drawn directly (or
+  // scrolled on by the terrain cache) instead.
+  const layer = (name: string, inputs: readonly unknown[], pass: Pass): Pass =>
+    frameLayers ? frameLayers.layer(name, inputs, pass) : pass
+  frameLayers?.beginFrame()
+
   // Start with the actual bitmap
   let renderedBitmap = bitmap
 
@@ -140,7 +178,8 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
     scrny: state.screen.screeny,
     worldwidth: state.planet.worldwidth,
     on_right_side,
-    craterImages
+    craterImages,
+    visible: visible.craters
   })(renderedBitmap)
 
   // 3. do_fuels
@@ -177,7 +216,8 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
     fuels: state.planet.fuels,
     scrnx: state.screen.screenx,
     scrny: state.screen.screeny,
-    fuelSprites
+    fuelSprites,
+    visible: visible.fuels
   })(renderedBitmap)
 
   // Handle world wrapping for fuel cells
@@ -186,13 +226,13 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
       fuels: state.planet.fuels,
       scrnx: state.screen.screenx - state.planet.worldwidth,
       scrny: state.screen.screeny,
-      fuelSprites
+      fuelSprites,
+      visible: visible.fuels
     })(renderedBitmap)
   }
 
   // 4. Status bar
   const statusBarTemplate = spriteService.getStatusBarTemplate()
-  renderedBitmap = sbarClear({ statusBarTemplate })(renderedBitmap)
 
   const statusData = {
     fuel: state.ship.fuel,
@@ -204,7 +244,18 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
     spriteService
   }
 
-  renderedBitmap = updateSbar(statusData)(renderedBitmap)
+  renderedBitmap = layer(
+    'status',
+    [
+      statusData.fuel,
+      statusData.lives,
+      statusData.score,
+      statusData.bonus,
+      statusData.level,
+      statusData.message
+    ],
+    screen => updateSbar(statusData)(sbarClear({ statusBarTemplate })(screen))
+  )(renderedBitmap)
 
   // 5. gray_figure - ship shadow background (only if ship is alive)
   if (state.ship.deadCount === 0) {
@@ -233,24 +284,42 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
     })(renderedBitmap)
   }
 
-  // 6. white_terrain - wall undersides/junctions
-  renderedBitmap = whiteTerrain({
-    whites: state.walls.whites,
-    junctions: state.walls.junctions,
-    firstWhite: state.walls.firstWhite,
-    organizedWalls: state.walls.organizedWalls,
-    viewport: viewport,
-    worldwidth: state.planet.worldwidth
-  })(renderedBitmap)
+  // Terrain layers scrolled on from the previous frame, if caching
+  const terrain = terrainCache
+    ? updateTerrainCache(terrainCache, {
+        walls: state.walls,
+        viewport,
+        worldwidth: state.planet.worldwidth,
+        screen: renderedBitmap,
+        visible
+      })
+    : null
+
+  if (terrain) {
+    // 6-7. white_terrain and black_terrain(L_GHOST) from the cache
+    renderedBitmap = applyLayer(terrain.under)(renderedBitmap)
+  } else {
+    // 6. white_terrain - wall undersides/junctions
+    renderedBitmap = whiteTerrain({
+      whites: state.walls.whites,
+      junctions: state.walls.junctions,
+      firstWhite: state.walls.firstWhite,
+      organizedWalls: state.walls.organizedWalls,
+      viewport: viewport,
+      worldwidth: state.planet.worldwidth,
+      whiteStartId: visible.whiteStart
+    })(renderedBitmap)
 
-  // 7. black_terrain(L_GHOST) - ghost walls
-  renderedBitmap = blackTerrain({
-    thekind: LINE_KIND.GHOST,
-    kindPointers: state.walls.kindPointers,
-    organizedWalls: state.walls.organizedWalls,
-    viewport: viewport,
-    worldwidth: state.planet.worldwidth
-  })(renderedBitmap)
+    // 7. black_terrain(L_GHOST) - ghost walls
+    renderedBitmap = blackTerrain({
+      thekind: LINE_KIND.GHOST,
+      kindPointers: state.walls.kindPointers,
+      organizedWalls: state.walls.organizedWalls,
+      viewport: viewport,
+      worldwidth: state.planet.worldwidth,
+      startId: visible.kindStarts[LINE_KIND.GHOST]
+    })(renderedBitmap)
+  }
 
   // 8. erase_figure - erase ship area (only if ship is alive)
   if (state.ship.deadCount === 0) {
@@ -261,23 +330,30 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
     })(renderedBitmap)
   }
 
-  // 9. Draw bounce lines
-  renderedBitmap = blackTerrain({
-    thekind: LINE_KIND.BOUNCE,
-    kindPointers: state.walls.kindPointers,
-    organizedWalls: state.walls.organizedWalls,
-    viewport: viewport,
-    worldwidth: state.planet.worldwidth
-  })(renderedBitmap)
+  if (terrain) {
+    // 9-10. Bounce and normal walls from the cache
+    renderedBitmap = applyLayer(terrain.over)(renderedBitmap)
+  } else {
+    // 9. Draw bounce lines
+    renderedBitmap = blackTerrain({
+      thekind: LINE_KIND.BOUNCE,
+      kindPointers: state.walls.kindPointers,
+      organizedWalls: state.walls.organizedWalls,
+      viewport: viewport,
+      worldwidth: state.planet.worldwidth,
+      startId: visible.kindStarts[LINE_KIND.BOUNCE]
+    })(renderedBitmap)
 
-  // 10. black_terrain(L_NORMAL) - normal walls
-  renderedBitmap = blackTerrain({
-    thekind: LINE_KIND.NORMAL,
-    kindPointers: state.walls.kindPointers,
-    organizedWalls: state.walls.organizedWalls,
-    viewport: viewport,
-    worldwidth: state.planet.worldwidth
-  })(renderedBitmap)
+    // 10. black_terrain(L_NORMAL) - normal walls
+    renderedBitmap = blackTerrain({
+      thekind: LINE_KIND.NORMAL,
+      kindPointers: state.walls.kindPointers,
+      organizedWalls: state.walls.organizedWalls,
+      viewport: viewport,
+      worldwidth: state.planet.worldwidth,
+      startId: visible.kindStarts[LINE_KIND.NORMAL]
+    })(renderedBitmap)
+  }
 
   // 11. do_bunkers - render all bunkers
   const getBunkerSprite = (
@@ -319,7 +395,8 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
     bunkrec: state.planet.bunkers,
     scrnx: state.screen.screenx,
     scrny: state.screen.screeny,
-    getSprite: getBunkerSprite
+    getSprite: getBunkerSprite,
+    visible: visible.bunkers
   })(renderedBitmap)
 
   // Second pass - wrapped position
@@ -328,7 +405,8 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
       bunkrec: state.planet.bunkers,
       scrnx: state.screen.screenx - state.planet.worldwidth,
       scrny: state.screen.screeny,
-      getSprite: getBunkerSprite
+      getSprite: getBunkerSprite,
+      visible: visible.bunkers
     })(renderedBitmap)
   }
 
@@ -562,6 +640,7 @@ export const renderGame = (context: RenderContext): MonochromeBitmap => {
 
     const targetBitmap = starBackground({
       starCount: STAR_COUNT,
+      random: renderRandom,
       additionalRender:
         // don't draw ship if it's dead
         state.ship.deadCount === 0
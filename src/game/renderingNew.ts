@@ -2,7 +2,7 @@ import type { Frame } from '@/lib/frame/types'
 import type { RootState } from './store'
 import type { SpriteService } from '@/core/sprites'
 import type { FizzTransitionServiceFrame } from '@/core/transition'
-import { LINE_KIND } from '@/core/shared'
+import { LINE_KIND, type RandomService } from '@/core/shared'
 import { SCRWTH, VIEWHT } from '@/core/screen'
 import { drawWalls } from '@/render-modern/walls'
 import { drawShip, drawShield } from '@/render-modern/ship'
@@ -25,10 +25,12 @@ export type RenderContextNew = {
   state: RootState
   spriteService: SpriteService
   fizzTransitionServiceFrame: FizzTransitionServiceFrame
+  /** Render random stream, seeded for this frame (see randomStreams) */
+  renderRandom: RandomService
 }
 
 export const renderGameNew = (context: RenderContextNew): Frame => {
-  let { frame, state, fizzTransitionServiceFrame } = context
+  let { frame, state, fizzTransitionServiceFrame, renderRandom } = context
   const viewport = {
     x: state.screen.screenx,
     y: state.screen.screeny,
@@ -291,7 +293,8 @@ export const renderGameNew = (context: RenderContextNew): Frame => {
       newFrame, // Use the fully rendered frame as "from"
       shipInfo, // Ship position for SHIP_FIZZ z-order
       150, // Star count
-      FIZZ_DURATION // Duration in frames
+      FIZZ_DURATION, // Duration in frames
+      renderRandom // Places the stars
     )
 
     // Return the first fizz frame
@@ -7,7 +7,8 @@
 
 import type { MonochromeBitmap } from '@lib/bitmap'
 import type { SpriteService } from '@core/sprites'
-import type { RootState, GameStore } from './store'
+import type { RootState } from './store'
+import type { SimStore } from './simStore'
 import type { BunkerKind, ShardSprite, ShardSpriteSet } from '@core/figs'
 import type { FizzTransitionService } from '@core/transition'
 
@@ -28,6 +29,7 @@ import { SCRWTH, VIEWHT } from '@core/screen'
 import { viewClear, viewWhite } from '@render/screen'
 import { whiteTerrain, blackTerrain } from '@render/walls'
 import { LINE_KIND } from '@core/walls'
+import { getVisibleSet } from '@core/visibility'
 import { getAlignment, getBackgroundPattern } from '@core/shared'
 import type { RandomService } from '@/core/shared'
 import { triggerShipDeath } from '@core/game'
@@ -41,9 +43,11 @@ export type RenderOriginalContext = {
   // we currently have a dependency on the store at the rendering phase because collision detections are
   // handled through rendering (checkFigure(), specifically). that means handling ship deaths and ship
   // bounces currently have to take place in the rendering stage
-  store: GameStore
+  store: SimStore
   fizzTransitionService: FizzTransitionService
   randomService: RandomService
+  /** Render random stream, seeded for this frame (see randomStreams) */
+  renderRandom: RandomService
 }
 
 /**
@@ -58,7 +62,8 @@ export const renderGameOriginal = (
     spriteService,
     store,
     fizzTransitionService,
-    randomService
+    randomService,
+    renderRandom
   } = context
 
   // Helper to add status bar to bitmap - used for fizz/starmap phases
@@ -121,6 +126,9 @@ export const renderGameOriginal = (
 
   const on_right_side = state.screen.screenx > state.planet.worldwidth - SCRWTH
 
+  // Candidates near the view, tracked incrementally across frames
+  const visible = getVisibleSet(state)
+
   // Get ship sprites
   const shipSprite = spriteService.getShipSprite(state.ship.shiprot, {
     variant: 'def'
@@ -157,7 +165,8 @@ export const renderGameOriginal = (
     scrny: state.screen.screeny,
     worldwidth: state.planet.worldwidth,
     on_right_side,
-    craterImages
+    craterImages,
+    visible: visible.craters
   })(renderedBitmap)
 
   // 3. do_fuels
@@ -194,7 +203,8 @@ export const renderGameOriginal = (
     fuels: state.planet.fuels,
     scrnx: state.screen.screenx,
     scrny: state.screen.screeny,
-    fuelSprites
+    fuelSprites,
+    visible: visible.fuels
   })(renderedBitmap)
 
   // Handle world wrapping for fuel cells
@@ -203,7 +213,8 @@ export const renderGameOriginal = (
       fuels: state.planet.fuels,
       scrnx: state.screen.screenx - state.planet.worldwidth,
       scrny: state.screen.screeny,
-      fuelSprites
+      fuelSprites,
+      visible: visible.fuels
     })(renderedBitmap)
   }
 
@@ -257,7 +268,8 @@ export const renderGameOriginal = (
     firstWhite: state.walls.firstWhite,
     organizedWalls: state.walls.organizedWalls,
     viewport: viewport,
-    worldwidth: state.planet.worldwidth
+    worldwidth: state.planet.worldwidth,
+    whiteStartId: visible.whiteStart
   })(renderedBitmap)
 
   // 7. black_terrain(L_GHOST) - ghost walls
@@ -266,7 +278,8 @@ export const renderGameOriginal = (
     kindPointers: state.walls.kindPointers,
     organizedWalls: state.walls.organizedWalls,
     viewport: viewport,
-    worldwidth: state.planet.worldwidth
+    worldwidth: state.planet.worldwidth,
+    startId: visible.kindStarts[LINE_KIND.GHOST]
   })(renderedBitmap)
 
   // 8. erase_figure - erase ship area (only if ship is alive)
@@ -287,10 +300,12 @@ export const renderGameOriginal = (
       shipDef: shipMaskBitmap,
       wallData: {
         kindPointers: state.walls.kindPointers,
-        organizedWalls: state.walls.organizedWalls
+        organizedWalls: state.walls.organizedWalls,
+        kindIndex: state.walls.kindIndex
       },
       viewport: viewport,
-      worldwidth: state.planet.worldwidth
+      worldwidth: state.planet.worldwidth,
+      startId: visible.kindStarts[LINE_KIND.BOUNCE]
     })
   } else {
     // When dead, just draw bounce walls without collision check
@@ -299,7 +314,8 @@ export const renderGameOriginal = (
       kindPointers: state.walls.kindPointers,
       organizedWalls: state.walls.organizedWalls,
       viewport: viewport,
-      worldwidth: state.planet.worldwidth
+      worldwidth: state.planet.worldwidth,
+      startId: visible.kindStarts[LINE_KIND.BOUNCE]
     })(renderedBitmap)
   }
 
@@ -309,7 +325,8 @@ export const renderGameOriginal = (
     kindPointers: state.walls.kindPointers,
     organizedWalls: state.walls.organizedWalls,
     viewport: viewport,
-    worldwidth: state.planet.worldwidth
+    worldwidth: state.planet.worldwidth,
+    startId: visible.kindStarts[LINE_KIND.NORMAL]
   })(renderedBitmap)
 
   // 11. do_bunkers - render all bunkers
@@ -352,7 +369,8 @@ export const renderGameOriginal = (
     bunkrec: state.planet.bunkers,
     scrnx: state.screen.screenx,
     scrny: state.screen.screeny,
-    getSprite: getBunkerSprite
+    getSprite: getBunkerSprite,
+    visible: visible.bunkers
   })(renderedBitmap)
 
   // Second pass - wrapped position
@@ -361,7 +379,8 @@ export const renderGameOriginal = (
       bunkrec: state.planet.bunkers,
       scrnx: state.screen.screenx - state.planet.worldwidth,
       scrny: state.screen.screeny,
-      getSprite: getBunkerSprite
+      getSprite: getBunkerSprite,
+      visible: visible.bunkers
     })(renderedBitmap)
   }
 
@@ -611,6 +630,7 @@ export const renderGameOriginal = (
 
     const targetBitmap = starBackground({
       starCount: STAR_COUNT,
+      random: renderRandom,
       additionalRender:
         // don't draw ship if it's dead
         state.ship.deadCount === 0
@@ -0,0 +1,72 @@
+import { describe, it, expect } from 'vitest'
+import { configureStore, type UnknownAction } from '@reduxjs/toolkit'
+import { gameReducer, gameSlice, withGameSync } from '@core/game'
+import { shipSlice } from '@core/ship'
+import { createGameSync, type SimStore } from './simStore'
+import type { GameStore } from './store'
+
+// Only the game slices matter to the sync, so both sides can be plain
+// game stores that record what is dispatched to them
+const createRecordedStore = (): {
+  store: ReturnType<typeof configureStore<ReturnType<typeof gameReducer>>>
+  actions: UnknownAction[]
+} => {
+  const actions: UnknownAction[] = []
+  const store = configureStore({
+    reducer: withGameSync(gameReducer),
+    middleware: getDefaultMiddleware =>
+      getDefaultMiddleware().prepend(() => next => action => {
+        actions.push(action as UnknownAction)
+        return next(action)
+      })
+  })
+  return { store, actions }
+}
+
+describe('createGameSync', () => {
+  it('mirrors the simulation into the app store in one action', () => {
+    const app = createRecordedStore()
+    const sim = createRecordedStore()
+    const sync = createGameSync(
+      app.store as unknown as GameStore,
+      sim.store as unknown as SimStore
+    )
+
+    app.store.dispatch(shipSlice.actions.resetLives(5))
+    sync.pull()
+    expect(sim.store.getState().ship.lives).toBe(5)
+
+    sim.store.dispatch(gameSlice.actions.pause())
+    sim.store.dispatch(shipSlice.actions.extraLife())
+    app.actions.length = 0
+    sync.push()
+
+    expect(app.actions).toHaveLength(1)
+    expect(Object.keys(app.actions[0]!.payload as object).sort()).toEqual([
+      'game',
+      'ship'
+    ])
+    expect(app.store.getState()).toEqual(sim.store.getState())
+  })
+
+  it('pulls only what the app store changed since the last sync', () => {
+    const app = createRecordedStore()
+    const sim = createRecordedStore()
+    const sync = createGameSync(
+      app.store as unknown as GameStore,
+      sim.store as unknown as SimStore
+    )
+    sync.pull()
+    sync.push()
+
+    sim.actions.length = 0
+    sync.pull()
+    expect(sim.actions).toHaveLength(0)
+
+    app.store.dispatch(gameSlice.actions.togglePause())
+    sync.pull()
+    expect(sim.actions).toHaveLength(1)
+    expect(sim.store.getState().game.paused).toBe(true)
+    expect(sim.store.getState().ship).toBe(app.store.getState().ship)
+  })
+})
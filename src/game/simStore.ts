@@ -0,0 +1,123 @@
+/**
+ * @fileoverview Simulation store for the live game
+ *
+ * updateGameState dispatches a few dozen actions per tick. On the app
+ * store each of them would also run through the app, highscore and
+ * controls middleware, none of which care about game actions. The live
+ * game instead simulates on a store of its own, built on the same reducer
+ * as the headless store, with only the sync thunk middleware and the game
+ * sound listener.
+ *
+ * The app store keeps a mirror of the game slices for the UI. A GameSync
+ * brings the two in line around each tick: game actions the UI dispatched
+ * between ticks (starting a game, loading a level, pausing) are pulled
+ * into the simulation first, and whatever the tick changed is pushed back
+ * in a single action.
+ */
+
+import {
+  configureStore,
+  createListenerMiddleware,
+  type UnknownAction
+} from '@reduxjs/toolkit'
+import {
+  gameReducer,
+  syncGameState,
+  withGameSync,
+  type GameRootState
+} from '@core/game'
+import { createSyncThunkMiddleware } from '@lib/redux'
+import { setupGameSoundListener } from './soundListenerMiddleware'
+import { extractGameState, type GameServices, type GameStore } from './store'
+
+// eslint-disable-next-line @typescript-eslint/explicit-function-return-type
+const createStoreAndListeners = (services: GameServices) => {
+  const soundListenerMiddleware = createListenerMiddleware()
+  const syncThunkMiddleware = createSyncThunkMiddleware<
+    GameRootState,
+    GameServices
+  >()
+
+  const store = configureStore({
+    reducer: withGameSync(gameReducer),
+    middleware: getDefaultMiddleware =>
+      getDefaultMiddleware({
+        thunk: {
+          extraArgument: services
+        },
+        serializableCheck: {
+          ignoredActionPaths: ['meta.payloadCreator', 'meta.result']
+        }
+      })
+        .prepend(soundListenerMiddleware.middleware)
+        .prepend(syncThunkMiddleware(services))
+  })
+
+  return { store, soundListenerMiddleware }
+}
+
+export type SimStore = ReturnType<typeof createStoreAndListeners>['store']
+
+export type SimDispatch = SimStore['dispatch']
+
+export const createSimStore = (services: GameServices): SimStore => {
+  const { store, soundListenerMiddleware } = createStoreAndListeners(services)
+  setupGameSoundListener(
+    soundListenerMiddleware.startListening.withTypes<
+      GameRootState,
+      SimDispatch
+    >(),
+    services.soundService
+  )
+  return store
+}
+
+export type GameSync = {
+  /** Copy game slices the app store changed since the last sync */
+  pull: () => void
+  /** Copy game slices the simulation changed since the last sync */
+  push: () => void
+}
+
+/**
+ * The slices of `from` that are not the same objects as in `synced`
+ */
+const changedSlices = (
+  from: GameRootState,
+  synced: GameRootState | null
+): Partial<GameRootState> | null => {
+  if (!synced) {
+    return from
+  }
+  let changed: Partial<GameRootState> | null = null
+  for (const key of Object.keys(from) as (keyof GameRootState)[]) {
+    if (from[key] !== synced[key]) {
+      changed = { ...changed, [key]: from[key] }
+    }
+  }
+  return changed
+}
+
+export const createGameSync = (
+  appStore: GameStore,
+  simStore: SimStore
+): GameSync => {
+  // Slices both stores held after the last sync
+  let synced: GameRootState | null = null
+
+  const sync = (
+    from: GameRootState,
+    to: { dispatch: (action: UnknownAction) => unknown }
+  ): void => {
+    const changed = changedSlices(from, synced)
+    if (changed) {
+      to.dispatch(syncGameState(changed))
+    }
+    synced = from
+  }
+
+  return {
+    pull: () => sync(extractGameState(appStore.getState()), simStore),
+    push: () => sync(simStore.getState(), appStore)
+  }
+}
@@ -2,22 +2,27 @@
  * Sound listener middleware using Redux Toolkit
  *
  * Processes sound state changes and triggers sound playback
- * through the sound service at appropriate times
+ * through the sound service at appropriate times. Game sounds listen on
+ * the simulation store, where the game actions are dispatched; settings,
+ * pause and replay sounds listen on the app store.
  */
 
 import type { GameSoundService } from './types'
 import { shotsSlice, isNewShot, bunkShootThunk } from '@/core/shots'
 import { SCRWTH, VIEWHT, SOFTBORDER } from '@/core/screen'
 import type { AppDispatch, RootState } from './store'
+import type { SimDispatch } from './simStore'
 import type { TypedStartListening } from '@reduxjs/toolkit'
 import { explosionsSlice } from '@/core/explosions'
 import { transitionSlice } from '@/core/transition'
 import { shipSlice } from '@/core/ship'
 import { appSlice } from './appSlice'
-import { gameSlice } from '@core/game'
+import { gameSlice, type GameRootState } from '@core/game'
 import { replaySlice } from './replaySlice'
 
 type SoundStartListening = TypedStartListening<RootState, AppDispatch>
+type GameSoundStartListening = TypedStartListening<GameRootState, SimDispatch>
+
 /**
  * Setup the sound listener with access to the sound service
  *
@@ -49,8 +54,73 @@ export function setupSoundListener(
     }
   })
 
-  // Listen for ship shot creation
+  // Stop continuous sounds while the game or a replay is paused
   soundStartListening({
+    predicate: (_, currentState) =>
+      currentState.game.paused || currentState.replay.replayPaused,
+    effect: () => {
+      soundService.stopShipShield()
+      soundService.stopShipThrust()
+    }
+  })
+
+  // Stop continuous sounds when replay pauses
+  soundStartListening({
+    actionCreator: replaySlice.actions.pauseReplay,
+    effect: () => {
+      soundService.stopShipThrust()
+      soundService.stopShipShield()
+    }
+  })
+
+  // Cleanup all sounds when replay stops
+  soundStartListening({
+    actionCreator: replaySlice.actions.stopReplay,
+    effect: () => {
+      soundService.cleanup()
+    }
+  })
+
+  // Sync sound settings and cleanup when mode changes
+  soundStartListening({
+    actionCreator: appSlice.actions.setMode,
+    effect: (action, listenerApi) => {
+      const prevState = listenerApi.getOriginalState()
+      const currentState = listenerApi.getState()
+      const currentMode = action.payload
+
+      // Cleanup when entering replay selection screen (ensures clean state between replays)
+      if (currentMode === 'replaySelection') {
+        soundService.cleanup()
+      }
+
+      // When entering replay mode, cleanup first then sync sound service with current app settings
+      if (currentMode === 'replay' && prevState.app.mode !== 'replay') {
+        soundService.cleanup()
+        soundService.setVolume(currentState.app.volume)
+        soundService.setMuted(!currentState.app.soundOn)
+      }
+
+      // If we were in replay mode and are now leaving it, cleanup sounds
+      if (prevState.app.mode === 'replay' && currentMode !== 'replay') {
+        soundService.cleanup()
+      }
+    }
+  })
+}
+
+/**
+ * Setup the listener for sounds triggered by game actions
+ *
+ * @param gameSoundStartListening - The typed startListening function from the simulation store's middleware
+ * @param soundService - The sound service instance to use for playback
+ */
+export function setupGameSoundListener(
+  gameSoundStartListening: GameSoundStartListening,
+  soundService: GameSoundService
+): void {
+  // Listen for ship shot creation
+  gameSoundStartListening({
     actionCreator: shotsSlice.actions.initShipshot,
     effect: (_, listenerApi) => {
       // Get the state before and after the action
@@ -71,7 +141,7 @@ export function setupSoundListener(
   })
 
   // Listen for bunker shot creation
-  soundStartListening({
+  gameSoundStartListening({
     matcher: bunkShootThunk.match,
     effect: (_, listenerApi) => {
       // Get the state before and after the action
@@ -125,7 +195,7 @@ export function setupSoundListener(
   })
 
   // Listen for shield state - continuous sound that needs to keep playing
-  soundStartListening({
+  gameSoundStartListening({
     predicate: (_, currentState) => currentState.ship.shielding,
     effect: () => {
       // Keep trying to play shield sound while shielding is active
@@ -135,18 +205,16 @@ export function setupSoundListener(
     }
   })
 
-  soundStartListening({
+  gameSoundStartListening({
     predicate: (_, currentState) =>
-      currentState.game.paused ||
-      currentState.replay.replayPaused ||
-      !currentState.ship.shielding,
+      currentState.game.paused || !currentState.ship.shielding,
     effect: () => {
       soundService.stopShipShield()
     }
   })
 
   // Listen for thrust state - continuous sound that needs to keep playing
-  soundStartListening({
+  gameSoundStartListening({
     predicate: (_, currentState) => currentState.ship.thrusting,
     effect: () => {
       // Keep trying to play thrust sound while thrusting is active
@@ -155,18 +223,16 @@ export function setupSoundListener(
       soundService.playShipThrust()
     }
   })
-  soundStartListening({
+  gameSoundStartListening({
     predicate: (_, currentState) =>
-      currentState.game.paused ||
-      currentState.replay.replayPaused ||
-      !currentState.ship.thrusting,
+      currentState.game.paused || !currentState.ship.thrusting,
     effect: () => {
       soundService.stopShipThrust()
     }
   })
 
   // Listen for ship death
-  soundStartListening({
+  gameSoundStartListening({
     actionCreator: explosionsSlice.actions.startShipDeathWithRandom,
     effect: () => {
       soundService.playShipExplosion()
@@ -174,7 +240,7 @@ export function setupSoundListener(
   })
 
   // Listen for bunker explosion
-  soundStartListening({
+  gameSoundStartListening({
     actionCreator: explosionsSlice.actions.startExplosionWithRandom,
     effect: () => {
       soundService.playBunkerExplosion()
@@ -182,7 +248,7 @@ export function setupSoundListener(
   })
 
   // Listen for fuel collection
-  soundStartListening({
+  gameSoundStartListening({
     actionCreator: shipSlice.actions.collectFuel,
     effect: () => {
       // this is for the modern service to ensure that
@@ -194,7 +260,7 @@ export function setupSoundListener(
   })
 
   // Listen for starmap transition
-  soundStartListening({
+  gameSoundStartListening({
     actionCreator: transitionSlice.actions.decrementPreFizz,
     effect: (_, listenerApi) => {
       if (listenerApi.getState().transition.preFizzFrames === 0) {
@@ -204,7 +270,7 @@ export function setupSoundListener(
   })
 
   // Listen for starmap transition
-  soundStartListening({
+  gameSoundStartListening({
     actionCreator: transitionSlice.actions.transitionToStarmap,
     effect: () => {
       soundService.playEcho()
@@ -212,54 +278,10 @@ export function setupSoundListener(
   })
 
   // Handle cleanup on game over
-  soundStartListening({
+  gameSoundStartListening({
     actionCreator: gameSlice.actions.triggerGameOver,
     effect: () => {
       soundService.cleanup()
     }
   })
-
-  // Stop continuous sounds when replay pauses
-  soundStartListening({
-    actionCreator: replaySlice.actions.pauseReplay,
-    effect: () => {
-      soundService.stopShipThrust()
-      soundService.stopShipShield()
-    }
-  })
-
-  // Cleanup all sounds when replay stops
-  soundStartListening({
-    actionCreator: replaySlice.actions.stopReplay,
-    effect: () => {
-      soundService.cleanup()
-    }
-  })
-
-  // Sync sound settings and cleanup when mode changes
-  soundStartListening({
-    actionCreator: appSlice.actions.setMode,
-    effect: (action, listenerApi) => {
-      const prevState = listenerApi.getOriginalState()
-      const currentState = listenerApi.getState()
-      const currentMode = action.payload
-
-      // Cleanup when entering replay selection screen (ensures clean state between replays)
-      if (currentMode === 'replaySelection') {
-        soundService.cleanup()
-      }
-
-      // When entering replay mode, cleanup first then sync sound service with current app settings
-      if (currentMode === 'replay' && prevState.app.mode !== 'replay') {
-        soundService.cleanup()
-        soundService.setVolume(currentState.app.volume)
-        soundService.setMuted(!currentState.app.soundOn)
-      }
-
-      // If we were in replay mode and are now leaving it, cleanup sounds
-      if (prevState.app.mode === 'replay' && currentMode !== 'replay') {
-        soundService.cleanup()
-      }
-    }
-  })
 }
@@ -0,0 +1,139 @@
+/**
+ * @fileoverview Static screens converted once and kept as ImageBitmaps
+ *
+ * A static screen is a monochrome bitmap that never changes while it is
+ * shown, such as the title page. Each one is expanded to RGBA through the
+ * shared lookup table at the display scale, pixel-replicated rather than
+ * resampled, and uploaded as an ImageBitmap. Presenting it again at the
+ * same scale is a single drawImage with no conversion or allocation.
+ */
+
+import {
+  blitToPixels,
+  createPixelTable,
+  imageDataPixels,
+  type MonochromeBitmap
+} from '@lib/bitmap'
+
+export type StaticScreen = {
+  bitmap: MonochromeBitmap
+  /** Visible area, from the top-left corner of the bitmap */
+  width: number
+  height: number
+}
+
+type Entry = {
+  bitmap: MonochromeBitmap
+  image: ImageBitmap | null
+  pending: Promise<ImageBitmap>
+}
+
+const table = createPixelTable()
+const entries = new Map<string, Entry>()
+
+const noop = (): void => {}
+
+const keyFor = (id: string, scale: number): string => `${id}@${scale}`
+
+const convert = (
+  screen: StaticScreen,
+  scale: number
+): Promise<ImageBitmap> => {
+  const width = screen.width * scale
+  const height = screen.height * scale
+  const imageData = new ImageData(width, height)
+  blitToPixels(
+    screen.bitmap,
+    imageDataPixels(imageData),
+    table,
+    screen.width,
+    screen.height,
+    scale
+  )
+  return createImageBitmap(imageData)
+}
+
+/** Forget every scale of a screen and release its bitmaps */
+const evict = (id: string): void => {
+  for (const [key, entry] of entries) {
+    if (key.startsWith(`${id}@`)) {
+      entry.image?.close()
+      entries.delete(key)
+    }
+  }
+}
+
+/**
+ * Start converting a screen at a scale, or get the conversion in flight
+ *
+ * Screens are identified by `id`; passing a different bitmap under the
+ * same id drops every cached scale of the old one.
+ */
+export const loadStaticScreen = (
+  id: string,
+  screen: StaticScreen,
+  scale: number
+): Promise<ImageBitmap> => {
+  const key = keyFor(id, scale)
+  const existing = entries.get(key)
+  if (existing?.bitmap === screen.bitmap) {
+    return existing.pending
+  }
+  if (existing) {
+    evict(id)
+  }
+
+  const entry: Entry = {
+    bitmap: screen.bitmap,
+    image: null,
+    pending: convert(screen, scale).then(image => {
+      entry.image = image
+      return image
+    })
+  }
+  entries.set(key, entry)
+  return entry.pending
+}
+
+/** The converted screen, if it is ready at this scale */
+export const getStaticScreen = (
+  id: string,
+  bitmap: MonochromeBitmap,
+  scale: number
+): ImageBitmap | null => {
+  const entry = entries.get(keyFor(id, scale))
+  return entry?.bitmap === bitmap ? entry.image : null
+}
+
+/**
+ * Draw a static screen at the top-left of a canvas sized for it
+ *
+ * Draws at once when the screen is ready, otherwise once its conversion
+ * finishes unless the returned cancel function has been called.
+ */
+export const presentStaticScreen = (
+  ctx: CanvasRenderingContext2D,
+  id: string,
+  screen: StaticScreen,
+  scale: number
+): (() => void) => {
+  const ready = getStaticScreen(id, screen.bitmap, scale)
+  if (ready) {
+    ctx.drawImage(ready, 0, 0)
+    return noop
+  }
+
+  let cancelled = false
+  void loadStaticScreen(id, screen, scale)
+    .then(image => {
+      if (!cancelled) {
+        ctx.drawImage(image, 0, 0)
+      }
+    })
+    .catch((error: unknown) => {
+      console.error(`Failed to prepare screen ${id}:`, error)
+    })
+  return (): void => {
+    cancelled = true
+  }
+}
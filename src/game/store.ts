@@ -14,7 +14,7 @@ import type { GameSoundService } from './types'
 import type { RandomService } from '@/core/shared'
 
 // Import all reducers
-import { gameSlice, type GameRootState } from '@core/game'
+import { gameSlice, withGameSync, type GameRootState } from '@core/game'
 import { appSlice } from './appSlice'
 import { replaySlice } from './replaySlice'
 import { appMiddleware, loadAppSettings } from './appMiddleware'
@@ -64,20 +64,23 @@ export type GameInitialSettings = {
   initialLives: number
 }
 
-const rootReducer = combineSlices(
-  appSlice,
-  gameSlice,
-  replaySlice,
-  controlsSlice,
-  shipSlice,
-  shotsSlice,
-  planetSlice,
-  screenSlice,
-  statusSlice,
-  explosionsSlice,
-  wallsSlice,
-  highscoreSlice,
-  transitionSlice
+// Game logic slices here mirror the simulation store (see simStore)
+const rootReducer = withGameSync(
+  combineSlices(
+    appSlice,
+    gameSlice,
+    replaySlice,
+    controlsSlice,
+    shipSlice,
+    shotsSlice,
+    planetSlice,
+    screenSlice,
+    statusSlice,
+    explosionsSlice,
+    wallsSlice,
+    highscoreSlice,
+    transitionSlice
+  )
 )
 
 export type RootReducer = typeof rootReducer
@@ -148,7 +151,13 @@ const createStoreAndListeners = (
         appSlice.getInitialState().renderMode,
       solidBackground:
         persistedAppSettings.solidBackground ??
-        appSlice.getInitialState().solidBackground
+        appSlice.getInitialState().solidBackground,
+      scrollTerrain:
+        persistedAppSettings.scrollTerrain ??
+        appSlice.getInitialState().scrollTerrain,
+      autoQuality:
+        persistedAppSettings.autoQuality ??
+        appSlice.getInitialState().autoQuality
     },
     highscore: persistedHighScores,
     controls: {
@@ -2,14 +2,25 @@ import type { ControlMatrix } from '@/core/controls'
 import type { FrameInfo, MonochromeBitmap } from '@/lib/bitmap'
 import type { Frame } from '@/lib/frame/types'
 
+export type RenderLoopOptions = {
+  /**
+   * The caller will not present this tick (catch-up scheduling), so the
+   * loop may skip drawing when that cannot change the simulation. The
+   * returned image is not meaningful in that case.
+   */
+  skipRender?: boolean
+}
+
 export type GameRenderLoop = (
   frame: FrameInfo,
-  controls: ControlMatrix
+  controls: ControlMatrix,
+  options?: RenderLoopOptions
 ) => MonochromeBitmap
 
 export type NewGameRenderLoop = (
   frame: FrameInfo,
-  controls: ControlMatrix
+  controls: ControlMatrix,
+  options?: RenderLoopOptions
 ) => Frame
 
 /**
@@ -48,7 +59,14 @@ export type GameSoundService = {
   playLevelTransition(): void
   playEcho(): void
 
+  // Seed the noise of sounds played this frame (see randomStreams)
+  seedFrame(gameSeed: number, frame: number): void
+
   // Lifecycle
   startEngine(): Promise<void> // Pre-start audio engine to eliminate first-sound delay
   cleanup(): void
+
+  // Quality governor hooks (only the modern mixer provides these)
+  setChannelLimit?(limit: number): void
+  getUnderrunCount?(): number
 }
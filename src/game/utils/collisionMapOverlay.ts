@@ -1,5 +1,5 @@
-import { bitmapToCollisionItem } from '@/core/collision'
-import type { CollisionMap } from '@/core/collision/types'
+import { bitmapToCollisionItem, sameCollisionOwner } from '@/core/collision'
+import type { CollisionMap, CollisionService } from '@/core/collision/types'
 import { Collision } from '@/core/collision/constants'
 import { SBARHT } from '@/core/screen'
 import { SCENTER } from '@/core/figs'
@@ -11,6 +11,8 @@ import type { ShipState } from '@/core/ship/types'
  * - Red overlay: LETHAL collision areas
  * - Green overlay: BOUNCE collision areas
  * - Blue overlay: Ship collision mask
+ * - Yellow overlay: the wall, bunker or shot the ship is touching, when the
+ *   map has an identity plane
  */
 export function applyCollisionMapOverlay(
   pixels: Uint8ClampedArray,
@@ -18,7 +20,8 @@ export function applyCollisionMapOverlay(
   ship: ShipState,
   spriteService: SpriteService,
   width: number,
-  height: number
+  height: number,
+  identity?: Pick<CollisionService, 'getOwner' | 'checkItemOwner'>
 ): void {
   // Get ship collision item
   const shipBitmap = spriteService.getShipSprite(ship.shiprot, {
@@ -30,6 +33,7 @@ export function applyCollisionMapOverlay(
     ship.shipx - SCENTER,
     ship.shipy - SCENTER
   )
+  const hit = identity?.checkItemOwner(shipItem) ?? null
 
   // Overlay collision map colors
   for (let y = 0; y < height; y++) {
@@ -40,7 +44,24 @@ export function applyCollisionMapOverlay(
       // NB: collision map doesn't include status bar
       const collision = collisionMap[x]?.[y - SBARHT] ?? 0
 
-      if (collision === Collision.LETHAL) {
+      const isHitPixel =
+        hit !== null &&
+        collision !== Collision.NONE &&
+        sameCollisionOwner(identity!.getOwner({ x, y: y - SBARHT }), hit)
+
+      if (isHitPixel) {
+        // Blend yellow transparently on top
+        const alpha = 0.5 // 50% transparency
+        pixels[pixelIndex] = Math.round(
+          pixels[pixelIndex]! * (1 - alpha) + 255 * alpha
+        ) // R
+        pixels[pixelIndex + 1] = Math.round(
+          pixels[pixelIndex + 1]! * (1 - alpha) + 255 * alpha
+        ) // G
+        pixels[pixelIndex + 2] = Math.round(
+          pixels[pixelIndex + 2]! * (1 - alpha) + 0 * alpha
+        ) // B
+      } else if (collision === Collision.LETHAL) {
         // Blend red transparently on top
         const alpha = 0.5 // 50% transparency
         pixels[pixelIndex] = Math.round(
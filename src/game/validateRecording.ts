@@ -6,23 +6,29 @@
 import type { GameRecording } from '@core/recording'
 import type { ValidationReport } from '@core/validation'
 import {
+  checkPlausibility,
   createHeadlessStore,
   createHeadlessGameEngine,
-  createRecordingValidator
+  createRecordingValidator,
+  createValidationCacheIndexedDB,
+  hashState,
+  implausibleReport,
+  validateCached
 } from '@core/validation'
 import type { GameServices } from './store'
 
-/**
- * Validate a recording in the browser using the headless validator
- *
- * @param recording - The recording to validate
- * @param services - Game services from the main store
- * @returns Validation report with success status and any errors
- */
-export const validateRecording = (
+const validationCache = createValidationCacheIndexedDB()
+
+// Pre-filter, then simulate the whole recording
+const simulate = (
   recording: GameRecording,
   services: GameServices
-): ValidationReport => {
+): { report: ValidationReport; finalStateHash: string | null } => {
+  const plausibility = checkPlausibility(recording, services.galaxyService)
+  if (!plausibility.plausible) {
+    return { report: implausibleReport(plausibility), finalStateHash: null }
+  }
+
   // Extract headless-compatible services (no fizzTransitionService needed)
   const headlessServices = {
     galaxyService: services.galaxyService,
@@ -54,5 +60,35 @@ export const validateRecording = (
   )
 
   // Run validation
-  return validator.validate(recording)
+  const report = validator.validate(recording)
+  const finalState = headlessEngine.getFinalState() ?? headlessStore.getState()
+  return { report, finalStateHash: hashState(finalState) }
+}
+
+/**
+ * Validate a recording in the browser using the headless validator
+ *
+ * Results are cached by recording, galaxy and engine version, so a
+ * recording already validated is not simulated again. Recordings that are
+ * impossible on their face are rejected by the plausibility pre-filter
+ * without being simulated.
+ *
+ * @param recording - The recording to validate
+ * @param services - Game services from the main store
+ * @returns Validation report with success status and any errors
+ */
+export const validateRecording = async (
+  recording: GameRecording,
+  services: GameServices
+): Promise<ValidationReport> => {
+  const { report, cached } = await validateCached(
+    recording,
+    services.galaxyService,
+    validationCache,
+    () => simulate(recording, services)
+  )
+  if (cached) {
+    console.log('Validation result from cache')
+  }
+  return report
 }
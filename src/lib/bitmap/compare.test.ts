@@ -0,0 +1,126 @@
+import { describe, it, expect } from 'vitest'
+import {
+  countDiffPixels,
+  diffBitmaps,
+  hashBitmap,
+  popcount32
+} from './compare'
+import { createMonochromeBitmap, cloneBitmap } from './create'
+import { getPixel, setPixel } from './operations'
+import type { MonochromeBitmap } from './types'
+
+// Reference implementation over individual pixels
+const slowDiffCount = (a: MonochromeBitmap, b: MonochromeBitmap): number => {
+  let count = 0
+  for (let y = 0; y < a.height; y++) {
+    for (let x = 0; x < a.width; x++) {
+      if (getPixel(a, x, y) !== getPixel(b, x, y)) count++
+    }
+  }
+  return count
+}
+
+describe('popcount32', () => {
+  it('counts bits', () => {
+    expect(popcount32(0)).toBe(0)
+    expect(popcount32(0xffffffff)).toBe(32)
+    expect(popcount32(0x80000001)).toBe(2)
+    expect(popcount32(0x55555555)).toBe(16)
+  })
+})
+
+describe('hashBitmap', () => {
+  it('is equal for equal contents and changes with one pixel', () => {
+    const a = createMonochromeBitmap(512, 342)
+    const b = cloneBitmap(a)
+    expect(hashBitmap(a)).toBe(hashBitmap(b))
+
+    setPixel(b, 511, 341)
+    expect(hashBitmap(a)).not.toBe(hashBitmap(b))
+  })
+
+  it('hashes a row range independently of other rows', () => {
+    const a = createMonochromeBitmap(64, 10)
+    const b = cloneBitmap(a)
+    setPixel(b, 3, 8)
+
+    expect(hashBitmap(a, 0, 8)).toBe(hashBitmap(b, 0, 8))
+    expect(hashBitmap(a, 0, 9)).not.toBe(hashBitmap(b, 0, 9))
+  })
+
+  it('hashes the same pixels alike wherever they sit in memory', () => {
+    const a = createMonochromeBitmap(64, 10)
+    for (let i = 0; i < 50; i++) {
+      setPixel(a, (i * 37) % 64, (i * 7) % 10)
+    }
+    // The same bytes one past a word boundary
+    const bytes = new Uint8Array(a.data.length + 1)
+    bytes.set(a.data, 1)
+    const unaligned: MonochromeBitmap = { ...a, data: bytes.subarray(1) }
+
+    expect(unaligned.data.byteOffset % 4).not.toBe(0)
+    expect(hashBitmap(unaligned)).toBe(hashBitmap(a))
+    expect(hashBitmap(unaligned, 2, 7)).toBe(hashBitmap(a, 2, 7))
+  })
+
+  it('handles bitmaps that are not word aligned', () => {
+    const a = createMonochromeBitmap(13, 5)
+    const b = cloneBitmap(a)
+    setPixel(b, 12, 4)
+    expect(hashBitmap(a)).not.toBe(hashBitmap(b))
+  })
+})
+
+describe('countDiffPixels', () => {
+  it('matches a per-pixel count', () => {
+    const a = createMonochromeBitmap(512, 342)
+    const b = cloneBitmap(a)
+    for (let i = 0; i < 200; i++) {
+      setPixel(b, (i * 37) % 512, (i * 13) % 342)
+    }
+    expect(countDiffPixels(a, b)).toBe(slowDiffCount(a, b))
+  })
+
+  it('rejects bitmaps of different sizes', () => {
+    const a = createMonochromeBitmap(32, 4)
+    const b = createMonochromeBitmap(32, 5)
+    expect(() => countDiffPixels(a, b)).toThrow()
+  })
+})
+
+describe('diffBitmaps', () => {
+  it('reports no change for equal bitmaps', () => {
+    const a = createMonochromeBitmap(64, 8)
+    expect(diffBitmaps(a, cloneBitmap(a))).toEqual({
+      rows: [],
+      bounds: null,
+      changedPixels: 0
+    })
+  })
+
+  it('finds row spans and a pixel-exact bounding box', () => {
+    const a = createMonochromeBitmap(512, 342)
+    const b = cloneBitmap(a)
+    setPixel(b, 10, 5)
+    setPixel(b, 300, 6)
+    setPixel(b, 42, 100)
+
+    const diff = diffBitmaps(a, b)
+    expect(diff.rows).toEqual([
+      { start: 5, end: 7 },
+      { start: 100, end: 101 }
+    ])
+    expect(diff.bounds).toEqual({ x: 10, y: 5, width: 291, height: 96 })
+    expect(diff.changedPixels).toBe(3)
+  })
+
+  it('works on bitmaps that are not word aligned', () => {
+    const a = createMonochromeBitmap(13, 5)
+    const b = cloneBitmap(a)
+    setPixel(b, 12, 2)
+
+    const diff = diffBitmaps(a, b)
+    expect(diff.rows).toEqual([{ start: 2, end: 3 }])
+    expect(diff.bounds).toEqual({ x: 12, y: 2, width: 1, height: 1 })
+  })
+})
@@ -0,0 +1,206 @@
+/**
+ * Word-wise bitmap comparison kernels
+ *
+ * Hashing, diffing and pixel counting over 32-bit words instead of
+ * individual pixels. Game framebuffers are 64 bytes per row, so a whole
+ * row is 16 word operations.
+ *
+ * Hashes are taken over little-endian 32-bit words, whatever the
+ * platform's byte order and wherever the data sits in its buffer, so a
+ * hash can be stored (golden frames keep them) and compared later. They
+ * are only comparable to other hashes from these kernels.
+ */
+
+import type { MonochromeBitmap, Rectangle } from './types'
+
+/**
+ * A run of consecutive rows containing at least one changed pixel
+ */
+export type RowSpan = {
+  /** First changed row */
+  start: number
+  /** One past the last changed row */
+  end: number
+}
+
+/**
+ * Result of comparing two bitmaps
+ */
+export type BitmapDiff = {
+  /** Changed row runs, top to bottom */
+  rows: RowSpan[]
+  /** Smallest rectangle containing every changed pixel, null if equal */
+  bounds: Rectangle | null
+  /** Number of differing pixels */
+  changedPixels: number
+}
+
+/**
+ * Count set bits in a 32-bit value
+ */
+export const popcount32 = (value: number): number => {
+  let v = value - ((value >>> 1) & 0x55555555)
+  v = (v & 0x33333333) + ((v >>> 2) & 0x33333333)
+  return (Math.imul((v + (v >>> 4)) & 0x0f0f0f0f, 0x01010101) >>> 24) >>> 0
+}
+
+const LITTLE_ENDIAN = new Uint8Array(new Uint32Array([1]).buffer)[0] === 1
+
+/**
+ * 32-bit view of a bitmap's data, or null if it is not word aligned
+ */
+const wordView = (bitmap: MonochromeBitmap): Uint32Array | null => {
+  const { data, rowBytes } = bitmap
+  if (rowBytes % 4 !== 0 || data.byteOffset % 4 !== 0) {
+    return null
+  }
+  return new Uint32Array(data.buffer, data.byteOffset, data.length >>> 2)
+}
+
+const assertSameShape = (a: MonochromeBitmap, b: MonochromeBitmap): void => {
+  if (a.width !== b.width || a.height !== b.height) {
+    throw new Error(
+      `Bitmap size mismatch: ${a.width}x${a.height} vs ${b.width}x${b.height}`
+    )
+  }
+}
+
+/**
+ * Hash the contents of a bitmap, or of rows [startRow, endRow)
+ *
+ * @returns Unsigned 32-bit hash
+ */
+export const hashBitmap = (
+  bitmap: MonochromeBitmap,
+  startRow = 0,
+  endRow = bitmap.height
+): number => {
+  const first = Math.max(0, startRow)
+  const last = Math.min(bitmap.height, endRow)
+  let hash = 0x811c9dc5
+
+  // Aligned data on a little-endian platform is read a word at a time;
+  // anything else assembles the same little-endian words from bytes
+  const words = LITTLE_ENDIAN ? wordView(bitmap) : null
+  if (words) {
+    const rowWords = bitmap.rowBytes >>> 2
+    for (let i = first * rowWords; i < last * rowWords; i++) {
+      hash = Math.imul(hash ^ words[i]!, 0x01000193)
+      hash ^= hash >>> 15
+    }
+  } else {
+    const { data, rowBytes } = bitmap
+    const end = last * rowBytes
+    for (let i = first * rowBytes; i < end; i += 4) {
+      // A short last word is padded with zero bytes
+      let word = 0
+      for (let byte = 0; byte < 4 && i + byte < end; byte++) {
+        word |= data[i + byte]! << (8 * byte)
+      }
+      hash = Math.imul(hash ^ word, 0x01000193)
+      hash ^= hash >>> 15
+    }
+  }
+
+  return hash >>> 0
+}
+
+/**
+ * Count pixels that differ between two same-sized bitmaps
+ */
+export const countDiffPixels = (
+  a: MonochromeBitmap,
+  b: MonochromeBitmap
+): number => {
+  assertSameShape(a, b)
+  let count = 0
+
+  const wordsA = wordView(a)
+  const wordsB = wordView(b)
+  if (wordsA && wordsB) {
+    for (let i = 0; i < wordsA.length; i++) {
+      const diff = wordsA[i]! ^ wordsB[i]!
+      if (diff !== 0) count += popcount32(diff)
+    }
+  } else {
+    for (let i = 0; i < a.data.length; i++) {
+      const diff = a.data[i]! ^ b.data[i]!
+      if (diff !== 0) count += popcount32(diff)
+    }
+  }
+
+  return count
+}
+
+/**
+ * XOR two same-sized bitmaps and describe where they differ
+ *
+ * Unchanged rows cost one word compare per 32 pixels. Only changed bytes
+ * are examined bit by bit to find the horizontal bounds.
+ */
+export const diffBitmaps = (
+  a: MonochromeBitmap,
+  b: MonochromeBitmap
+): BitmapDiff => {
+  assertSameShape(a, b)
+  const { rowBytes, height } = a
+  const rows: RowSpan[] = []
+  let changedPixels = 0
+  let minX = Infinity
+  let maxX = -1
+
+  const wordsA = wordView(a)
+  const wordsB = wordView(b)
+  const rowWords = rowBytes >>> 2
+
+  for (let y = 0; y < height; y++) {
+    let rowChanged = false
+
+    if (wordsA && wordsB) {
+      for (let w = y * rowWords; w < (y + 1) * rowWords; w++) {
+        if (wordsA[w] !== wordsB[w]) {
+          rowChanged = true
+          break
+        }
+      }
+    } else {
+      rowChanged = true // Let the byte scan below decide
+    }
+    if (!rowChanged) continue
+
+    rowChanged = false
+    for (let x = 0; x < rowBytes; x++) {
+      const i = y * rowBytes + x
+      const diff = a.data[i]! ^ b.data[i]!
+      if (diff === 0) continue
+
+      rowChanged = true
+      changedPixels += popcount32(diff)
+      // Leftmost pixel is the most significant bit of the byte
+      minX = Math.min(minX, x * 8 + Math.clz32(diff) - 24)
+      maxX = Math.max(maxX, x * 8 + Math.clz32(diff & -diff) - 24)
+    }
+    if (!rowChanged) continue
+
+    const last = rows[rows.length - 1]
+    if (last && last.end === y) {
+      last.end = y + 1
+    } else {
+      rows.push({ start: y, end: y + 1 })
+    }
+  }
+
+  const first = rows[0]
+  const final = rows[rows.length - 1]
+  const bounds =
+    first && final
+      ? {
+          x: minX,
+          y: first.start,
+          width: maxX - minX + 1,
+          height: final.end - first.start
+        }
+      : null
+
+  return { rows, bounds, changedPixels }
+}
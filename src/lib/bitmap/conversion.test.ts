@@ -0,0 +1,110 @@
+import { describe, it, expect } from 'vitest'
+import {
+  blitRegionToPixels,
+  blitRowsToPixels,
+  blitToPixels,
+  createPixelTable
+} from './conversion'
+import { diffBitmaps } from './compare'
+import { cloneBitmap, createMonochromeBitmap } from './create'
+import { getPixel, setPixel } from './operations'
+
+const table = createPixelTable({
+  foregroundColor: '#102030',
+  backgroundColor: '#f0e0d0'
+})
+const [background, foreground] = new Uint32Array(
+  new Uint8Array([0xf0, 0xe0, 0xd0, 255, 0x10, 0x20, 0x30, 255]).buffer
+)
+
+describe('blitToPixels', () => {
+  const bitmap = createMonochromeBitmap(24, 5)
+  for (let i = 0; i < 40; i++) {
+    setPixel(bitmap, (i * 7) % 24, (i * 3) % 5)
+  }
+
+  it('matches the bitmap pixel for pixel, scaled and cropped', () => {
+    for (const [width, height, scale] of [
+      [24, 5, 1],
+      [21, 4, 1],
+      [21, 4, 3]
+    ] as const) {
+      const pixels = new Uint32Array(width * scale * height * scale)
+      blitToPixels(bitmap, pixels, table, width, height, scale)
+
+      for (let y = 0; y < height * scale; y++) {
+        for (let x = 0; x < width * scale; x++) {
+          const set = getPixel(
+            bitmap,
+            Math.floor(x / scale),
+            Math.floor(y / scale)
+          )
+          expect(pixels[y * width * scale + x]).toBe(
+            set ? foreground : background
+          )
+        }
+      }
+    }
+  })
+})
+
+describe('blitRegionToPixels', () => {
+  const bitmap = createMonochromeBitmap(40, 9)
+  for (let i = 0; i < 90; i++) {
+    setPixel(bitmap, (i * 13) % 40, (i * 5) % 9)
+  }
+
+  it('matches the bitmap inside regions at any bit offset', () => {
+    for (const [x, y, width, height, scale] of [
+      [8, 1, 16, 5, 1],
+      [3, 2, 21, 6, 1],
+      [13, 0, 27, 9, 2],
+      [7, 4, 1, 3, 3]
+    ] as const) {
+      const outWidth = width * scale
+      const pixels = new Uint32Array(outWidth * height * scale)
+      blitRegionToPixels(bitmap, pixels, { x, y, width, height }, table, scale)
+
+      for (let py = 0; py < height * scale; py++) {
+        for (let px = 0; px < outWidth; px++) {
+          const set = getPixel(
+            bitmap,
+            x + Math.floor(px / scale),
+            y + Math.floor(py / scale)
+          )
+          expect(pixels[py * outWidth + px]).toBe(set ? foreground : background)
+        }
+      }
+    }
+  })
+})
+
+describe('blitRowsToPixels', () => {
+  it('brings a previous frame up to date from the changed rows', () => {
+    const previous = createMonochromeBitmap(32, 12)
+    for (let i = 0; i < 30; i++) {
+      setPixel(previous, (i * 11) % 32, i % 12)
+    }
+    const next = cloneBitmap(previous)
+    setPixel(next, 5, 2)
+    setPixel(next, 30, 3)
+    setPixel(next, 17, 9)
+
+    for (const scale of [1, 2]) {
+      const size = 32 * scale * 12 * scale
+      const pixels = new Uint32Array(size)
+      blitToPixels(previous, pixels, table, 32, 12, scale)
+      blitRowsToPixels(
+        next,
+        pixels,
+        diffBitmaps(previous, next).rows,
+        table,
+        scale
+      )
+
+      const expected = new Uint32Array(size)
+      blitToPixels(next, expected, table, 32, 12, scale)
+      expect(pixels).toEqual(expected)
+    }
+  })
+})
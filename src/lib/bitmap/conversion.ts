@@ -1,45 +1,213 @@
 /**
  * Bitmap to canvas conversion functions
+ *
+ * Every 1-bit to RGBA conversion goes through a byte lookup table: each
+ * source byte selects its 8 pixels, already packed as Uint32s in the
+ * chosen palette, so a row is a run of 8-pixel copies rather than a
+ * per-bit test and four byte stores per pixel.
  */
 
-import type { MonochromeBitmap, BitmapToCanvasOptions } from './types'
+import type {
+  MonochromeBitmap,
+  BitmapToCanvasOptions,
+  Rectangle
+} from './types'
+import type { RowSpan } from './compare'
 import { createBitmapFromCanvas } from './create'
 
 /**
- * Convert monochrome bitmap to ImageData
+ * Lookup table from a bitmap byte to its 8 pixels
+ *
+ * Entry `byte * 8 + i` is pixel i (leftmost first) of that byte, packed
+ * as a Uint32 in the platform's byte order so it can be stored straight
+ * into a Uint32Array view of ImageData pixels.
  */
-export const bitmapToImageData = (
-  bitmap: MonochromeBitmap,
+export const createPixelTable = (
   options: BitmapToCanvasOptions = {}
-): ImageData => {
+): Uint32Array => {
   const { foregroundColor = 'black', backgroundColor = 'white' } = options
-
-  // Parse colors to RGB
+  const packed = new Uint32Array(2)
+  const bytes = new Uint8Array(packed.buffer)
   const fg = parseColor(foregroundColor)
   const bg = parseColor(backgroundColor)
+  bytes.set([bg.r, bg.g, bg.b, 255, fg.r, fg.g, fg.b, 255])
+  const [background, foreground] = packed
 
-  // Create ImageData
-  const imageData = new ImageData(bitmap.width, bitmap.height)
-  const pixels = imageData.data
-
-  // Convert each pixel
-  for (let y = 0; y < bitmap.height; y++) {
-    for (let x = 0; x < bitmap.width; x++) {
-      const byteIndex = y * bitmap.rowBytes + Math.floor(x / 8)
-      const bitMask = 0x80 >> (x % 8)
-      const isSet =
-        byteIndex < bitmap.data.length &&
-        (bitmap.data[byteIndex]! & bitMask) !== 0
-
-      const pixelIndex = (y * bitmap.width + x) * 4
-      const color = isSet ? fg : bg
-
-      pixels[pixelIndex] = color.r
-      pixels[pixelIndex + 1] = color.g
-      pixels[pixelIndex + 2] = color.b
-      pixels[pixelIndex + 3] = 255 // Full opacity
+  const table = new Uint32Array(256 * 8)
+  for (let byte = 0; byte < 256; byte++) {
+    for (let i = 0; i < 8; i++) {
+      table[byte * 8 + i] = byte & (0x80 >> i) ? foreground! : background!
+    }
+  }
+  return table
+}
+
+// Black on white, built on first use
+let defaultTable: Uint32Array | null = null
+const getDefaultTable = (): Uint32Array => {
+  if (!defaultTable) {
+    defaultTable = createPixelTable()
+  }
+  return defaultTable
+}
+
+/**
+ * A Uint32 view of ImageData pixels, for the blitters below
+ */
+export const imageDataPixels = (imageData: ImageData): Uint32Array => {
+  const { buffer, byteOffset, length } = imageData.data
+  return new Uint32Array(buffer, byteOffset, length >> 2)
+}
+
+/**
+ * Expand rows `top` to `bottom` (exclusive) of a `width`-pixel-wide region
+ * starting at (`x`, `y`) into `pixels`, laid out as the whole region at
+ * `scale`
+ *
+ * Whole bytes go through the table eight pixels at a time; a region that
+ * starts mid-byte reads each byte from the two it straddles.
+ */
+const expandRows = (
+  bitmap: MonochromeBitmap,
+  pixels: Uint32Array,
+  table: Uint32Array,
+  x: number,
+  y: number,
+  width: number,
+  top: number,
+  bottom: number,
+  scale: number
+): void => {
+  const { data, rowBytes } = bitmap
+  const outWidth = width * scale
+  const wholeBytes = width >> 3
+  const shift = x & 7
+  const firstByte = x >> 3
+
+  const byteAt = (index: number): number => {
+    if (shift === 0) {
+      return data[index] ?? 0
+    }
+    const high = (data[index] ?? 0) << shift
+    const low = (data[index + 1] ?? 0) >> (8 - shift)
+    return (high | low) & 0xff
+  }
+
+  for (let r = top; r < bottom; r++) {
+    const row = (y + r) * rowBytes + firstByte
+    let out = r * scale * outWidth
+
+    if (scale === 1) {
+      // Eight plain stores per byte; subarray() copies cost more than
+      // the lookups they save
+      for (let b = 0; b < wholeBytes; b++) {
+        const entry = byteAt(row + b) << 3
+        pixels[out] = table[entry]!
+        pixels[out + 1] = table[entry + 1]!
+        pixels[out + 2] = table[entry + 2]!
+        pixels[out + 3] = table[entry + 3]!
+        pixels[out + 4] = table[entry + 4]!
+        pixels[out + 5] = table[entry + 5]!
+        pixels[out + 6] = table[entry + 6]!
+        pixels[out + 7] = table[entry + 7]!
+        out += 8
+      }
+    } else {
+      for (let b = 0; b < wholeBytes; b++) {
+        const entry = byteAt(row + b) << 3
+        for (let i = 0; i < 8; i++) {
+          const pixel = table[entry + i]!
+          for (let end = out + scale; out < end; out++) {
+            pixels[out] = pixel
+          }
+        }
+      }
+    }
+    const entry = byteAt(row + wholeBytes) << 3
+    for (let i = 0; i < (width & 7); i++) {
+      const pixel = table[entry + i]!
+      for (let end = out + scale; out < end; out++) {
+        pixels[out] = pixel
+      }
+    }
+
+    // The other rows of this pixel row are copies of the first
+    const first = r * scale * outWidth
+    for (let copy = 1; copy < scale; copy++) {
+      pixels.copyWithin(first + copy * outWidth, first, first + outWidth)
     }
   }
+}
+
+/**
+ * Expand the top-left `width` x `height` pixels of a bitmap into `pixels`,
+ * each one repeated `scale` times across and down
+ *
+ * `pixels` is row-major with `width * scale` entries per row. Bytes past
+ * the end of the bitmap data read as background.
+ */
+export const blitToPixels = (
+  bitmap: MonochromeBitmap,
+  pixels: Uint32Array,
+  table: Uint32Array = getDefaultTable(),
+  width: number = bitmap.width,
+  height: number = bitmap.height,
+  scale: number = 1
+): void => {
+  expandRows(bitmap, pixels, table, 0, 0, width, 0, height, scale)
+}
+
+/**
+ * Expand a rectangle of a bitmap into `pixels`, which holds just that
+ * rectangle at `scale` (`region.width * scale` entries per row)
+ *
+ * The rectangle may start at any pixel but must lie within the bitmap.
+ */
+export const blitRegionToPixels = (
+  bitmap: MonochromeBitmap,
+  pixels: Uint32Array,
+  region: Rectangle,
+  table: Uint32Array = getDefaultTable(),
+  scale: number = 1
+): void => {
+  const { x, y, width, height } = region
+  expandRows(bitmap, pixels, table, x, y, width, 0, height, scale)
+}
+
+/**
+ * Re-expand only the given rows of a full-bitmap blit
+ *
+ * `pixels` is laid out as for blitToPixels() over the whole bitmap and
+ * already holds an earlier frame; rows outside `rows` are left alone. Pass
+ * the row spans from diffBitmaps() against that frame.
+ */
+export const blitRowsToPixels = (
+  bitmap: MonochromeBitmap,
+  pixels: Uint32Array,
+  rows: readonly RowSpan[],
+  table: Uint32Array = getDefaultTable(),
+  scale: number = 1
+): void => {
+  for (const { start, end } of rows) {
+    expandRows(bitmap, pixels, table, 0, 0, bitmap.width, start, end, scale)
+  }
+}
+
+/**
+ * Convert monochrome bitmap to ImageData
+ */
+export const bitmapToImageData = (
+  bitmap: MonochromeBitmap,
+  options: BitmapToCanvasOptions = {}
+): ImageData => {
+  const table =
+    options.foregroundColor === undefined &&
+    options.backgroundColor === undefined
+      ? getDefaultTable()
+      : createPixelTable(options)
+
+  const imageData = new ImageData(bitmap.width, bitmap.height)
+  blitToPixels(bitmap, imageDataPixels(imageData), table)
 
   return imageData
 }
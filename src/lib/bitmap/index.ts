@@ -32,5 +32,22 @@ export {
   getPixel
 } from './operations'
 
+// Comparison
+export type { BitmapDiff, RowSpan } from './compare'
+export { hashBitmap, diffBitmaps, countDiffPixels, popcount32 } from './compare'
+
+// Captured drawing passes
+export type { BitmapLayer } from './layer'
+export { captureLayer, applyLayer } from './layer'
+
 // Conversion
-export { bitmapToImageData, bitmapToCanvas, canvasToBitmap } from './conversion'
+export {
+  createPixelTable,
+  imageDataPixels,
+  blitToPixels,
+  blitRegionToPixels,
+  blitRowsToPixels,
+  bitmapToImageData,
+  bitmapToCanvas,
+  canvasToBitmap
+} from './conversion'
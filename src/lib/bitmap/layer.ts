@@ -0,0 +1,89 @@
+/**
+ * @fileoverview Drawing passes captured as reusable screen layers
+ *
+ * Most drawing routines change each screen bit independently of its
+ * neighbours: they AND a mask in, OR a shape in or EOR a pattern in. Any
+ * sequence of those leaves a bit either kept, inverted, set or cleared,
+ * so the combined effect of such a pass on a screen b is exactly
+ *
+ *   (b & keep) ^ flip
+ *
+ * Running the pass once on an all-white and once on an all-black screen
+ * yields both planes. The layer can then be reapplied to later frames
+ * without drawing again. Routines that look at the pixels around them
+ * (shift_figure, for one) cannot be captured this way.
+ */
+
+import type { MonochromeBitmap } from './types'
+
+export type BitmapLayer = {
+  /** Screen bits the pass leaves in place (or inverts, with flip) */
+  keep: Uint8Array
+  /** Bits inverted after masking */
+  flip: Uint8Array
+  rowBytes: number
+  height: number
+}
+
+/**
+ * 32-bit view of a plane, or null if it is not word aligned
+ */
+const wordView = (data: Uint8Array): Uint32Array | null =>
+  data.byteOffset % 4 === 0 && data.length % 4 === 0
+    ? new Uint32Array(data.buffer, data.byteOffset, data.length >>> 2)
+    : null
+
+/**
+ * Capture the effect of a drawing pass on a screen shaped like `like`
+ */
+export const captureLayer = (
+  draw: (screen: MonochromeBitmap) => MonochromeBitmap,
+  like: MonochromeBitmap
+): BitmapLayer => {
+  const { width, height, rowBytes } = like
+  const blank = new Uint8Array(like.data.length)
+  const zero = draw({ data: blank, width, height, rowBytes }).data
+  const one = draw({
+    data: new Uint8Array(like.data.length).fill(0xff),
+    width,
+    height,
+    rowBytes
+  }).data
+
+  const keep = new Uint8Array(like.data.length)
+  for (let i = 0; i < keep.length; i++) {
+    keep[i] = zero[i]! ^ one[i]!
+  }
+  return { keep, flip: zero, rowBytes, height }
+}
+
+/**
+ * Apply a captured pass to a screen
+ * @returns A curried function that takes a screen and returns a new MonochromeBitmap
+ */
+export const applyLayer =
+  (layer: BitmapLayer) =>
+  (screen: MonochromeBitmap): MonochromeBitmap => {
+    const newScreen: MonochromeBitmap = {
+      data: new Uint8Array(screen.data),
+      width: screen.width,
+      height: screen.height,
+      rowBytes: screen.rowBytes
+    }
+
+    const data = wordView(newScreen.data)
+    const keep = wordView(layer.keep)
+    const flip = wordView(layer.flip)
+    if (data && keep && flip) {
+      for (let i = 0; i < data.length; i++) {
+        data[i] = (data[i]! & keep[i]!) ^ flip[i]!
+      }
+    } else {
+      const bytes = newScreen.data
+      for (let i = 0; i < bytes.length; i++) {
+        bytes[i] = (bytes[i]! & layer.keep[i]!) ^ layer.flip[i]!
+      }
+    }
+
+    return newScreen
+  }
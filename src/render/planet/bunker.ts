@@ -23,9 +23,11 @@ export function doBunks(deps: {
   scrnx: number
   scrny: number
   getSprite: (kind: BunkerKind, rotation: number) => BunkerSprite
+  /** Optional ascending bunker indices to consider (see getVisibleSet) */
+  visible?: readonly number[]
 }): (screen: MonochromeBitmap) => MonochromeBitmap {
   return screen => {
-    const { bunkrec, scrnx, scrny, getSprite } = deps
+    const { bunkrec, scrnx, scrny, getSprite, visible } = deps
 
     let newScreen = cloneBitmap(screen)
 
@@ -34,7 +36,9 @@ export function doBunks(deps: {
     const right = scrnx + SCRWTH + 48
 
     // Process each bunker
-    for (const bp of bunkrec) {
+    const count = visible ? visible.length : bunkrec.length
+    for (let n = 0; n < count; n++) {
+      const bp = bunkrec[visible ? visible[n]! : n]!
       // Check for end of bunker array (rot < 0 marks end)
       if (bp.rot < 0) break
 
@@ -23,6 +23,8 @@ export function drawCraters(deps: {
     background1: Uint8Array
     background2: Uint8Array
   }
+  /** Optional ascending crater indices to consider (see getVisibleSet) */
+  visible?: readonly number[]
 }): (screen: MonochromeBitmap) => MonochromeBitmap {
   return screen => {
     const {
@@ -32,7 +34,8 @@ export function drawCraters(deps: {
       scrny,
       worldwidth,
       on_right_side,
-      craterImages
+      craterImages,
+      visible
     } = deps
 
     let newScreen = screen
@@ -47,7 +50,10 @@ export function drawCraters(deps: {
     const end = Math.min(numcraters, craters.length)
 
     // Process each crater (Terrain.c:517-526)
-    for (let i = 0; i < end; i++) {
+    const count = visible ? visible.length : end
+    for (let n = 0; n < count; n++) {
+      const i = visible ? visible[n]! : n
+      if (i >= end) break
       const crat = craters[i]
 
       // Skip undefined or null elements
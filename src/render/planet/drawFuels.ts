@@ -4,7 +4,7 @@ import { FUELHT, FUELFRAMES } from '@core/figs'
 import type { Fuel } from '@core/planet'
 import { FUELCENTER } from '@core/planet'
 import { drawMedium } from './drawMedium'
-import { getAlignment } from '@core/shared'
+import { getAlignment, type RandomService } from '@core/shared'
 
 /**
  * From draw_fuels() in orig/Sources/Terrain.c at 293-313
@@ -30,9 +30,11 @@ export function drawFuels(deps: {
       }
     }
   }
+  /** Optional ascending fuel indices to consider (see getVisibleSet) */
+  visible?: readonly number[]
 }): (screen: MonochromeBitmap) => MonochromeBitmap {
   return screen => {
-    const { fuels, scrnx, scrny, fuelSprites } = deps
+    const { fuels, scrnx, scrny, fuelSprites, visible } = deps
 
     let newScreen = screen
 
@@ -41,7 +43,9 @@ export function drawFuels(deps: {
     const right = scrnx + (FUELCENTER + SCRWTH)
 
     // Process each fuel cell (Terrain.c:302-312)
-    for (const fp of fuels) {
+    const count = visible ? visible.length : fuels.length
+    for (let n = 0; n < count; n++) {
+      const fp = fuels[visible ? visible[n]! : n]
       // Skip undefined or null elements
       if (!fp) continue
 
@@ -104,18 +108,19 @@ export function drawFuels(deps: {
  * From do_fuels() in orig/Sources/Terrain.c at 267-290
  *
  * Updates fuel cell animations and draws them.
- * Includes random "flash" effect where one fuel cell per frame flashes bright.
+ * Includes random "flash" effect where one fuel cell per frame flashes bright,
+ * rolled from the render random stream.
  */
 export function doFuels(deps: {
   fuels: Fuel[]
-  rint: (max: number) => number
+  random: RandomService
   drawFuels: (screen: MonochromeBitmap) => MonochromeBitmap
 }): (screen: MonochromeBitmap) => MonochromeBitmap {
   return screen => {
-    const { fuels, rint, drawFuels } = deps
+    const { fuels, random, drawFuels } = deps
 
     // Random fuel to flash this frame (Terrain.c:272)
-    const flash = rint(fuels.length)
+    const flash = random.rnumber(fuels.length)
 
     // Update animations for all fuel cells (Terrain.c:274-286)
     for (let f = 0; f < fuels.length; f++) {
@@ -128,7 +133,7 @@ export function doFuels(deps: {
       if (fp.alive) {
         if (f === flash) {
           // Flash effect - set to one of last two frames (Terrain.c:277-280)
-          fp.currentfig = FUELFRAMES - 2 + rint(2)
+          fp.currentfig = FUELFRAMES - 2 + random.rnumber(2)
           fp.figcount = 1
         } else if (fp.figcount <= 0) {
           // Advance to next animation frame (Terrain.c:281-286)
@@ -34,13 +34,6 @@ const EMPTY_SHOT = [0x6000, 0x9000, 0x9000, 0x6000]
 //
 // const EXPL_RANDS = generateExplRands()
 
-// Random counter constants for shot animation
-const RAND_COUNTER_MIN = 64
-const RAND_COUNTER_RANGE = 63
-
-// Static random counter that persists between calls
-let randCounter = 1
-
 /**
  * Draw the ship's bullets/shots on the bitmap
  *
@@ -57,12 +50,6 @@ export function drawShipShot(deps: {
 
     const adjustedY = y + SBARHT
 
-    // Update random counter
-    if (!--randCounter) {
-      randCounter =
-        Math.floor(Math.random() * RAND_COUNTER_RANGE) + RAND_COUNTER_MIN
-    }
-
     // Create 68K emulator instance
     const asm = build68kArch({
       data: {
@@ -80,7 +67,8 @@ export function drawShipShot(deps: {
     // neg.w x   /* x is left rot */
     const leftRot = 16 - xBits
 
-    // Original code gets random value but then unconditionally branches to @empty
+    // Original code steps a random counter and gets a random value but then
+    // unconditionally branches to @empty, so neither is kept here
     // moveq #3, D0
     // and.b (data), D0
     // bra.s @empty - UNCONDITIONAL BRANCH! Always draws empty shots
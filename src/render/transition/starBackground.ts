@@ -9,6 +9,7 @@
  */
 
 import type { MonochromeBitmap } from '@lib/bitmap'
+import type { RandomService } from '@core/shared'
 import { generateStarmapPixels } from './starmapPixels'
 import { starmapPixelsToBitmap } from './starmapToBitmap'
 
@@ -20,6 +21,7 @@ import { starmapPixelsToBitmap } from './starmapToBitmap'
  *
  * @param deps Dependencies object containing:
  *   @param starCount - Number of stars to create (default: 150 from original)
+ *   @param random - Render random stream to place the stars
  *   @param additionalRender - Optional function to render additional content
  *                            (e.g., full_figure for ship when !dead_count)
  * @returns a screen bitmap
@@ -28,12 +30,13 @@ import { starmapPixelsToBitmap } from './starmapToBitmap'
  */
 export function starBackground(deps: {
   starCount: number
+  random: RandomService
   additionalRender?: (screen: MonochromeBitmap) => MonochromeBitmap
 }): MonochromeBitmap {
-  const { starCount, additionalRender } = deps
+  const { starCount, random, additionalRender } = deps
 
   // Generate random star coordinates
-  const pixels = generateStarmapPixels(starCount)
+  const pixels = generateStarmapPixels(starCount, random)
 
   // Convert to bitmap with optional additional rendering
   return starmapPixelsToBitmap(pixels, additionalRender)
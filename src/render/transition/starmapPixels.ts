@@ -9,7 +9,7 @@
  */
 
 import { SCRWTH, VIEWHT } from '@core/screen'
-import { rint } from '@core/shared'
+import type { RandomService } from '@core/shared'
 
 /**
  * Generate random star coordinates for starmap background.
@@ -18,20 +18,22 @@ import { rint } from '@core/shared'
  * render stars on either a MonochromeBitmap or Frame.
  *
  * @param starCount Number of stars to generate (original uses 150)
+ * @param random Render random stream, so the same frame gets the same stars
  * @returns Array of pixel coordinates for star positions
  *
  * @see orig/Sources/Play.c:1260-1261
  */
 export function generateStarmapPixels(
-  starCount: number
+  starCount: number,
+  random: RandomService
 ): Array<{ x: number; y: number }> {
   const pixels: Array<{ x: number; y: number }> = []
 
   // Lines 1260-1261: for (i=0; i<150; i++) clear_point(rint(SCRWTH), rint(VIEWHT))
   // Generate random star positions
   for (let i = 0; i < starCount; i++) {
-    const x = rint(SCRWTH)
-    const y = rint(VIEWHT)
+    const x = random.rnumber(SCRWTH)
+    const y = random.rnumber(VIEWHT)
     pixels.push({ x, y })
   }
 
@@ -4,6 +4,7 @@
 
 import type { MonochromeBitmap, LineRec } from '@core/walls'
 import { blackRoutines } from './blackRoutines'
+import { clipExtent, reachesClip, type TerrainClip } from './terrainClip'
 
 // Screen boundary margins from original code
 const LEFT_MARGIN = 10 // Pixels to check left of screen
@@ -18,6 +19,8 @@ const TOP_MARGIN = 6 // Pixels to check above screen
  *   @param organizedWalls - Map of line ID to line record
  *   @param viewport - Screen bounds
  *   @param worldwidth - World width for wrapping
+ *   @param startId - Optional tracked start for this kind's walk (see getVisibleSet)
+ *   @param clips - Optional parts of the viewport to draw lines for (see terrainClip)
  * @returns A curried function that takes a screen and returns a new MonochromeBitmap
  */
 export const blackTerrain =
@@ -27,9 +30,19 @@ export const blackTerrain =
     organizedWalls: Record<string, LineRec>
     viewport: { x: number; y: number; b: number; r: number }
     worldwidth: number
+    startId?: string | null
+    clips?: readonly TerrainClip[]
   }) =>
   (screen: MonochromeBitmap): MonochromeBitmap => {
-    const { thekind, kindPointers, organizedWalls, viewport, worldwidth } = deps
+    const {
+      thekind,
+      kindPointers,
+      organizedWalls,
+      viewport,
+      worldwidth,
+      startId,
+      clips
+    } = deps
     // Deep clone the screen bitmap for immutability
     let newScreen: MonochromeBitmap = {
       data: new Uint8Array(screen.data),
@@ -45,10 +58,11 @@ export const blackTerrain =
     }
 
     // Set up visibility bounds (lines 54-57)
-    const right = viewport.r
-    const bot = viewport.b
-    const left = viewport.x - LEFT_MARGIN
-    const top = viewport.y - TOP_MARGIN
+    const bounds = clips ? clipExtent(clips) : viewport
+    const right = bounds.r
+    const bot = bounds.b
+    const left = bounds.x - LEFT_MARGIN
+    const top = bounds.y - TOP_MARGIN
 
     // Check if any lines could be visible (line 58)
     let p = organizedWalls[firstLineId]
@@ -56,7 +70,10 @@ export const blackTerrain =
       // First pass - nothing visible, but still need to check wrapped
     } else {
       // Find first potentially visible line (lines 60-70)
-      let lineId: string | null = firstLineId
+      // A tracked start is at or before the line the fast forward stops
+      // on, so the walk can begin there
+      let lineId: string | null =
+        startId === undefined ? firstLineId : startId
 
       // Fast forward to first line that might be visible (assembly loop)
       while (lineId !== null) {
@@ -76,7 +93,14 @@ export const blackTerrain =
         if (
           line.endx >= left &&
           (line.starty >= top || line.endy >= top) &&
-          (line.starty < bot || line.endy < bot)
+          (line.starty < bot || line.endy < bot) &&
+          reachesClip(
+            clips,
+            line.startx,
+            line.endx + LEFT_MARGIN + 1,
+            Math.min(line.starty, line.endy),
+            Math.max(line.starty, line.endy) + TOP_MARGIN + 1
+          )
         ) {
           // BLACK_LINE_Q macro - calls appropriate black drawing routine
           const drawFunc = blackRoutines[line.newtype]
@@ -96,7 +120,7 @@ export const blackTerrain =
     // World wrapping - second pass with adjusted coordinates
     // This pass is to draw the far-left side of the world when the
     // viewport is on the far-right.
-    const wrappedRight = viewport.r - worldwidth
+    const wrappedRight = right - worldwidth
     const wrappedScrx = viewport.x - worldwidth
 
     // Re-initialize lineId to the start of the list for the second pass,
@@ -116,7 +140,14 @@ export const blackTerrain =
       // This is the visibility check from the C `if` statement.
       if (
         (line.starty >= top || line.endy >= top) &&
-        (line.starty < bot || line.endy < bot)
+        (line.starty < bot || line.endy < bot) &&
+        reachesClip(
+          clips,
+          line.startx + worldwidth,
+          Infinity,
+          Math.min(line.starty, line.endy),
+          Math.max(line.starty, line.endy) + TOP_MARGIN + 1
+        )
       ) {
         // This corresponds to the `BLACK_LINE_Q` macro call.
         const drawFunc = blackRoutines[line.newtype]
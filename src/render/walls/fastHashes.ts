@@ -6,6 +6,7 @@ import type { MonochromeBitmap, JunctionRec } from '@core/walls'
 import { drawHash } from './drawHash'
 import { VIEWHT, SCRWTH, SBARHT } from '@core/screen'
 import { findWAddress } from '@lib/asm/assemblyMacros'
+import { clipExtent, reachesClip, type TerrainClip } from './terrainClip'
 
 // Constants from the original assembly code
 const SCREEN_TOP_MARGIN = 5 // Pixels to check above screen for hashes
@@ -19,6 +20,7 @@ const FAST_SEARCH_JUMP = 16 // Number of elements to jump in fast search phase
  *   @param junctions - Array of junction records
  *   @param viewport - Viewport coordinates
  *   @param worldwidth - World width for wrapping
+ *   @param clips - Optional parts of the viewport to draw hashes for
  * @returns A curried function that takes a screen and returns a new MonochromeBitmap
  */
 export const fastHashes =
@@ -26,9 +28,10 @@ export const fastHashes =
     junctions: JunctionRec[]
     viewport: { x: number; y: number; b: number; r: number }
     worldwidth: number
+    clips?: readonly TerrainClip[]
   }) =>
   (screen: MonochromeBitmap): MonochromeBitmap => {
-    const { junctions, viewport, worldwidth } = deps
+    const { junctions, viewport, worldwidth, clips } = deps
     // Deep clone the screen bitmap for immutability
     let newScreen: MonochromeBitmap = {
       data: new Uint8Array(screen.data),
@@ -37,10 +40,13 @@ export const fastHashes =
       rowBytes: screen.rowBytes
     }
 
-    const top = viewport.y - SCREEN_TOP_MARGIN
-    const bot = viewport.b
-    let left = viewport.x - SCREEN_LEFT_MARGIN
-    let right = viewport.r
+    const bounds = clips ? clipExtent(clips) : viewport
+    const top = bounds.y - SCREEN_TOP_MARGIN
+    const bot = bounds.b
+    let left = bounds.x - SCREEN_LEFT_MARGIN
+    let right = bounds.r
+    // Added to world x on the wrapped pass
+    let offset = 0
 
     // Process twice for donut world wrapping (orig/Sources/Junctions.c:833)
     for (let i = 0; i < 2; i++) {
@@ -67,13 +73,23 @@ export const fastHashes =
         const junction = junctions[jIndex]!
 
         // Y bounds check (orig asm lines 854-858)
-        if (junction.y < top || junction.y >= bot) {
+        if (
+          junction.y < top ||
+          junction.y >= bot ||
+          !reachesClip(
+            clips,
+            junction.x + offset,
+            junction.x + offset + SCREEN_LEFT_MARGIN + 1,
+            junction.y,
+            junction.y + SCREEN_TOP_MARGIN + 1
+          )
+        ) {
           jIndex++
           continue
         }
 
-        // Calculate drawing position
-        const drawX = junction.x - left
+        // Calculate drawing position, always relative to the viewport
+        const drawX = junction.x + offset - viewport.x
         const drawY = junction.y - viewport.y
 
         // Check if we can use the optimized inline drawing (lines 863-869)
@@ -148,6 +164,7 @@ export const fastHashes =
       left -= SCREEN_LEFT_MARGIN
       left -= worldwidth
       right -= worldwidth
+      offset += worldwidth
     }
 
     return newScreen
@@ -6,6 +6,7 @@ import type { MonochromeBitmap, WhiteRec } from '@core/walls'
 import { whiteWallPiece } from './whiteWallPiece'
 import { eorWallPiece } from './eorWallPiece'
 import { getAlignment } from '@core/shared'
+import { clipExtent, reachesClip, type TerrainClip } from './terrainClip'
 
 // Constants from the original assembly code
 const SCREEN_MARGIN = 15 // Pixels to check left of screen for whites that extend into view
@@ -25,6 +26,7 @@ const FAST_SEARCH_JUMP = 16 // Number of elements to jump in fast search phase
  *   @param whites - Array of white wall records
  *   @param viewport - Viewport coordinates
  *   @param worldwidth - World width for wrapping
+ *   @param clips - Optional parts of the viewport to draw pieces for
  * @returns A curried function that takes a screen and returns a new MonochromeBitmap
  */
 export const fastWhites =
@@ -32,9 +34,10 @@ export const fastWhites =
     whites: WhiteRec[]
     viewport: { x: number; y: number; b: number; r: number }
     worldwidth: number
+    clips?: readonly TerrainClip[]
   }) =>
   (screen: MonochromeBitmap): MonochromeBitmap => {
-    const { whites, viewport, worldwidth } = deps
+    const { whites, viewport, worldwidth, clips } = deps
     // Deep clone the screen bitmap for immutability
     let newScreen: MonochromeBitmap = {
       data: new Uint8Array(screen.data),
@@ -43,10 +46,13 @@ export const fastWhites =
       rowBytes: screen.rowBytes
     }
 
-    const top = viewport.y
-    const bot = viewport.b
-    let left = viewport.x - SCREEN_MARGIN
-    let right = viewport.r
+    const bounds = clips ? clipExtent(clips) : viewport
+    const top = bounds.y
+    const bot = bounds.b
+    let left = bounds.x - SCREEN_MARGIN
+    let right = bounds.r
+    // Added to world x on the wrapped pass
+    let offset = 0
 
     // Process twice for donut world wrapping (orig/Sources/Junctions.c:833)
     for (let i = 0; i < 2; i++) {
@@ -73,14 +79,24 @@ export const fastWhites =
         const wh = whites[whIndex]!
 
         // Y bounds check (orig asm lines 854-858)
-        if (wh.y >= bot || wh.y + wh.ht <= top) {
+        if (
+          wh.y >= bot ||
+          wh.y + wh.ht <= top ||
+          !reachesClip(
+            clips,
+            wh.x + offset - 1,
+            wh.x + offset + SCREEN_MARGIN,
+            wh.y,
+            wh.y + wh.ht
+          )
+        ) {
           whIndex++
           continue
         }
 
-        // Calculate drawing position
-        const drawX = wh.x - left
-        const drawY = wh.y - top
+        // Calculate drawing position, always relative to the viewport
+        const drawX = wh.x + offset - viewport.x
+        const drawY = wh.y - viewport.y
 
         // Call appropriate drawing function (orig asm lines 689-696)
         if (wh.hasj) {
@@ -119,6 +135,7 @@ export const fastWhites =
       left -= SCREEN_MARGIN
       left -= worldwidth
       right -= worldwidth
+      offset += worldwidth
     }
 
     return newScreen
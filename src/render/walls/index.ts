@@ -5,6 +5,7 @@
 // Main rendering functions
 export { fastWhites } from './fastWhites'
 export { fastHashes } from './fastHashes'
+export { junctionStamps } from './junctionStamps'
 export { whiteTerrain } from './whiteTerrain'
 export { blackTerrain } from './blackTerrain'
 export { whiteWallPiece } from './whiteWallPiece'
@@ -32,3 +33,12 @@ export { drawEline } from './lines/drawEline'
 
 // Function arrays
 export { blackRoutines } from './blackRoutines'
+
+// Terrain reused between frames
+export {
+  createTerrainCache,
+  updateTerrainCache,
+  type TerrainCache,
+  type TerrainLayers
+} from './scrollTerrain'
+export type { TerrainClip } from './terrainClip'
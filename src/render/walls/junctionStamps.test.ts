@@ -0,0 +1,81 @@
+import { describe, it, expect, afterEach } from 'vitest'
+import { createGameBitmap, type MonochromeBitmap } from '@lib/bitmap'
+import { SCRWTH, VIEWHT } from '@core/screen'
+import {
+  createRandomService,
+  setAlignmentMode,
+  type AlignmentMode
+} from '@core/shared'
+import { createWall, type NewType } from '@core/walls'
+import { initWalls } from '@core/walls/init'
+import { fastWhites } from './fastWhites'
+import { fastHashes } from './fastHashes'
+import { junctionStamps } from './junctionStamps'
+
+const WORLD = 1200
+
+const random = createRandomService()
+random.setSeed(97)
+const rnumber = random.rnumber
+
+// Short walls packed close together, so junctions are everywhere
+const walls = initWalls(
+  Array.from({ length: 400 }, (_, i) =>
+    createWall(
+      rnumber(WORLD - 40),
+      rnumber(900),
+      5 + rnumber(30),
+      (1 + rnumber(8)) as NewType,
+      rnumber(3) as 0 | 1 | 2,
+      i
+    )
+  ).sort((a, b) => a.startx - b.startx)
+)
+
+const noise = (): MonochromeBitmap => {
+  const screen = createGameBitmap()
+  for (let i = 0; i < screen.data.length; i++) {
+    screen.data[i] = rnumber(256)
+  }
+  return screen
+}
+
+// Every word phase, the top and bottom of the world and the wrap seam
+const views = (): { x: number; y: number }[] => [
+  ...Array.from({ length: 16 }, (_, i) => ({ x: 200 + i, y: 150 + i })),
+  { x: 0, y: -10 },
+  { x: 3, y: 600 },
+  { x: WORLD - 200, y: 300 },
+  { x: WORLD - 9, y: 301 },
+  { x: WORLD - 500, y: 40 }
+]
+
+describe('junctionStamps', () => {
+  afterEach(() => setAlignmentMode('world-fixed'))
+
+  it('keeps junctions dense enough to matter', () => {
+    expect(walls.junctions.length).toBeGreaterThan(300)
+    expect(walls.whites.filter(wh => wh.hasj).length).toBeGreaterThan(50)
+  })
+
+  for (const mode of ['world-fixed', 'screen-fixed'] as AlignmentMode[]) {
+    it(`draws the same as fastWhites then fastHashes (${mode})`, () => {
+      setAlignmentMode(mode)
+
+      for (const { x, y } of views()) {
+        const viewport = { x, y, b: y + VIEWHT, r: x + SCRWTH }
+        const deps = {
+          whites: walls.whites,
+          junctions: walls.junctions,
+          viewport,
+          worldwidth: WORLD
+        }
+        const screen = noise()
+
+        expect(junctionStamps(deps)(screen).data, `at ${x},${y}`).toEqual(
+          fastHashes(deps)(fastWhites(deps)(screen)).data
+        )
+      }
+    })
+  }
+})
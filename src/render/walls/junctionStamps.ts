@@ -0,0 +1,410 @@
+/**
+ * @fileoverview White pieces and junction hashes merged once per planet
+ *
+ * fast_whites() and fast_hashes() stamp every visible white piece and
+ * junction crosshatch one at a time, each clipped on its own, every
+ * frame. None of them ever move, so here they are merged into 16-pixel
+ * world column bands instead. A band holds everything whose x falls in
+ * it, as runs of rows of keep/flip long words (see captureLayer) composed
+ * in the original drawing order. A frame applies two or three masked
+ * words per row of each visible band.
+ *
+ * The bands cover the world twice over, the second copy standing for the
+ * wrapped pass, so drawing band by band in x order keeps the original
+ * order. Bands reaching the left or right edge of the view are still
+ * drawn piece by piece with the original kernels, which cull and clip
+ * there in ways a merged band cannot reproduce. The result is the same
+ * as fastWhites followed by fastHashes.
+ *
+ * Junction whites depend on background alignment, so white bands are
+ * built for each alignment mode and view parity on first use.
+ */
+
+import type { MonochromeBitmap, WhiteRec, JunctionRec } from '@core/walls'
+import { HASH_FIGURE } from '@core/walls/whiteBitmaps'
+import { SBARHT, SCRWTH, VIEWHT } from '@core/screen'
+import { getAlignment, getAlignmentMode } from '@core/shared'
+import { whiteWallPiece } from './whiteWallPiece'
+import { eorWallPiece } from './eorWallPiece'
+import { drawHash } from './drawHash'
+import { clipExtent, reachesClip, type TerrainClip } from './terrainClip'
+
+// Culling margins of fast_whites() and fast_hashes()
+const WHITE_MARGIN = 15
+const HASH_LEFT_MARGIN = 8
+const HASH_TOP_MARGIN = 5
+
+// Rightmost x at which a piece clips like it does mid-screen. Whites
+// further right are masked a long word at a time and skip the last row.
+const WHITE_INTERIOR_RIGHT = SCRWTH - 17
+const HASH_INTERIOR_RIGHT = SCRWTH - 10
+
+// Rows of nothing worth storing between two pieces rather than
+// starting a new run
+const RUN_GAP = 16
+
+type Op = 'and' | 'xor' | 'or'
+
+type Stamp = {
+  op: Op
+  /** World x, plus worldwidth for the wrapped copy */
+  x: number
+  y: number
+  /** 16-bit row patterns */
+  rows: readonly number[]
+  /** Height used for culling */
+  height: number
+  /** Byte data for whiteWallPiece and eorWallPiece */
+  data: Uint8Array
+}
+
+type Run = {
+  top: number
+  keep: Uint32Array
+  flip: Uint32Array
+}
+
+type Band = {
+  stamps: Stamp[]
+  runs: Run[]
+}
+
+type Bands = Map<number, Band>
+
+type PlanetStamps = {
+  junctions: readonly JunctionRec[]
+  worldwidth: number
+  hashes: Bands
+  /** White bands by alignment mode and view parity */
+  whites: Map<string, Bands>
+}
+
+const cache = new WeakMap<readonly WhiteRec[], PlanetStamps>()
+
+const rotl = (value: number, bits: number): number =>
+  ((value << bits) | (value >>> (32 - bits))) >>> 0
+
+const wordsOf = (data: readonly number[]): number[] =>
+  Array.from(
+    { length: data.length >> 1 },
+    (_, i) => (data[i * 2]! << 8) | data[i * 2 + 1]!
+  )
+
+/** Compose one stamp into a run, as its kernel would draw it */
+const composeStamp = (run: Run, stamp: Stamp, bandX: number): void => {
+  const shift = 16 - (stamp.x - bandX)
+  stamp.rows.forEach((row, i) => {
+    const r = stamp.y + i - run.top
+    switch (stamp.op) {
+      case 'and': {
+        const mask = rotl(0xffff0000 | row, shift)
+        run.keep[r] = run.keep[r]! & mask
+        run.flip[r] = run.flip[r]! & mask
+        break
+      }
+      case 'xor':
+        run.flip[r] = run.flip[r]! ^ rotl(row, shift)
+        break
+      case 'or': {
+        const bits = rotl(row, shift)
+        run.keep[r] = run.keep[r]! & ~bits
+        run.flip[r] = run.flip[r]! | bits
+        break
+      }
+    }
+  })
+}
+
+const buildBands = (stamps: readonly Stamp[]): Bands => {
+  const bands: Bands = new Map()
+  for (const stamp of stamps) {
+    const k = stamp.x >> 4
+    const band = bands.get(k)
+    if (band) {
+      band.stamps.push(stamp)
+    } else {
+      bands.set(k, { stamps: [stamp], runs: [] })
+    }
+  }
+
+  for (const [k, band] of bands) {
+    const byTop = [...band.stamps].sort((a, b) => a.y - b.y)
+    const spans: { top: number; bot: number }[] = []
+    for (const { y, rows } of byTop) {
+      const last = spans[spans.length - 1]
+      if (last && y <= last.bot + RUN_GAP) {
+        last.bot = Math.max(last.bot, y + rows.length)
+      } else {
+        spans.push({ top: y, bot: y + rows.length })
+      }
+    }
+
+    band.runs = spans.map(({ top, bot }) => ({
+      top,
+      keep: new Uint32Array(bot - top).fill(0xffffffff),
+      flip: new Uint32Array(bot - top)
+    }))
+    for (const stamp of band.stamps) {
+      const run = band.runs.find(
+        ({ top, keep }) => stamp.y >= top && stamp.y < top + keep.length
+      )!
+      composeStamp(run, stamp, k << 4)
+    }
+  }
+  return bands
+}
+
+const whiteBands = (
+  whites: readonly WhiteRec[],
+  worldwidth: number,
+  parity: number
+): Bands => {
+  const stamps = (offset: number): Stamp[] =>
+    whites.map(wh => {
+      let data = wh.data
+      if (wh.hasj) {
+        // Junction data as fastWhites picks it for a view of this parity
+        const align = getAlignment({
+          x: wh.x,
+          y: wh.y,
+          screenX: parity,
+          screenY: 0
+        })
+        data = (align === 0 ? wh.dataAlign0 : wh.dataAlign1) || wh.data
+      }
+      return {
+        op: wh.hasj ? 'xor' : 'and',
+        x: wh.x + offset,
+        y: wh.y,
+        rows: wordsOf(data).slice(0, wh.ht),
+        height: wh.ht,
+        data: new Uint8Array(data)
+      }
+    })
+  return buildBands([...stamps(0), ...stamps(worldwidth)])
+}
+
+const hashBands = (
+  junctions: readonly JunctionRec[],
+  worldwidth: number
+): Bands => {
+  const stamps = (offset: number): Stamp[] =>
+    junctions.map(junction => ({
+      op: 'or',
+      x: junction.x + offset,
+      y: junction.y,
+      rows: HASH_FIGURE,
+      height: HASH_FIGURE.length,
+      data: new Uint8Array(0)
+    }))
+  return buildBands([...stamps(0), ...stamps(worldwidth)])
+}
+
+const planetStamps = (
+  whites: readonly WhiteRec[],
+  junctions: readonly JunctionRec[],
+  worldwidth: number
+): PlanetStamps => {
+  const cached = cache.get(whites)
+  if (cached?.junctions === junctions && cached.worldwidth === worldwidth) {
+    return cached
+  }
+  const stamps: PlanetStamps = {
+    junctions,
+    worldwidth,
+    hashes: hashBands(junctions, worldwidth),
+    whites: new Map()
+  }
+  cache.set(whites, stamps)
+  return stamps
+}
+
+/** Apply a band's long words to one screen row, two or three words wide */
+const applyRow = (
+  data: Uint8Array,
+  address: number,
+  shift: number,
+  keep: number,
+  flip: number
+): void => {
+  const hiKeep = ((keep >>> shift) | ~(0xffffffff >>> shift)) >>> 0
+  const hiFlip = flip >>> shift
+  data[address] = (data[address]! & (hiKeep >>> 24)) ^ (hiFlip >>> 24)
+  data[address + 1] =
+    (data[address + 1]! & (hiKeep >>> 16)) ^ ((hiFlip >>> 16) & 0xff)
+  data[address + 2] =
+    (data[address + 2]! & (hiKeep >>> 8)) ^ ((hiFlip >>> 8) & 0xff)
+  data[address + 3] = (data[address + 3]! & hiKeep) ^ (hiFlip & 0xff)
+
+  if (shift > 0) {
+    const loKeep = ((keep << (32 - shift)) >>> 16) | (0xffff >>> shift)
+    const loFlip = (flip << (32 - shift)) >>> 16
+    data[address + 4] = (data[address + 4]! & (loKeep >>> 8)) ^ (loFlip >>> 8)
+    data[address + 5] = (data[address + 5]! & loKeep) ^ (loFlip & 0xff)
+  }
+}
+
+const applyBand = (
+  screen: MonochromeBitmap,
+  band: Band,
+  bandX: number,
+  viewport: { x: number; y: number },
+  clips: readonly TerrainClip[] | undefined
+): void => {
+  const column = bandX - viewport.x
+  const shift = column & 15
+  const byte = (column >> 4) * 2
+
+  for (const { top, keep, flip } of band.runs) {
+    if (!reachesClip(clips, bandX, bandX + 32, top, top + keep.length)) {
+      continue
+    }
+    const first = Math.max(0, viewport.y - top)
+    const last = Math.min(keep.length, viewport.y + VIEWHT - top)
+    for (let r = first; r < last; r++) {
+      const k = keep[r]!
+      const f = flip[r]!
+      if (k === 0xffffffff && f === 0) continue
+      const row = top + r - viewport.y + SBARHT
+      applyRow(screen.data, row * screen.rowBytes + byte, shift, k, f)
+    }
+  }
+}
+
+type View = {
+  viewport: { x: number; y: number; b: number; r: number }
+  clips: readonly TerrainClip[] | undefined
+  bounds: { x: number; r: number }
+}
+
+/**
+ * Draw the bands from `left` to the right edge of the bounds in x order:
+ * merged where every piece clips as it does mid-screen, otherwise one
+ * piece at a time through `drawStamp`
+ */
+const drawBands = (
+  screen: MonochromeBitmap,
+  bands: Bands,
+  { viewport, clips, bounds }: View,
+  { left, interiorRight }: { left: number; interiorRight: number },
+  drawStamp: (screen: MonochromeBitmap, stamp: Stamp) => MonochromeBitmap
+): MonochromeBitmap => {
+  let newScreen = screen
+  for (let k = left >> 4; k <= bounds.r >> 4; k++) {
+    const band = bands.get(k)
+    if (!band) continue
+
+    const column = (k << 4) - viewport.x
+    if (column >= 0 && column + 15 <= interiorRight) {
+      applyBand(newScreen, band, k << 4, viewport, clips)
+    } else {
+      for (const stamp of band.stamps) {
+        newScreen = drawStamp(newScreen, stamp)
+      }
+    }
+  }
+  return newScreen
+}
+
+/**
+ * Draws all visible white pieces, then all visible junction hashes
+ *
+ * Same output as fastWhites followed by fastHashes, from bands merged the
+ * first time a planet's whites are drawn.
+ *
+ * @see orig/Sources/Junctions.c:634 fast_whites()
+ * @see orig/Sources/Junctions.c:822 fast_hashes()
+ * @param deps - Dependencies object containing:
+ *   @param whites - Array of white wall records, sorted by x
+ *   @param junctions - Array of junction records, sorted by x
+ *   @param viewport - Viewport coordinates
+ *   @param worldwidth - World width for wrapping
+ *   @param clips - Optional parts of the viewport to draw pieces for
+ * @returns A curried function that takes a screen and returns a new MonochromeBitmap
+ */
+export const junctionStamps =
+  (deps: {
+    whites: WhiteRec[]
+    junctions: JunctionRec[]
+    viewport: { x: number; y: number; b: number; r: number }
+    worldwidth: number
+    clips?: readonly TerrainClip[]
+  }) =>
+  (screen: MonochromeBitmap): MonochromeBitmap => {
+    const { whites, junctions, viewport, worldwidth, clips } = deps
+    let newScreen: MonochromeBitmap = {
+      data: new Uint8Array(screen.data),
+      width: screen.width,
+      height: screen.height,
+      rowBytes: screen.rowBytes
+    }
+
+    const planet = planetStamps(whites, junctions, worldwidth)
+    const parity = (viewport.x + viewport.y) & 1
+    const key = `${getAlignmentMode()}:${parity}`
+    let white = planet.whites.get(key)
+    if (!white) {
+      white = whiteBands(whites, worldwidth, parity)
+      planet.whites.set(key, white)
+    }
+
+    const bounds = clips ? clipExtent(clips) : viewport
+    const view = { viewport, clips, bounds }
+
+    newScreen = drawBands(
+      newScreen,
+      white,
+      view,
+      {
+        left: bounds.x - WHITE_MARGIN,
+        interiorRight: WHITE_INTERIOR_RIGHT
+      },
+      (screen, { op, x, y, height, data }) => {
+        // fast_whites() culling
+        if (
+          x <= bounds.x - WHITE_MARGIN ||
+          x > bounds.r ||
+          y >= bounds.b ||
+          y + height <= bounds.y ||
+          !reachesClip(clips, x - 1, x + WHITE_MARGIN, y, y + height)
+        ) {
+          return screen
+        }
+        const piece = { x: x - viewport.x, y: y - viewport.y, height, data }
+        return op === 'xor'
+          ? eorWallPiece(piece)(screen)
+          : whiteWallPiece(piece)(screen)
+      }
+    )
+
+    newScreen = drawBands(
+      newScreen,
+      planet.hashes,
+      view,
+      {
+        left: bounds.x - HASH_LEFT_MARGIN,
+        interiorRight: HASH_INTERIOR_RIGHT
+      },
+      (screen, { x, y }) => {
+        // fast_hashes() culling
+        if (
+          x < bounds.x - HASH_LEFT_MARGIN ||
+          x >= bounds.r ||
+          y < bounds.y - HASH_TOP_MARGIN ||
+          y >= bounds.b ||
+          !reachesClip(
+            clips,
+            x,
+            x + HASH_LEFT_MARGIN + 1,
+            y,
+            y + HASH_TOP_MARGIN + 1
+          )
+        ) {
+          return screen
+        }
+        return drawHash({ x: x - viewport.x, y: y - viewport.y })(screen)
+      }
+    )
+
+    return newScreen
+  }
@@ -0,0 +1,177 @@
+import { describe, it, expect, afterEach } from 'vitest'
+import {
+  applyLayer,
+  captureLayer,
+  countDiffPixels,
+  createGameBitmap,
+  getPixel,
+  setPixel,
+  type MonochromeBitmap
+} from '@lib/bitmap'
+import { SBARHT, SCRWTH, VIEWHT } from '@core/screen'
+import {
+  createRandomService,
+  LINE_KIND,
+  setAlignmentMode,
+  type AlignmentMode
+} from '@core/shared'
+import { createWall, type NewType } from '@core/walls'
+import { initWalls } from '@core/walls/init'
+import { blackTerrain } from './blackTerrain'
+import { whiteTerrain } from './whiteTerrain'
+import { createTerrainCache, updateTerrainCache } from './scrollTerrain'
+import { scrollTerrainLayer } from './terrainLayer'
+
+const WORLD = 2000
+
+const random = createRandomService()
+random.setSeed(4321)
+const rnumber = random.rnumber
+
+const walls = initWalls(
+  Array.from({ length: 300 }, (_, i) =>
+    createWall(
+      rnumber(WORLD - 100),
+      rnumber(1000),
+      10 + rnumber(80),
+      (1 + rnumber(8)) as NewType,
+      rnumber(3) as 0 | 1 | 2,
+      i
+    )
+  ).sort((a, b) => a.startx - b.startx)
+)
+
+// Noise, so every kind of bit operation shows up in the comparison
+const noise = (): MonochromeBitmap => {
+  const screen = createGameBitmap()
+  for (let i = 0; i < screen.data.length; i++) {
+    screen.data[i] = rnumber(256)
+  }
+  return screen
+}
+
+// Moves in every direction, a long jump, and a trip across the seam.
+// Horizontal moves by part of a word are mixed in, and must be exact too.
+const path = (): { x: number; y: number }[] => {
+  const out = [{ x: 300, y: 200 }]
+  const moves = [
+    [16, 0],
+    [0, 3],
+    [3, 1],
+    [-32, 2],
+    [-5, -1],
+    [0, -7],
+    [7, 3],
+    [16, 16],
+    [-2, 0],
+    [-16, -1],
+    [1, 1],
+    [0, 1],
+    [400, 0],
+    [-9, 1],
+    [0, 30]
+  ] as const
+  for (let i = 0; i < 60; i++) {
+    const [dx, dy] = moves[i % moves.length]!
+    const last = out[out.length - 1]!
+    out.push({ x: last.x + dx, y: last.y + dy })
+  }
+  for (let x = out[out.length - 1]!.x; x < WORLD + 40; x += 13) {
+    out.push({ x: x % WORLD, y: 400 + (x % 3) })
+  }
+  return out
+}
+
+const drawDirect = (
+  viewport: { x: number; y: number; b: number; r: number },
+  screen: MonochromeBitmap
+): { under: MonochromeBitmap; over: MonochromeBitmap } => {
+  const black = (thekind: number) =>
+    blackTerrain({
+      thekind,
+      kindPointers: walls.kindPointers,
+      organizedWalls: walls.organizedWalls,
+      viewport,
+      worldwidth: WORLD
+    })
+  const white = whiteTerrain({
+    whites: walls.whites,
+    junctions: walls.junctions,
+    firstWhite: walls.firstWhite,
+    organizedWalls: walls.organizedWalls,
+    viewport,
+    worldwidth: WORLD
+  })
+  return {
+    under: black(LINE_KIND.GHOST)(white(screen)),
+    over: black(LINE_KIND.NORMAL)(black(LINE_KIND.BOUNCE)(screen))
+  }
+}
+
+describe('scrollTerrain', () => {
+  afterEach(() => setAlignmentMode('world-fixed'))
+
+  for (const mode of ['world-fixed', 'screen-fixed'] as AlignmentMode[]) {
+    it(`matches a full redraw while scrolling (${mode})`, () => {
+      setAlignmentMode(mode)
+      const cache = createTerrainCache()
+
+      for (const { x, y } of path()) {
+        const viewport = { x, y, b: y + VIEWHT, r: x + SCRWTH }
+        const screen = noise()
+        const layers = updateTerrainCache(cache, {
+          walls,
+          viewport,
+          worldwidth: WORLD,
+          screen
+        })
+        const direct = drawDirect(viewport, screen)
+
+        for (const name of ['under', 'over'] as const) {
+          expect(
+            applyLayer(layers[name])(screen).data,
+            `${name} at ${x},${y}`
+          ).toEqual(direct[name].data)
+        }
+      }
+    })
+  }
+
+  it('starts over when the walls change', () => {
+    const cache = createTerrainCache()
+    const viewport = { x: 300, y: 200, b: 200 + VIEWHT, r: 300 + SCRWTH }
+    const screen = createGameBitmap()
+    updateTerrainCache(cache, { walls, viewport, worldwidth: WORLD, screen })
+
+    const nextLevel = initWalls([])
+    const layers = updateTerrainCache(cache, {
+      walls: nextLevel,
+      viewport: { ...viewport, x: 301, r: 301 + SCRWTH },
+      worldwidth: WORLD,
+      screen
+    })
+    expect(layers.over.flip.every(byte => byte === 0)).toBe(true)
+    expect(layers.over.keep.every(byte => byte === 0xff)).toBe(true)
+  })
+
+  it('shifts layers by any number of pixels', () => {
+    const layer = captureLayer(screen => {
+      const out = { ...screen, data: new Uint8Array(screen.data) }
+      setPixel(out, 100, SBARHT + 50)
+      return out
+    }, createGameBitmap())
+
+    for (const [dx, dy] of [
+      [8, 0],
+      [-3, 0],
+      [13, -6],
+      [0, 4]
+    ] as const) {
+      const moved = applyLayer(scrollTerrainLayer(layer, dx, dy))(
+        createGameBitmap()
+      )
+      expect(getPixel(moved, 100 - dx, SBARHT + 50 - dy)).toBe(true)
+      expect(countDiffPixels(moved, createGameBitmap())).toBe(1)
+    }
+  })
+})
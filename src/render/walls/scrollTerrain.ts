@@ -0,0 +1,410 @@
+/**
+ * @fileoverview Terrain layers reused between frames by scrolling them
+ *
+ * The view usually moves a few pixels per tick, so most of last frame's
+ * terrain is still correct, just shifted. Each layer here is scrolled by
+ * the view delta and only the newly exposed strips are drawn, with the
+ * wall kernels clipped to those strips. Memory stays at a few screens no
+ * matter how large the world is.
+ *
+ * The kernels clip walls near the screen edges a word at a time, so the
+ * outermost few pixels of a frame are not what the same walls look like
+ * further in, and words written at the right edge run on into the next
+ * row. Guard bands along every edge are redrawn with the new strips, all
+ * in one pass.
+ *
+ * The ENE kernel draws the first pixels of a wall differently depending
+ * on where the wall starts within a screen word, so after a horizontal
+ * move by part of a word the walls that say so through phaseRects are
+ * redrawn too. Those are found through a startx-ordered window over each
+ * kind's ENE walls, built once per level, so the cost follows the walls
+ * near the view. With that every move matches a full redraw exactly.
+ *
+ * A layer is drawn in full on the first frame, on a new level, after a
+ * long jump, when the view crosses the world-wrap boundary, and when the
+ * background alignment changes how walls are patterned.
+ */
+
+import {
+  captureLayer,
+  type BitmapLayer,
+  type MonochromeBitmap,
+  type Rectangle
+} from '@lib/bitmap'
+import type { WallsState } from '@core/walls'
+import {
+  createSlidingWindow,
+  type SlidingWindow,
+  type VisibleSet
+} from '@core/visibility'
+import { SBARHT, SCRWTH, VIEWHT } from '@core/screen'
+import {
+  LINE_KIND,
+  NEW_TYPE,
+  getAlignmentMode,
+  type AlignmentMode,
+  type LineKind
+} from '@core/shared'
+import { blackTerrain } from './blackTerrain'
+import { whiteTerrain } from './whiteTerrain'
+import type { TerrainClip } from './terrainClip'
+import { pasteTerrainLayer, scrollTerrainLayer } from './terrainLayer'
+
+// Moves longer than this are cheaper to draw from scratch
+const MAX_SCROLL_X = SCRWTH / 4
+const MAX_SCROLL_Y = VIEWHT / 4
+
+// Width of the band along each edge where clipping differs from a full draw
+const GUARD = 16
+
+// The left edge needs more: walls entering from the left are clipped a
+// long word at a time, and words written at the right edge run on into
+// the first bytes of the next row
+const LEFT_GUARD = 32
+
+export type ScrollTerrainDeps = {
+  /** Changes identity whenever the walls do (on every level load) */
+  walls: object
+  screenx: number
+  screeny: number
+  worldwidth: number
+  /** Screen to size the layer after */
+  screen: MonochromeBitmap
+  /**
+   * World rects whose pixels depend on the view's word phase, redrawn
+   * after a horizontal move that is not a whole number of words
+   */
+  phaseRects?: () => readonly TerrainClip[]
+  /** The layer's kernels, drawing only what reaches the clips */
+  draw: (
+    clips?: readonly TerrainClip[]
+  ) => (screen: MonochromeBitmap) => MonochromeBitmap
+}
+
+export type ScrollTerrain = {
+  update: (deps: ScrollTerrainDeps) => BitmapLayer
+  reset: () => void
+}
+
+type Previous = {
+  walls: object
+  screenx: number
+  screeny: number
+  worldwidth: number
+  alignment: AlignmentMode
+  layer: BitmapLayer
+}
+
+/**
+ * View-relative spans [start, end) to redraw after moving by delta along
+ * an axis of the given size: the exposed edge plus both guard bands
+ */
+const dirtySpans = (
+  delta: number,
+  size: number,
+  startGuard = GUARD
+): [number, number][] =>
+  delta > 0
+    ? [
+        [0, startGuard],
+        [size - delta - GUARD, size]
+      ]
+    : [
+        [0, startGuard - delta],
+        [size - GUARD, size]
+      ]
+
+export const createScrollTerrain = (): ScrollTerrain => {
+  let previous: Previous | null = null
+
+  const canScroll = (
+    prev: Previous,
+    deps: ScrollTerrainDeps,
+    alignment: AlignmentMode
+  ): boolean => {
+    const dx = deps.screenx - prev.screenx
+    const dy = deps.screeny - prev.screeny
+    const onRightSide = (x: number): boolean => x > deps.worldwidth - SCRWTH
+    return (
+      prev.walls === deps.walls &&
+      prev.worldwidth === deps.worldwidth &&
+      prev.layer.keep.length === deps.screen.data.length &&
+      prev.alignment === alignment &&
+      Math.abs(dx) <= MAX_SCROLL_X &&
+      Math.abs(dy) <= MAX_SCROLL_Y &&
+      onRightSide(prev.screenx) === onRightSide(deps.screenx) &&
+      // Screen-fixed walls are patterned relative to the view, so an odd
+      // move changes every gray pixel rather than just shifting them
+      (alignment === 'world-fixed' || ((dx + dy) & 1) === 0)
+    )
+  }
+
+  return {
+    update: deps => {
+      const { screenx, screeny, screen, draw } = deps
+      const alignment = getAlignmentMode()
+      let layer: BitmapLayer
+      if (previous && canScroll(previous, deps, alignment)) {
+        const dx = screenx - previous.screenx
+        const dy = screeny - previous.screeny
+        if (dx === 0 && dy === 0) return previous.layer
+
+        layer = scrollTerrainLayer(previous.layer, dx, dy)
+
+        // Full-height columns and full-width rows, in view coordinates.
+        // Those along the top also take the status bar rows, which walls
+        // at the top of the view can run into.
+        const rects: Rectangle[] = []
+        if (dx !== 0) {
+          for (const [start, end] of dirtySpans(dx, SCRWTH, LEFT_GUARD)) {
+            rects.push({
+              x: start,
+              y: -SBARHT,
+              width: end - start,
+              height: SBARHT + VIEWHT
+            })
+          }
+        }
+        if (dy !== 0) {
+          for (const [start, end] of dirtySpans(dy, VIEWHT)) {
+            const y = start === 0 ? -SBARHT : start
+            rects.push({ x: 0, y, width: SCRWTH, height: end - y })
+          }
+        }
+        if ((dx & 15) !== 0 && deps.phaseRects) {
+          for (const world of deps.phaseRects()) {
+            const x = Math.max(0, world.x - screenx)
+            const y = Math.max(-SBARHT, world.y - screeny)
+            const r = Math.min(SCRWTH, world.r - screenx)
+            const b = Math.min(VIEWHT, world.b - screeny)
+            if (r > x && b > y) {
+              rects.push({ x, y, width: r - x, height: b - y })
+            }
+          }
+        }
+
+        // Walls are culled against each strip plus GUARD on its inner
+        // sides, which the kernels' own margins are too tight for, but
+        // never beyond the view so the outer edges clip like a full draw.
+        // All strips are drawn in one pass so that runoff from the right
+        // edge into the left band lands in the same order as a full draw.
+        const clips = rects.map(rect => ({
+          x: screenx + Math.max(0, rect.x - GUARD),
+          y: screeny + Math.max(0, rect.y - GUARD),
+          r: screenx + Math.min(SCRWTH, rect.x + rect.width + GUARD),
+          b: screeny + Math.min(VIEWHT, rect.y + rect.height + GUARD)
+        }))
+        const strips = captureLayer(draw(clips), screen)
+        for (const rect of rects) {
+          pasteTerrainLayer(layer, strips, { ...rect, y: rect.y + SBARHT })
+        }
+      } else {
+        layer = captureLayer(draw(), screen)
+      }
+
+      previous = {
+        walls: deps.walls,
+        screenx,
+        screeny,
+        worldwidth: deps.worldwidth,
+        alignment,
+        layer
+      }
+      return layer
+    },
+
+    reset: () => {
+      previous = null
+    }
+  }
+}
+
+/**
+ * The terrain passes of a frame, in drawing order
+ *
+ * They are kept apart because the ship is erased between the two.
+ */
+export type TerrainLayers = {
+  /** white_terrain then black_terrain(L_GHOST) */
+  under: BitmapLayer
+  /** black_terrain(L_BOUNCE) then black_terrain(L_NORMAL) */
+  over: BitmapLayer
+}
+
+export type TerrainCache = {
+  under: ScrollTerrain
+  over: ScrollTerrain
+}
+
+// Room around a wall's extent for the pixels its kernel draws beside it
+const PHASE_MARGIN = 4
+
+/**
+ * One kind's ENE wall extents in startx order, with cursors for the view
+ * and for its copy across the world wrap
+ */
+type EneWindow = {
+  rects: TerrainClip[]
+  /** Widest extent, so walls starting left of the view are found too */
+  maxWidth: number
+  main: SlidingWindow
+  wrapped: SlidingWindow
+}
+
+// Built on first use per level; a level load replaces the walls state
+const eneWindows = new WeakMap<WallsState, Map<LineKind, EneWindow>>()
+
+const getEneWindow = (walls: WallsState, kind: LineKind): EneWindow => {
+  let byKind = eneWindows.get(walls)
+  if (!byKind) {
+    byKind = new Map()
+    eneWindows.set(walls, byKind)
+  }
+  let window = byKind.get(kind)
+  if (!window) {
+    // The kind index is in startx order, and so are the extents
+    const rects = walls.kindIndex[kind].ids
+      .map(id => walls.organizedWalls[id]!)
+      .filter(line => line.newtype === NEW_TYPE.ENE)
+      .map(line => ({
+        x: line.startx - PHASE_MARGIN,
+        y: line.endy - PHASE_MARGIN,
+        r: line.endx + PHASE_MARGIN,
+        b: line.starty + PHASE_MARGIN
+      }))
+    const xs = rects.map(rect => rect.x)
+    window = {
+      rects,
+      maxWidth: rects.reduce(
+        (width, rect) => Math.max(width, rect.r - rect.x),
+        0
+      ),
+      main: createSlidingWindow(xs),
+      wrapped: createSlidingWindow(xs)
+    }
+    byKind.set(kind, window)
+  }
+  return window
+}
+
+/**
+ * Extents of the ENE walls of the given kinds that reach the view, where
+ * it sees them directly or across the world wrap
+ */
+const eneRects =
+  (
+    walls: WallsState,
+    kinds: readonly LineKind[],
+    worldwidth: number,
+    viewport: { x: number; y: number; b: number; r: number }
+  ): (() => TerrainClip[]) =>
+  () => {
+    const rects: TerrainClip[] = []
+    const top = viewport.y - SBARHT
+
+    const collect = (
+      window: EneWindow,
+      range: { lo: number; hi: number },
+      shift: number
+    ): void => {
+      for (let i = range.lo; i < range.hi; i++) {
+        const rect = window.rects[i]!
+        if (
+          rect.r + shift > viewport.x &&
+          rect.b > top &&
+          rect.y < viewport.b
+        ) {
+          rects.push(
+            shift === 0
+              ? rect
+              : { ...rect, x: rect.x + shift, r: rect.r + shift }
+          )
+        }
+      }
+    }
+
+    for (const kind of kinds) {
+      const window = getEneWindow(walls, kind)
+      const left = viewport.x - window.maxWidth
+      collect(window, window.main.move(left, viewport.r), 0)
+      collect(
+        window,
+        window.wrapped.move(left - worldwidth, viewport.r - worldwidth),
+        worldwidth
+      )
+    }
+    return rects
+  }
+
+export const createTerrainCache = (): TerrainCache => ({
+  under: createScrollTerrain(),
+  over: createScrollTerrain()
+})
+
+/**
+ * Bring both layers up to date with the current view
+ */
+export const updateTerrainCache = (
+  cache: TerrainCache,
+  deps: {
+    walls: WallsState
+    viewport: { x: number; y: number; b: number; r: number }
+    worldwidth: number
+    screen: MonochromeBitmap
+    visible?: VisibleSet
+  }
+): TerrainLayers => {
+  const { walls, viewport, worldwidth, screen, visible } = deps
+  const common = {
+    walls,
+    screenx: viewport.x,
+    screeny: viewport.y,
+    worldwidth,
+    screen
+  }
+
+  const black = (
+    thekind: LineKind,
+    clips: readonly TerrainClip[] | undefined
+  ): ((screen: MonochromeBitmap) => MonochromeBitmap) =>
+    blackTerrain({
+      thekind,
+      kindPointers: walls.kindPointers,
+      organizedWalls: walls.organizedWalls,
+      viewport,
+      worldwidth,
+      startId: visible?.kindStarts[thekind],
+      clips
+    })
+
+  return {
+    under: cache.under.update({
+      ...common,
+      phaseRects: eneRects(walls, [LINE_KIND.GHOST], worldwidth, viewport),
+      draw: clips => screen => {
+        const withWhites = whiteTerrain({
+          whites: walls.whites,
+          junctions: walls.junctions,
+          firstWhite: walls.firstWhite,
+          organizedWalls: walls.organizedWalls,
+          viewport,
+          worldwidth,
+          whiteStartId: visible?.whiteStart,
+          clips
+        })(screen)
+        return black(LINE_KIND.GHOST, clips)(withWhites)
+      }
+    }),
+    over: cache.over.update({
+      ...common,
+      phaseRects: eneRects(
+        walls,
+        [LINE_KIND.BOUNCE, LINE_KIND.NORMAL],
+        worldwidth,
+        viewport
+      ),
+      draw: clips => screen =>
+        black(LINE_KIND.NORMAL, clips)(black(LINE_KIND.BOUNCE, clips)(screen))
+    })
+  }
+}
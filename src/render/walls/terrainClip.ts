@@ -0,0 +1,40 @@
+/**
+ * @fileoverview Limiting the wall kernels to parts of the view
+ *
+ * The scrolling terrain cache (see scrollTerrain) only redraws strips of
+ * the view. Kernels given clips walk their lists with bounds taken from
+ * the extent of all clips, as they would for the viewport, and then skip
+ * anything that reaches none of them. Lines are still drawn relative to
+ * the viewport, so every pixel a kernel does draw is the same as in a
+ * full draw.
+ */
+
+/** World-space rect, shaped like the renderer's viewport */
+export type TerrainClip = { x: number; y: number; b: number; r: number }
+
+/**
+ * Smallest rect containing every clip
+ */
+export const clipExtent = (clips: readonly TerrainClip[]): TerrainClip => ({
+  x: Math.min(...clips.map(clip => clip.x)),
+  y: Math.min(...clips.map(clip => clip.y)),
+  b: Math.max(...clips.map(clip => clip.b)),
+  r: Math.max(...clips.map(clip => clip.r))
+})
+
+/**
+ * Whether something covering [left, right) x [top, bot) in world space,
+ * kernel margins included, overlaps any of the clips. Always true when
+ * there are no clips.
+ */
+export const reachesClip = (
+  clips: readonly TerrainClip[] | undefined,
+  left: number,
+  right: number,
+  top: number,
+  bot: number
+): boolean =>
+  !clips ||
+  clips.some(
+    clip => right > clip.x && left < clip.r && bot > clip.y && top < clip.b
+  )
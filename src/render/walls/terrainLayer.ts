@@ -0,0 +1,110 @@
+/**
+ * @fileoverview Scrolling and patching captured terrain layers
+ *
+ * Terrain passes are captured as keep/flip layers (see @lib/bitmap
+ * layer). These move a layer along with the view and patch freshly drawn
+ * strips into it.
+ */
+
+import type { BitmapLayer, Rectangle } from '@lib/bitmap'
+import { SBARHT } from '@core/screen'
+
+/**
+ * Shift one plane so that new[x, y] = old[x + dx, y + dy]
+ *
+ * The status bar rows only move sideways: kernels touch them just with
+ * runoff from walls at the top of the view. Byte-aligned moves copy whole
+ * row spans; anything else shifts bits across byte boundaries. Pixels
+ * with no source get `fill`.
+ */
+const shiftPlane = (
+  src: Uint8Array,
+  rowBytes: number,
+  height: number,
+  dx: number,
+  dy: number,
+  fill: number
+): Uint8Array => {
+  const out = new Uint8Array(src.length).fill(fill)
+
+  const q = dx >> 3 // Whole bytes, rounded down
+  const r = dx & 7 // Remaining bits
+  const byteAt = (row: number, i: number): number =>
+    i >= 0 && i < rowBytes ? src[row + i]! : fill
+
+  for (let y = 0; y < height; y++) {
+    const sy = y < SBARHT ? y : y + dy
+    if (y >= SBARHT && (sy < SBARHT || sy >= height)) continue
+    const dst = y * rowBytes
+    const row = sy * rowBytes
+
+    if (r === 0) {
+      const from = Math.max(0, q)
+      const to = Math.min(rowBytes, rowBytes + q)
+      if (from < to) {
+        out.set(src.subarray(row + from, row + to), dst + from - q)
+      }
+    } else {
+      for (let b = 0; b < rowBytes; b++) {
+        const hi = byteAt(row, b + q)
+        const lo = byteAt(row, b + q + 1)
+        out[dst + b] = ((hi << r) | (lo >> (8 - r))) & 0xff
+      }
+    }
+  }
+
+  return out
+}
+
+/**
+ * The layer as seen from a view moved by (dx, dy)
+ *
+ * Newly exposed pixels are left unchanged by the result and must be
+ * filled in with pasteTerrainLayer.
+ */
+export const scrollTerrainLayer = (
+  layer: BitmapLayer,
+  dx: number,
+  dy: number
+): BitmapLayer => {
+  const { rowBytes, height } = layer
+  return {
+    keep: shiftPlane(layer.keep, rowBytes, height, dx, dy, 0xff),
+    flip: shiftPlane(layer.flip, rowBytes, height, dx, dy, 0),
+    rowBytes,
+    height
+  }
+}
+
+/**
+ * Copy a rectangle of `from` into `into`, in place
+ *
+ * @param rect - In screen pixels, including the status bar rows
+ */
+export const pasteTerrainLayer = (
+  into: BitmapLayer,
+  from: BitmapLayer,
+  rect: Rectangle
+): void => {
+  const { rowBytes } = into
+  const x0 = Math.max(0, rect.x)
+  const x1 = Math.min(rowBytes * 8, rect.x + rect.width)
+  const y0 = Math.max(0, rect.y)
+  const y1 = Math.min(into.height, rect.y + rect.height)
+  if (x0 >= x1 || y0 >= y1) return
+
+  const firstByte = x0 >> 3
+  const lastByte = (x1 - 1) >> 3
+
+  for (let y = y0; y < y1; y++) {
+    const row = y * rowBytes
+    for (let b = firstByte; b <= lastByte; b++) {
+      let mask = 0xff
+      if (b === firstByte) mask &= 0xff >> (x0 & 7)
+      if (b === lastByte) mask &= (0xff00 >> (((x1 - 1) & 7) + 1)) & 0xff
+      const i = row + b
+      into.keep[i] = (into.keep[i]! & ~mask) | (from.keep[i]! & mask)
+      into.flip[i] = (into.flip[i]! & ~mask) | (from.flip[i]! & mask)
+    }
+  }
+}
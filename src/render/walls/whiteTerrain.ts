@@ -8,9 +8,9 @@ import type {
   JunctionRec,
   LineRec
 } from '@core/walls'
-import { fastWhites } from './fastWhites'
-import { fastHashes } from './fastHashes'
+import { junctionStamps } from './junctionStamps'
 import { nneWhite } from './directional/nneWhite'
+import { clipExtent, reachesClip, type TerrainClip } from './terrainClip'
 
 // Screen boundary margins from original code
 const LEFT_MARGIN = 10 // Pixels to check left of screen
@@ -26,6 +26,8 @@ const TOP_MARGIN = 6 // Pixels to check above screen
  *   @param organizedWalls - Wall lookup by ID
  *   @param viewport - Viewport coordinates
  *   @param worldwidth - World width for wrapping
+ *   @param whiteStartId - Optional tracked start for the NNE walk (see getVisibleSet)
+ *   @param clips - Optional parts of the viewport to draw for (see terrainClip)
  * @returns A curried function that takes a screen and returns a new MonochromeBitmap
  */
 export const whiteTerrain =
@@ -36,6 +38,8 @@ export const whiteTerrain =
     organizedWalls: Record<string, LineRec>
     viewport: { x: number; y: number; b: number; r: number }
     worldwidth: number
+    whiteStartId?: string | null
+    clips?: readonly TerrainClip[]
   }) =>
   (screen: MonochromeBitmap): MonochromeBitmap => {
     const {
@@ -44,7 +48,9 @@ export const whiteTerrain =
       firstWhite,
       organizedWalls,
       viewport,
-      worldwidth
+      worldwidth,
+      whiteStartId,
+      clips
     } = deps
     // Deep clone the screen bitmap for immutability
     let newScreen: MonochromeBitmap = {
@@ -54,30 +60,28 @@ export const whiteTerrain =
       rowBytes: screen.rowBytes
     }
 
-    // Draw white endpoint and junction patches (line 91)
-    newScreen = fastWhites({
-      whites: whites,
-      viewport: viewport,
-      worldwidth: worldwidth
-    })(newScreen)
-
-    // Draw crosshatch patterns at junctions (line 93)
-    newScreen = fastHashes({
-      junctions: junctions,
-      viewport: viewport,
-      worldwidth: worldwidth
+    // Draw white endpoint and junction patches (line 91), then crosshatch
+    // patterns at junctions (line 93), from bands merged per planet
+    newScreen = junctionStamps({
+      whites,
+      junctions,
+      viewport,
+      worldwidth,
+      clips
     })(newScreen)
 
     // Set up visibility bounds (lines 95-98)
-    const right = viewport.r
-    const left = viewport.x - LEFT_MARGIN
-    const top = viewport.y - TOP_MARGIN
-    const bot = viewport.b
+    const bounds = clips ? clipExtent(clips) : viewport
+    const right = bounds.r
+    const left = bounds.x - LEFT_MARGIN
+    const top = bounds.y - TOP_MARGIN
+    const bot = bounds.b
 
     // Draw NNE wall white undersides - first pass (lines 99-105)
     if (firstWhite !== null) {
-      // Find first visible NNE wall
-      let wallId: string | null = firstWhite
+      // Find first visible NNE wall, starting from the tracked window if any
+      let wallId: string | null =
+        whiteStartId === undefined ? firstWhite : whiteStartId
 
       // Skip walls completely to the left (lines 99-100)
       while (wallId !== null) {
@@ -97,7 +101,14 @@ export const whiteTerrain =
         if (
           wall.endx >= left &&
           (wall.starty >= top || wall.endy >= top) &&
-          (wall.starty < bot || wall.endy < bot)
+          (wall.starty < bot || wall.endy < bot) &&
+          reachesClip(
+            clips,
+            wall.startx,
+            wall.endx + LEFT_MARGIN + 1,
+            Math.min(wall.starty, wall.endy),
+            Math.max(wall.starty, wall.endy) + TOP_MARGIN + 1
+          )
         ) {
           newScreen = nneWhite({
             linerec: wall,
@@ -121,7 +132,14 @@ export const whiteTerrain =
         // Visibility check for wrapped walls
         if (
           (wall.starty >= top || wall.endy >= top) &&
-          (wall.starty < bot || wall.endy < bot)
+          (wall.starty < bot || wall.endy < bot) &&
+          reachesClip(
+            clips,
+            wall.startx + worldwidth,
+            Infinity,
+            Math.min(wall.starty, wall.endy),
+            Math.max(wall.starty, wall.endy) + TOP_MARGIN + 1
+          )
         ) {
           newScreen = nneWhite({
             linerec: wall,